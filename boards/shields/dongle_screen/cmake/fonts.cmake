@@ -0,0 +1,48 @@
+# Copyright (c) 2024 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+
+# Compiles a subset of each nerd font size picked by layout.cmake, holding
+# only the glyphs referenced by the widgets that render text with it and,
+# for the layer widget, by the keymap layer names. A referenced codepoint
+# missing from the font fails the build. Widgets drawing their symbols from
+# the icon atlas (icons.cmake) don't need a nerd font at runtime.
+
+set(DONGLE_SCREEN_LAYER_SOURCES src/widgets/layer_status.c)
+
+set(dongle_screen_font_tool ${CMAKE_CURRENT_LIST_DIR}/../scripts/lvgl_font.py)
+set(dongle_screen_dir ${CMAKE_CURRENT_LIST_DIR}/..)
+
+foreach(size ${DONGLE_SCREEN_FONT_SIZES})
+  set(sources)
+  set(defines)
+  set(dts_args)
+  set(dts_depends)
+  foreach(widget ${DONGLE_SCREEN_WIDGETS})
+    if(DONGLE_SCREEN_${widget}_FONT_SIZE EQUAL size)
+      foreach(source ${DONGLE_SCREEN_${widget}_SOURCES})
+        list(APPEND sources ${dongle_screen_dir}/${source})
+      endforeach()
+      list(APPEND defines -D DONGLE_SCREEN_${widget}_FONT_SIZE=${size})
+      if(widget STREQUAL "LAYER")
+        set(dts_args --dts ${ZEPHYR_BINARY_DIR}/zephyr.dts)
+        set(dts_depends ${ZEPHYR_BINARY_DIR}/zephyr.dts)
+      endif()
+    endif()
+  endforeach()
+
+  if(NOT sources)
+    continue()
+  endif()
+
+  set(font ${dongle_screen_dir}/src/fonts/nerd_${size}.c)
+  set(subset ${CMAKE_CURRENT_BINARY_DIR}/fonts/nerd_${size}.c)
+  add_custom_command(
+    OUTPUT ${subset}
+    COMMAND ${CMAKE_COMMAND} -E make_directory ${CMAKE_CURRENT_BINARY_DIR}/fonts
+    COMMAND ${PYTHON_EXECUTABLE} ${dongle_screen_font_tool} subset ${font}
+            --sources ${sources} ${defines} ${dts_args} -o ${subset}
+    DEPENDS ${font} ${sources} ${dts_depends} ${dongle_screen_font_tool}
+    COMMENT "Subsetting nerd_${size}"
+  )
+  zephyr_library_sources(${subset})
+endforeach()
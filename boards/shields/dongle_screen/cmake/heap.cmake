@@ -0,0 +1,32 @@
+# Copyright (c) 2024 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+
+# Sums how much of the LVGL pool the status screen needs for the widget
+# selection. Every widget allocates its LVGL objects and local styles once at
+# init and never frees them, so the need is the base use of the display plus a
+# fixed budget per active widget. The budgets are CONFIG_DONGLE_SCREEN_*_HEAP
+# from Kconfig.heap, recorded on 32-bit native_sim by scripts/heap_budget.py
+# (estimates until CONFIG_DONGLE_SCREEN_HEAP_RECORDED).
+# With CONFIG_DONGLE_SCREEN_ZERO_HEAP, Kconfig.heap also defaults
+# LV_Z_MEM_POOL_SIZE to this sum.
+
+set(DONGLE_SCREEN_HEAP ${CONFIG_DONGLE_SCREEN_BASE_HEAP})
+foreach(widget WPM OUTPUT LAYER MODIFIER BATTERY)
+  if(CONFIG_DONGLE_SCREEN_${widget}_ACTIVE)
+    math(EXPR DONGLE_SCREEN_HEAP "${DONGLE_SCREEN_HEAP} + ${CONFIG_DONGLE_SCREEN_${widget}_HEAP}")
+  endif()
+endforeach()
+
+if(CONFIG_DONGLE_SCREEN_ZERO_HEAP AND CONFIG_LV_Z_MEM_POOL_SIZE LESS DONGLE_SCREEN_HEAP)
+  message(FATAL_ERROR "dongle_screen: CONFIG_LV_Z_MEM_POOL_SIZE=${CONFIG_LV_Z_MEM_POOL_SIZE} is "
+                      "set below the ${DONGLE_SCREEN_HEAP} bytes the status screen needs, "
+                      "remove it to use the computed size")
+endif()
+if(CONFIG_DONGLE_SCREEN_HEAP_RECORDED)
+  set(dongle_screen_heap_source "recorded")
+else()
+  set(dongle_screen_heap_source "estimated, not recorded yet")
+endif()
+message(STATUS "dongle_screen: status screen needs ${DONGLE_SCREEN_HEAP} bytes of LVGL pool "
+               "(${dongle_screen_heap_source}), "
+               "CONFIG_LV_Z_MEM_POOL_SIZE=${CONFIG_LV_Z_MEM_POOL_SIZE}")
@@ -0,0 +1,36 @@
+# Copyright (c) 2024 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+
+# Renders the icon lists of include/icons.h at the font size layout.cmake
+# picked for their widget. Characters missing from the nerd font are taken
+# from the Montserrat font of the same size, as the label fallback did.
+
+set(dongle_screen_font_tool ${CMAKE_CURRENT_LIST_DIR}/../scripts/lvgl_font.py)
+set(dongle_screen_dir ${CMAKE_CURRENT_LIST_DIR}/..)
+set(dongle_screen_icons ${dongle_screen_dir}/include/icons.h)
+
+foreach(widget OUTPUT MODIFIER WPM)
+  if(NOT widget IN_LIST DONGLE_SCREEN_WIDGETS)
+    continue()
+  endif()
+
+  set(size ${DONGLE_SCREEN_${widget}_FONT_SIZE})
+  string(TOLOWER ${widget} name)
+  set(font ${dongle_screen_dir}/src/fonts/nerd_${size}.c)
+  set(fallback ${ZEPHYR_LVGL_MODULE_DIR}/src/font/lv_font_montserrat_${size}.c)
+  set(atlas ${CMAKE_CURRENT_BINARY_DIR}/icons/${name}_icons.c)
+  set(small_args)
+  if(size LESS 20)
+    set(small_args --small)
+  endif()
+
+  add_custom_command(
+    OUTPUT ${atlas}
+    COMMAND ${CMAKE_COMMAND} -E make_directory ${CMAKE_CURRENT_BINARY_DIR}/icons
+    COMMAND ${PYTHON_EXECUTABLE} ${dongle_screen_font_tool} atlas ${dongle_screen_icons} ${widget}
+            --font ${font} --fallback ${fallback} ${small_args} -o ${atlas}
+    DEPENDS ${dongle_screen_icons} ${font} ${fallback} ${dongle_screen_font_tool}
+    COMMENT "Rendering ${name} icons at ${size} px"
+  )
+  zephyr_library_sources(${atlas})
+endforeach()
@@ -0,0 +1,83 @@
+# Copyright (c) 2024 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+
+# Resolves the font size of every active widget from the Kconfig widget
+# selection and the chosen display, mirroring the row layout in include/layout.h.
+# fonts.cmake compiles only the font sizes of the resolved layout.
+
+dt_chosen(dongle_screen_display PROPERTY "zephyr,display")
+dt_prop(dongle_screen_height PATH "${dongle_screen_display}" PROPERTY "height")
+
+set(rows 0)
+if(CONFIG_DONGLE_SCREEN_WPM_ACTIVE OR CONFIG_DONGLE_SCREEN_OUTPUT_ACTIVE)
+  math(EXPR rows "${rows} + 1")
+endif()
+if(CONFIG_DONGLE_SCREEN_LAYER_ACTIVE)
+  math(EXPR rows "${rows} + 2")
+endif()
+if(CONFIG_DONGLE_SCREEN_MODIFIER_ACTIVE)
+  math(EXPR rows "${rows} + 1")
+endif()
+if(CONFIG_DONGLE_SCREEN_BATTERY_ACTIVE)
+  math(EXPR rows "${rows} + 1")
+endif()
+if(rows EQUAL 0)
+  set(rows 1)
+endif()
+math(EXPR DONGLE_SCREEN_CELL_HEIGHT "${dongle_screen_height} / ${rows}")
+
+# dongle_screen_font_size(<var> <rowspan> <sizes>...)
+# Picks the largest nerd font size whose threshold fits the widget height.
+# <sizes> are "<min height>:<font size>" pairs in ascending order.
+function(dongle_screen_font_size var rowspan)
+  math(EXPR height "${DONGLE_SCREEN_CELL_HEIGHT} * ${rowspan}")
+  foreach(entry ${ARGN})
+    string(REPLACE ":" ";" entry "${entry}")
+    list(GET entry 0 min_height)
+    list(GET entry 1 size)
+    if(NOT height LESS min_height)
+      set(result ${size})
+    endif()
+  endforeach()
+  set(${var} ${result} PARENT_SCOPE)
+endfunction()
+
+set(DONGLE_SCREEN_FONT_SIZES)
+set(DONGLE_SCREEN_WIDGETS)
+
+if(CONFIG_DONGLE_SCREEN_WPM_ACTIVE)
+  dongle_screen_font_size(DONGLE_SCREEN_WPM_FONT_SIZE 1 0:12 20:20)
+  list(APPEND DONGLE_SCREEN_FONT_SIZES ${DONGLE_SCREEN_WPM_FONT_SIZE})
+  list(APPEND DONGLE_SCREEN_WIDGETS WPM)
+endif()
+if(CONFIG_DONGLE_SCREEN_OUTPUT_ACTIVE)
+  dongle_screen_font_size(DONGLE_SCREEN_OUTPUT_FONT_SIZE 1 0:12 20:20)
+  list(APPEND DONGLE_SCREEN_FONT_SIZES ${DONGLE_SCREEN_OUTPUT_FONT_SIZE})
+  list(APPEND DONGLE_SCREEN_WIDGETS OUTPUT)
+endif()
+if(CONFIG_DONGLE_SCREEN_LAYER_ACTIVE)
+  dongle_screen_font_size(DONGLE_SCREEN_LAYER_FONT_SIZE 2 0:12 20:20 24:24)
+  list(APPEND DONGLE_SCREEN_FONT_SIZES ${DONGLE_SCREEN_LAYER_FONT_SIZE})
+  list(APPEND DONGLE_SCREEN_WIDGETS LAYER)
+endif()
+if(CONFIG_DONGLE_SCREEN_MODIFIER_ACTIVE)
+  dongle_screen_font_size(DONGLE_SCREEN_MODIFIER_FONT_SIZE 1 0:12 20:20 24:24)
+  list(APPEND DONGLE_SCREEN_FONT_SIZES ${DONGLE_SCREEN_MODIFIER_FONT_SIZE})
+  list(APPEND DONGLE_SCREEN_WIDGETS MODIFIER)
+endif()
+list(REMOVE_DUPLICATES DONGLE_SCREEN_FONT_SIZES)
+
+foreach(widget ${DONGLE_SCREEN_WIDGETS})
+  message(STATUS "dongle_screen: ${widget} widget uses nerd_${DONGLE_SCREEN_${widget}_FONT_SIZE}")
+endforeach()
+
+# WPM text and the layer font's fallback are Montserrat at the resolved size,
+# selected per widget in Kconfig.defconfig
+foreach(widget WPM LAYER)
+  if(widget IN_LIST DONGLE_SCREEN_WIDGETS)
+    set(size ${DONGLE_SCREEN_${widget}_FONT_SIZE})
+    if(NOT CONFIG_LV_FONT_MONTSERRAT_${size})
+      message(FATAL_ERROR "dongle_screen: ${widget} widget needs CONFIG_LV_FONT_MONTSERRAT_${size}")
+    endif()
+  endif()
+endforeach()
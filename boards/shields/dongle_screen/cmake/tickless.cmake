@@ -0,0 +1,23 @@
+# Copyright (c) 2024 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+
+# src/display/render.c stops ZMK's fixed display tick by calling k_timer_stop
+# on the display_timer that app/src/display/main.c defines. ZMK offers no
+# hook for this, so check the definition is still there and not static
+# before building against it; otherwise the build would only fail at link
+# time with an undefined reference.
+
+set(dongle_screen_zmk_display ${APPLICATION_SOURCE_DIR}/src/display/main.c)
+
+if(NOT EXISTS ${dongle_screen_zmk_display})
+  message(FATAL_ERROR "dongle_screen: CONFIG_DONGLE_SCREEN_TICKLESS needs ZMK's display "
+                      "main at ${dongle_screen_zmk_display}, disable the option to use "
+                      "the fixed display tick")
+endif()
+
+file(READ ${dongle_screen_zmk_display} dongle_screen_zmk_display_src)
+if(NOT dongle_screen_zmk_display_src MATCHES "(^|\n)K_TIMER_DEFINE\\(display_timer,")
+  message(FATAL_ERROR "dongle_screen: ${dongle_screen_zmk_display} no longer defines a "
+                      "non-static display_timer, which CONFIG_DONGLE_SCREEN_TICKLESS stops. "
+                      "Disable the option to use the fixed display tick")
+endif()
@@ -1,9 +1,21 @@
 #pragma once
 
 #include <lvgl.h>
+#include <zephyr/sys/util_macro.h>
 
-LV_FONT_DECLARE(nerd_12);
-LV_FONT_DECLARE(nerd_20);
-LV_FONT_DECLARE(nerd_24);
-LV_FONT_DECLARE(nerd_32);
-LV_FONT_DECLARE(nerd_40);
\ No newline at end of file
+/*
+ * The font size of each active widget is resolved from the layout by
+ * cmake/layout.cmake. Only the layer widget renders nerd font text, the
+ * other widgets take their symbols from the icon atlas (icons.h).
+ */
+#define NERD_FONT(size)       UTIL_CAT(nerd_, size)
+#define MONTSERRAT_FONT(size) UTIL_CAT(lv_font_montserrat_, size)
+
+#ifdef DONGLE_SCREEN_WPM_FONT_SIZE
+#define WPM_FONT MONTSERRAT_FONT(DONGLE_SCREEN_WPM_FONT_SIZE)
+#endif
+
+#ifdef DONGLE_SCREEN_LAYER_FONT_SIZE
+#define LAYER_FONT NERD_FONT(DONGLE_SCREEN_LAYER_FONT_SIZE)
+LV_FONT_DECLARE(LAYER_FONT);
+#endif
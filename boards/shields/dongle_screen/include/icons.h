@@ -0,0 +1,60 @@
+#pragma once
+
+#include <lvgl.h>
+
+/*
+ * Fixed status symbols of the output, modifier and WPM widgets. Every list is
+ * rendered at the widget's font size into 1bpp images by
+ * scripts/lvgl_font.py atlas (see cmake/icons.cmake), so widgets show a
+ * symbol by pointing an lv_image at its atlas entry instead of shaping text.
+ *
+ * X(id, symbol, small symbol): the small symbol is used below 20 px.
+ *
+ * The nerd font has no boxed-multiple 4 (U+F03B2), so profile 4 bonded shows
+ * a plain 4 from Montserrat next to the bonded Bluetooth icon.
+ */
+#define ICON_ID(id, ...) id,
+
+#define OUTPUT_ICONS(X)                                      \
+    X(OUTPUT_ICON_USB, "󰕓", "")                             \
+    X(OUTPUT_ICON_USB_NOT_READY, "󱇰", "󱇰")                   \
+    X(OUTPUT_ICON_BT_CONNECTED, "󰂱", "󰂱")                    \
+    X(OUTPUT_ICON_BT_BONDED, "󰂲", "󰂲")                       \
+    X(OUTPUT_ICON_BT_UNBONDED, "󰂳", "󰂳")                     \
+    X(OUTPUT_ICON_PROFILE_1_CONNECTED, "󰎤", "1[C]")          \
+    X(OUTPUT_ICON_PROFILE_2_CONNECTED, "󰎧", "2[C]")          \
+    X(OUTPUT_ICON_PROFILE_3_CONNECTED, "󰎪", "3[C]")          \
+    X(OUTPUT_ICON_PROFILE_4_CONNECTED, "󰎭", "4[C]")          \
+    X(OUTPUT_ICON_PROFILE_5_CONNECTED, "󰎱", "5[C]")          \
+    X(OUTPUT_ICON_PROFILE_1_BONDED, "󰎥", "1[D]")             \
+    X(OUTPUT_ICON_PROFILE_2_BONDED, "󰎨", "2[D]")             \
+    X(OUTPUT_ICON_PROFILE_3_BONDED, "󰎫", "3[D]")             \
+    X(OUTPUT_ICON_PROFILE_4_BONDED, "4", "4[D]")             \
+    X(OUTPUT_ICON_PROFILE_5_BONDED, "󰎯", "5[D]")             \
+    X(OUTPUT_ICON_PROFILE_1_UNBONDED, "󰎦", "1[F]")           \
+    X(OUTPUT_ICON_PROFILE_2_UNBONDED, "󰎩", "2[F]")           \
+    X(OUTPUT_ICON_PROFILE_3_UNBONDED, "󰎬", "3[F]")           \
+    X(OUTPUT_ICON_PROFILE_4_UNBONDED, "󰎮", "4[F]")           \
+    X(OUTPUT_ICON_PROFILE_5_UNBONDED, "󰎰", "5[F]")
+
+#define MODIFIER_ICONS(X)                                    \
+    X(MODIFIER_ICON_CAPS_LOCK, "󰘲", "󰘲")                     \
+    X(MODIFIER_ICON_NUM_LOCK, "", "")                       \
+    X(MODIFIER_ICON_SCROLL_LOCK, "S", "S")                   \
+    X(MODIFIER_ICON_CTRL, "󰘴", "󰘴")                          \
+    X(MODIFIER_ICON_SHIFT, "󰘶", "󰘶")                         \
+    X(MODIFIER_ICON_ALT, "󰘵", "󰘵")                           \
+    X(MODIFIER_ICON_GUI, "", "")
+
+#define WPM_ICONS(X)                                         \
+    X(WPM_ICON_FAST, "󰓅", "󰓅")                               \
+    X(WPM_ICON_MEDIUM, "󰾅", "󰾅")                             \
+    X(WPM_ICON_SLOW, "󰾆", "󰾆")
+
+enum output_icon { OUTPUT_ICONS(ICON_ID) OUTPUT_ICON_COUNT };
+enum modifier_icon { MODIFIER_ICONS(ICON_ID) MODIFIER_ICON_COUNT };
+enum wpm_icon { WPM_ICONS(ICON_ID) WPM_ICON_COUNT };
+
+extern const lv_image_dsc_t output_icons[OUTPUT_ICON_COUNT];
+extern const lv_image_dsc_t modifier_icons[MODIFIER_ICON_COUNT];
+extern const lv_image_dsc_t wpm_icons[WPM_ICON_COUNT];
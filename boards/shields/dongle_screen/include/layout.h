@@ -0,0 +1,78 @@
+#pragma once
+
+#include <zephyr/sys/util.h>
+#include <util.h>
+
+/*
+ * Screen layout, resolved at build time into the pixel rectangle of every
+ * widget. The screen is split into rows of equal height, from top to bottom:
+ *
+ *   band    widgets          rows
+ *   top     wpm | output     1
+ *   layer   layer            2
+ *   mod     modifier         1
+ *   bat     battery          1
+ *
+ * Disabled widgets take no space; output takes the whole top band without
+ * wpm. cmake/layout.cmake does the same row math to pick the font sizes.
+ */
+
+#define LAYOUT_WPM      IS_ENABLED(CONFIG_DONGLE_SCREEN_WPM_ACTIVE)
+#define LAYOUT_OUTPUT   IS_ENABLED(CONFIG_DONGLE_SCREEN_OUTPUT_ACTIVE)
+#define LAYOUT_LAYER    IS_ENABLED(CONFIG_DONGLE_SCREEN_LAYER_ACTIVE)
+#define LAYOUT_MODIFIER IS_ENABLED(CONFIG_DONGLE_SCREEN_MODIFIER_ACTIVE)
+#define LAYOUT_BATTERY  IS_ENABLED(CONFIG_DONGLE_SCREEN_BATTERY_ACTIVE)
+
+#define LAYOUT_TOP_ROWS   ((LAYOUT_WPM || LAYOUT_OUTPUT) ? 1 : 0)
+#define LAYOUT_LAYER_ROWS (LAYOUT_LAYER ? 2 : 0)
+#define LAYOUT_MOD_ROWS   (LAYOUT_MODIFIER ? 1 : 0)
+#define LAYOUT_BAT_ROWS   (LAYOUT_BATTERY ? 1 : 0)
+
+#define LAYOUT_ROWS \
+    MAX(LAYOUT_TOP_ROWS + LAYOUT_LAYER_ROWS + LAYOUT_MOD_ROWS + LAYOUT_BAT_ROWS, 1)
+#define LAYOUT_ROW_HEIGHT (DISPLAY_HEIGHT / LAYOUT_ROWS)
+#define LAYOUT_HALF_WIDTH (DISPLAY_WIDTH / 2)
+
+#define LAYOUT_WPM_X      0
+#define LAYOUT_WPM_Y      0
+#define LAYOUT_WPM_W      (LAYOUT_WPM * LAYOUT_HALF_WIDTH)
+#define LAYOUT_WPM_H      (LAYOUT_WPM * LAYOUT_TOP_ROWS * LAYOUT_ROW_HEIGHT)
+
+#define LAYOUT_OUTPUT_X   LAYOUT_WPM_W
+#define LAYOUT_OUTPUT_Y   0
+#define LAYOUT_OUTPUT_W   (LAYOUT_OUTPUT * (DISPLAY_WIDTH - LAYOUT_WPM_W))
+#define LAYOUT_OUTPUT_H   (LAYOUT_OUTPUT * LAYOUT_TOP_ROWS * LAYOUT_ROW_HEIGHT)
+
+#define LAYOUT_LAYER_X    0
+#define LAYOUT_LAYER_Y    (LAYOUT_TOP_ROWS * LAYOUT_ROW_HEIGHT)
+#define LAYOUT_LAYER_W    (LAYOUT_LAYER * DISPLAY_WIDTH)
+#define LAYOUT_LAYER_H    (LAYOUT_LAYER_ROWS * LAYOUT_ROW_HEIGHT)
+
+#define LAYOUT_MODIFIER_X 0
+#define LAYOUT_MODIFIER_Y (LAYOUT_LAYER_Y + LAYOUT_LAYER_H)
+#define LAYOUT_MODIFIER_W (LAYOUT_MODIFIER * DISPLAY_WIDTH)
+#define LAYOUT_MODIFIER_H (LAYOUT_MOD_ROWS * LAYOUT_ROW_HEIGHT)
+
+#define LAYOUT_BATTERY_X  0
+#define LAYOUT_BATTERY_Y  (LAYOUT_MODIFIER_Y + LAYOUT_MODIFIER_H)
+#define LAYOUT_BATTERY_W  (LAYOUT_BATTERY * DISPLAY_WIDTH)
+#define LAYOUT_BATTERY_H  (LAYOUT_BAT_ROWS * LAYOUT_ROW_HEIGHT)
+
+// X(ID, name) for every widget, ID selects the LAYOUT_<ID>_* values
+#define LAYOUT_WIDGETS(X)                                                                        \
+    X(WPM, "wpm")                                                                                \
+    X(OUTPUT, "output")                                                                          \
+    X(LAYER, "layer")                                                                            \
+    X(MODIFIER, "modifier")                                                                      \
+    X(BATTERY, "battery")
+
+#define LAYOUT_FITS(id)                                                                          \
+    (LAYOUT_##id##_X + LAYOUT_##id##_W <= DISPLAY_WIDTH &&                                       \
+     LAYOUT_##id##_Y + LAYOUT_##id##_H <= DISPLAY_HEIGHT)
+
+// Empty rectangles of disabled widgets never overlap
+#define LAYOUT_OVERLAP(a, b)                                                                     \
+    (LAYOUT_##a##_X < LAYOUT_##b##_X + LAYOUT_##b##_W &&                                         \
+     LAYOUT_##b##_X < LAYOUT_##a##_X + LAYOUT_##a##_W &&                                         \
+     LAYOUT_##a##_Y < LAYOUT_##b##_Y + LAYOUT_##b##_H &&                                         \
+     LAYOUT_##b##_Y < LAYOUT_##a##_Y + LAYOUT_##a##_H)
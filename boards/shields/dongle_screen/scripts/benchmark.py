@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 The ZMK Contributors
+#
+# SPDX-License-Identifier: MIT
+
+"""
+Render and flush cost of the dongle screen per widget and layout
+configuration, measured on native_sim with CONFIG_DONGLE_SCREEN_BENCHMARK.
+
+Run one built configuration (also the dongle_screen_benchmark build target):
+
+    benchmark.py run build/zephyr/zephyr.exe -o report.json
+
+Build and run every combination of the widget and orientation options:
+
+    benchmark.py matrix --zmk-app /workspaces/zmk/app \\
+        --module /workspaces/zmk-modules/zmk-dongle-screen -o report.json \\
+        [--vary wpm,battery,flipped] [-- extra cmake arguments]
+
+The report is a JSON list with one entry per configuration.
+"""
+
+import argparse
+import itertools
+import json
+import os
+import subprocess
+import sys
+
+PREFIX = "dongle_screen_bench "
+
+OPTIONS = {
+    "wpm": "CONFIG_DONGLE_SCREEN_WPM_ACTIVE",
+    "output": "CONFIG_DONGLE_SCREEN_OUTPUT_ACTIVE",
+    "layer": "CONFIG_DONGLE_SCREEN_LAYER_ACTIVE",
+    "modifier": "CONFIG_DONGLE_SCREEN_MODIFIER_ACTIVE",
+    "battery": "CONFIG_DONGLE_SCREEN_BATTERY_ACTIVE",
+    "flipped": "CONFIG_DONGLE_SCREEN_FLIPPED",
+    "battery_vertical": "CONFIG_DONGLE_SCREEN_BATTERY_VERTICAL",
+}
+
+
+def run_exe(exe, timeout):
+    """Run a benchmark build and return its parsed report line"""
+    try:
+        proc = subprocess.run([exe, f"-stop_at={timeout}"], capture_output=True, text=True,
+                              timeout=timeout + 30)
+    except subprocess.TimeoutExpired:
+        return {"error": "timeout"}
+    for line in proc.stdout.splitlines():
+        i = line.find(PREFIX)
+        if i >= 0:
+            return json.loads(line[i + len(PREFIX):])
+    return {"error": f"no report, exit code {proc.returncode}"}
+
+
+def print_table(results):
+    for result in results:
+        config = result.get("config", {})
+        active = ",".join(k for k, v in config.items() if v) or "-"
+        if "error" in result:
+            print(f"{active:<60} {result['error']}")
+            continue
+        widgets = " ".join(f"{w['name']}={w['render_us']}us/{w['bytes']}B"
+                           for w in result["widgets"])
+        print(f"{active:<60} init {result['init_us']}us heap {result['heap_screen']}B  {widgets}")
+
+
+def matrix(args):
+    vary = args.vary.split(",") if args.vary else list(OPTIONS)
+    unknown = [v for v in vary if v not in OPTIONS]
+    if unknown:
+        sys.exit(f"unknown options: {', '.join(unknown)} (known: {', '.join(OPTIONS)})")
+
+    results = []
+    for values in itertools.product((1, 0), repeat=len(vary)):
+        config = dict(zip(vary, values))
+        if not any(config.get(w, 1) for w in ("wpm", "output", "layer", "modifier", "battery")):
+            continue
+
+        name = "_".join(f"{k}{v}" for k, v in config.items())
+        build_dir = os.path.join(args.build_root, name)
+        cmd = ["west", "build", "-p", "-s", args.zmk_app, "-d", build_dir, "-b", args.board,
+               "--", "-DSHIELD=dongle_screen", f"-DZMK_EXTRA_MODULES={args.module}",
+               "-DCONFIG_DONGLE_SCREEN_BENCHMARK=y"]
+        cmd += [f"-D{OPTIONS[k]}={'y' if v else 'n'}" for k, v in config.items()]
+        cmd += args.cmake_args
+
+        print(f"building {name}", file=sys.stderr)
+        build = subprocess.run(cmd, capture_output=True, text=True)
+        if build.returncode != 0:
+            result = {"config": config, "error": "build failed"}
+            sys.stderr.write(build.stdout[-2000:] + build.stderr[-2000:])
+        else:
+            result = run_exe(os.path.join(build_dir, "zephyr", "zephyr.exe"), args.timeout)
+            result.setdefault("config", config)
+        results.append(result)
+
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="cmd", required=True)
+
+    p = sub.add_parser("run", help="run one benchmark build")
+    p.add_argument("exe")
+    p.add_argument("-o", "--output")
+    p.add_argument("--timeout", type=int, default=60, help="simulated seconds")
+
+    p = sub.add_parser("matrix", help="build and run every configuration")
+    p.add_argument("--zmk-app", required=True)
+    p.add_argument("--module", required=True)
+    p.add_argument("--board", default="native_sim/native/64")
+    p.add_argument("--build-root", default="build/dongle_screen_benchmark")
+    p.add_argument("--vary", help=f"comma separated subset of {','.join(OPTIONS)}")
+    p.add_argument("--timeout", type=int, default=60, help="simulated seconds")
+    p.add_argument("-o", "--output")
+    p.add_argument("cmake_args", nargs="*")
+
+    args = parser.parse_args()
+    results = [run_exe(args.exe, args.timeout)] if args.cmd == "run" else matrix(args)
+
+    print_table(results)
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as f:
+            json.dump(results, f, indent=2)
+    if any("error" in r for r in results):
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 The ZMK Contributors
+#
+# SPDX-License-Identifier: MIT
+
+"""
+Host side of the dongle_screen event recorder, see src/replay/event_log.h.
+
+    event_log.py extract console.log -o session.bin
+    event_log.py show session.bin
+
+`extract` takes a console log containing the output of
+`dongle_screen record dump` and writes the binary event log, which is
+replayed on native_sim with CONFIG_DONGLE_SCREEN_EVENT_REPLAY_LOG.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+MAGIC = b"DSEV"
+VERSION = 1
+HEADER = struct.Struct("<4sBBH")
+RECORD = struct.Struct("<HBBH")
+TYPES = ["keycode", "layer", "wpm", "endpoint", "battery"]
+
+
+def extract(log_path):
+    with open(log_path, encoding="utf-8", errors="replace") as f:
+        lines = f.read().splitlines()
+
+    start = next((i for i, l in enumerate(lines) if re.search(r"event log \d+ bytes", l)), None)
+    if start is None:
+        sys.exit(f"{log_path}: no 'dongle_screen record dump' output found")
+    size = int(re.search(r"event log (\d+) bytes", lines[start]).group(1))
+
+    data = bytearray()
+    for line in lines[start + 1:]:
+        line = line.strip()
+        if "end of event log" in line:
+            break
+        if re.fullmatch(r"[0-9a-fA-F]+", line):
+            data += bytes.fromhex(line)
+    if len(data) != size:
+        sys.exit(f"{log_path}: expected {size} bytes, found {len(data)}")
+    return bytes(data)
+
+
+def parse(data, path):
+    if len(data) < HEADER.size:
+        sys.exit(f"{path}: too short for an event log")
+    magic, version, record_size, count = HEADER.unpack_from(data)
+    if magic != MAGIC or version != VERSION or record_size != RECORD.size:
+        sys.exit(f"{path}: not a version {VERSION} event log")
+    if len(data) < HEADER.size + count * RECORD.size:
+        sys.exit(f"{path}: truncated, {count} records announced")
+    return [RECORD.unpack_from(data, HEADER.size + i * RECORD.size) for i in range(count)]
+
+
+def show(path):
+    with open(path, "rb") as f:
+        records = parse(f.read(), path)
+
+    t = 0
+    for delta, kind, arg0, arg1 in records:
+        t += delta
+        name = TYPES[kind] if kind < len(TYPES) else f"type{kind}"
+        if kind == 0:
+            detail = f"page 0x{arg0 & 0x7f:02x} key 0x{arg1:02x} {'down' if arg0 & 0x80 else 'up'}"
+        elif kind == 1:
+            detail = f"layer {arg0} {'on' if arg1 else 'off'}"
+        elif kind == 2:
+            detail = f"{arg1} wpm"
+        elif kind == 3:
+            detail = f"transport {arg0} profile {arg1}"
+        elif kind == 4:
+            detail = f"source {arg0} {arg1}%"
+        else:
+            detail = f"{arg0} {arg1}"
+        print(f"{t / 1000:10.3f}s  {name:<9}{detail}")
+    print(f"{len(records)} events over {t / 1000:.1f}s")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="cmd", required=True)
+
+    p = sub.add_parser("extract", help="console log to binary event log")
+    p.add_argument("log")
+    p.add_argument("-o", "--output", required=True)
+
+    p = sub.add_parser("show", help="print the events of a binary event log")
+    p.add_argument("file")
+
+    args = parser.parse_args()
+    if args.cmd == "extract":
+        data = extract(args.log)
+        parse(data, args.log)
+        with open(args.output, "wb") as f:
+            f.write(data)
+    else:
+        show(args.file)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 The ZMK Contributors
+#
+# SPDX-License-Identifier: MIT
+
+"""
+Per-font and per-widget flash/RAM usage from the linker map of a build.
+
+    flash_report.py build/zephyr/zephyr.map
+
+Run through the dongle_screen_flash_report build target:
+
+    west build -t dongle_screen_flash_report
+"""
+
+import argparse
+import os
+import re
+import sys
+from collections import defaultdict
+
+HEX = r"0x([0-9a-fA-F]+)"
+MEMORY_RE = re.compile(rf"^(\S+)\s+{HEX}\s+{HEX}")
+OUTPUT_RE = re.compile(rf"^([^\s*]\S*)\s+{HEX}\s+{HEX}(?:\s+load address {HEX})?")
+INPUT_RE = re.compile(rf"^ (\.\S+|COMMON)\s+{HEX}\s+{HEX}\s+(\S.*)$")
+WRAPPED_RE = re.compile(rf"^\s+{HEX}\s+{HEX}(?:\s+(\S.*))?$")
+NAME_ONLY_RE = re.compile(r"^( ?)(\.?[^\s*]\S*)$")
+
+FONT_RE = re.compile(r"^(nerd_\d+|lv_font_\w+|\w+_icons)$")
+WIDGET_RE = re.compile(r"^(\w+_status|icon_row)$")
+
+
+class Region:
+    def __init__(self, name, origin, length):
+        self.name = name
+        self.origin = origin
+        self.length = length
+
+    def contains(self, addr):
+        return self.origin <= addr < self.origin + self.length
+
+    @property
+    def is_flash(self):
+        return "FLASH" in self.name or "ROM" in self.name
+
+    @property
+    def is_ram(self):
+        return "RAM" in self.name
+
+
+def object_name(path):
+    """libfoo.a(nerd_20.c.obj) and dir/nerd_20.c.obj both map to nerd_20"""
+    m = re.search(r"\(([^)]+)\)$", path)
+    name = os.path.basename(m.group(1) if m else path)
+    return re.sub(r"(\.c|\.cpp|\.S)?\.(obj|o)$", "", name)
+
+
+def parse(path):
+    regions = []
+    usage = defaultdict(lambda: [0, 0])  # object -> [flash, ram]
+    flash_total = 0
+    section = None  # (in flash, in ram) of the current output section
+    pending = None  # (is output section, name) waiting for its wrapped line
+    in_memory = False
+    in_map = False
+
+    def region_of(addr):
+        return next((r for r in regions if r.contains(addr)), None)
+
+    def enter_output(vma, lma):
+        nonlocal section
+        vma_region = region_of(vma)
+        lma_region = region_of(lma) if lma is not None else vma_region
+        section = (bool(lma_region and lma_region.is_flash),
+                   bool(vma_region and vma_region.is_ram))
+
+    def add_input(size, obj):
+        nonlocal flash_total
+        if section is None or size == 0:
+            return
+        in_flash, in_ram = section
+        entry = usage[object_name(obj)]
+        if in_flash:
+            entry[0] += size
+            flash_total += size
+        if in_ram:
+            entry[1] += size
+
+    with open(path, encoding="utf-8", errors="replace") as f:
+        for line in f:
+            line = line.rstrip("\n")
+
+            if line.startswith("Memory Configuration"):
+                in_memory = True
+                continue
+            if line.startswith("Linker script and memory map"):
+                in_memory = False
+                in_map = True
+                continue
+            if in_memory:
+                m = MEMORY_RE.match(line)
+                if m and m.group(1) not in ("Name", "*default*"):
+                    regions.append(Region(m.group(1), int(m.group(2), 16), int(m.group(3), 16)))
+                continue
+            if not in_map:
+                continue
+
+            if pending:
+                is_output, _ = pending
+                pending = None
+                m = WRAPPED_RE.match(line)
+                if m:
+                    if is_output:
+                        lma = m.group(3)
+                        lma = int(lma[len("load address 0x"):], 16) \
+                            if lma and lma.startswith("load address 0x") else None
+                        enter_output(int(m.group(1), 16), lma)
+                    elif m.group(3):
+                        add_input(int(m.group(2), 16), m.group(3))
+                    continue
+
+            m = INPUT_RE.match(line)
+            if m:
+                add_input(int(m.group(3), 16), m.group(4))
+                continue
+            m = OUTPUT_RE.match(line)
+            if m:
+                lma = int(m.group(4), 16) if m.group(4) else None
+                enter_output(int(m.group(2), 16), lma)
+                continue
+            m = NAME_ONLY_RE.match(line)
+            if m:
+                pending = (m.group(1) == "", m.group(2))
+
+    return regions, usage, flash_total
+
+
+def print_group(title, rows):
+    print(f"{title:<32}{'flash':>10}{'ram':>10}")
+    total = [0, 0]
+    for name, (flash, ram) in sorted(rows, key=lambda r: -r[1][0]):
+        print(f"  {name:<30}{flash:>10}{ram:>10}")
+        total[0] += flash
+        total[1] += ram
+    print(f"  {'total':<30}{total[0]:>10}{total[1]:>10}")
+    print()
+    return total
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("map", help="linker map file (zephyr.map)")
+    args = parser.parse_args()
+
+    regions, usage, flash_total = parse(args.map)
+    if not usage:
+        sys.exit(f"{args.map}: no input sections found")
+
+    fonts = print_group("Fonts and icons", [(n, u) for n, u in usage.items() if FONT_RE.match(n)])
+    print_group("Widgets", [(n, u) for n, u in usage.items() if WIDGET_RE.match(n)])
+
+    flash = next((r for r in regions if r.is_flash), None)
+    if flash:
+        print(f"Image flash {flash_total} of {flash.length} bytes "
+              f"({100 * flash_total / flash.length:.1f}%), "
+              f"{flash.length - flash_total} bytes free")
+    if flash_total:
+        print(f"Fonts take {100 * fonts[0] / flash_total:.1f}% of the image")
+
+
+if __name__ == "__main__":
+    main()
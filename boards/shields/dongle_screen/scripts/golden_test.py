@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 The ZMK Contributors
+#
+# SPDX-License-Identifier: MIT
+
+"""
+Golden image test of the widgets on native_sim with
+CONFIG_DONGLE_SCREEN_GOLDEN_TEST, see src/test/golden.c.
+
+Run one built test (also the dongle_screen_golden_test build target):
+
+    golden_test.py run build/zephyr/zephyr.exe --golden tests/widgets/golden
+
+Build the test with the config in tests/widgets and run it:
+
+    golden_test.py build --zmk-app /workspaces/zmk/app \\
+        --module /workspaces/zmk-modules/zmk-dongle-screen [-- extra cmake arguments]
+
+Every step's panel image is compared with <golden>/<step>.pbm and the bytes
+panel_flush sent for it with <golden>/transitions.json. A step that sends
+more bytes than recorded fails, one that sends fewer is reported so the
+cheaper count can be recorded. --update writes the images and counts of
+this run as the new goldens, --diff-dir the differing pixels of failed steps.
+Without recorded goldens the check fails, the first run must be --update.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+from pbm_diff import read_pbm, write_pbm
+
+PREFIX = "dongle_screen_golden "
+DONE = "dongle_screen_golden_done "
+TRANSITIONS = "transitions.json"
+COUNTS = ("pixels", "bytes_changed", "bytes_written", "flushed")
+
+
+def run_exe(exe, timeout):
+    """Run a test build and return its steps and summary"""
+    try:
+        proc = subprocess.run([exe, f"-stop_at={timeout}"], capture_output=True, text=True,
+                              timeout=timeout + 30)
+    except subprocess.TimeoutExpired:
+        sys.exit(f"{exe}: timeout")
+
+    steps = []
+    done = None
+    for line in proc.stdout.splitlines():
+        i = line.find(PREFIX)
+        if i >= 0:
+            steps.append(json.loads(line[i + len(PREFIX):]))
+            continue
+        i = line.find(DONE)
+        if i >= 0:
+            done = json.loads(line[i + len(DONE):])
+    if done is None:
+        sys.exit(f"{exe}: test did not finish, exit code {proc.returncode}")
+    return steps, done
+
+
+def decode_image(step):
+    width, height = step["width"], step["height"]
+    data = bytes.fromhex(step["image"])
+    stride = (width + 7) // 8
+    return [[bool(data[y * stride + x // 8] & (0x80 >> (x % 8))) for x in range(width)]
+            for y in range(height)]
+
+
+def check(steps, golden_dir, diff_dir):
+    path = os.path.join(golden_dir, TRANSITIONS)
+    transitions = {}
+    if os.path.exists(path):
+        with open(path, encoding="utf-8") as f:
+            transitions = json.load(f)
+
+    failed = 0
+    for step in steps:
+        name = step["step"]
+        problems = []
+        if step["error"]:
+            problems.append(step["error"])
+
+        golden_path = os.path.join(golden_dir, f"{name}.pbm")
+        if not os.path.exists(golden_path):
+            problems.append("no golden image, record it with --update")
+        else:
+            width, height, golden = read_pbm(golden_path)
+            image = decode_image(step)
+            if (width, height) != (step["width"], step["height"]):
+                problems.append(f"size {step['width']}x{step['height']}, golden {width}x{height}")
+            else:
+                diff = [[golden[y][x] != image[y][x] for x in range(width)]
+                        for y in range(height)]
+                count = sum(map(sum, diff))
+                if count:
+                    problems.append(f"{count} pixels differ from the golden image")
+                    if diff_dir:
+                        os.makedirs(diff_dir, exist_ok=True)
+                        write_pbm(os.path.join(diff_dir, f"{name}.pbm"), width, height, diff)
+
+        expected = transitions.get(name)
+        if expected is None:
+            problems.append("no recorded transition, record it with --update")
+        elif step["flushed"] > expected["flushed"]:
+            problems.append(f"flushed {step['flushed']} bytes, golden {expected['flushed']}")
+        elif step["flushed"] < expected["flushed"]:
+            print(f"{name:<28} flushed {step['flushed']} bytes, golden {expected['flushed']}: "
+                  "cheaper, record it with --update")
+
+        counts = " ".join(f"{k}={step[k]}" for k in COUNTS)
+        if problems:
+            failed += 1
+            print(f"{name:<28} FAIL {counts}: {'; '.join(problems)}")
+        else:
+            print(f"{name:<28} ok   {counts}")
+
+    missing = set(transitions) - {s["step"] for s in steps}
+    for name in sorted(missing):
+        print(f"{name:<28} not run by this build")
+    return failed
+
+
+def update(steps, golden_dir):
+    os.makedirs(golden_dir, exist_ok=True)
+    transitions = {}
+    for step in steps:
+        write_pbm(os.path.join(golden_dir, f"{step['step']}.pbm"), step["width"],
+                  step["height"], decode_image(step))
+        transitions[step["step"]] = {k: step[k] for k in COUNTS}
+    with open(os.path.join(golden_dir, TRANSITIONS), "w", encoding="utf-8") as f:
+        json.dump(transitions, f, indent=2)
+        f.write("\n")
+    print(f"recorded {len(steps)} steps in {golden_dir}")
+
+
+def build(args):
+    build_dir = args.build_dir
+    cmd = ["west", "build", "-p", "-s", args.zmk_app, "-d", build_dir, "-b", args.board,
+           "--", "-DSHIELD=dongle_screen", f"-DZMK_EXTRA_MODULES={args.module}",
+           f"-DZMK_CONFIG={os.path.join(args.module, 'tests', 'widgets')}"]
+    cmd += args.cmake_args
+
+    proc = subprocess.run(cmd, capture_output=True, text=True)
+    if proc.returncode != 0:
+        sys.stderr.write(proc.stdout[-2000:] + proc.stderr[-2000:])
+        sys.exit("build failed")
+    return os.path.join(build_dir, "zephyr", "zephyr.exe")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="cmd", required=True)
+
+    p = sub.add_parser("run", help="run one test build")
+    p.add_argument("exe")
+
+    p = sub.add_parser("build", help="build the test config and run it")
+    p.add_argument("--zmk-app", required=True)
+    p.add_argument("--module", required=True)
+    p.add_argument("--board", default="native_sim/native/64")
+    p.add_argument("--build-dir", default="build/dongle_screen_golden_test")
+    p.add_argument("cmake_args", nargs="*")
+
+    for p in sub.choices.values():
+        p.add_argument("--golden", help="golden directory, tests/widgets/golden by default")
+        p.add_argument("--update", action="store_true", help="record this run as the goldens")
+        p.add_argument("--diff-dir", help="write the differing pixels of failed steps here")
+        p.add_argument("--timeout", type=int, default=60, help="simulated seconds")
+
+    args = parser.parse_args()
+    module = getattr(args, "module", None) or os.path.join(os.path.dirname(__file__), "..",
+                                                           "..", "..", "..")
+    golden_dir = args.golden or os.path.join(module, "tests", "widgets", "golden")
+    exe = build(args) if args.cmd == "build" else args.exe
+
+    steps, done = run_exe(exe, args.timeout)
+    if args.update:
+        if done["failures"]:
+            sys.exit(f"{done['failures']} steps failed their own checks, not recording")
+        update(steps, golden_dir)
+        return
+
+    if not os.path.exists(os.path.join(golden_dir, TRANSITIONS)):
+        sys.exit(f"no goldens recorded in {golden_dir}, record them with --update and "
+                 "commit them before relying on this test")
+    failed = check(steps, golden_dir, args.diff_dir)
+    print(f"{len(steps) - failed} of {len(steps)} steps passed")
+    if failed:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 The ZMK Contributors
+#
+# SPDX-License-Identifier: MIT
+
+"""
+Records the LVGL heap budgets of the status screen in Kconfig.heap from a
+benchmark build with every widget active (CONFIG_DONGLE_SCREEN_BENCHMARK on
+native_sim, which is 32-bit like the dongles):
+
+    heap_budget.py record build/zephyr/zephyr.exe -o Kconfig.heap
+
+The dongle_screen_heap_record build target runs this on the current build.
+Every widget's budget is what it allocated at init. The base budget is the
+peak pool use after the first full frame, including the sys_heap bookkeeping,
+minus the widgets. Kconfig.heap defines the budgets and, for every widget
+selection, the LV_Z_MEM_POOL_SIZE default of CONFIG_DONGLE_SCREEN_ZERO_HEAP.
+"""
+
+import argparse
+import itertools
+import sys
+
+from benchmark import run_exe
+
+WIDGETS = ("wpm", "output", "layer", "modifier", "battery")
+
+
+def budgets(report):
+    """Base and per-widget budgets of a benchmark report"""
+    if "error" in report:
+        sys.exit(f"benchmark failed: {report['error']}")
+    missing = [w for w in WIDGETS if not report["config"][w]]
+    if missing:
+        sys.exit(f"record with every widget active, missing: {', '.join(missing)}")
+    if report["pointer_bytes"] != 4:
+        sys.exit(f"record on a 32-bit build, this one has {report['pointer_bytes']} byte pointers")
+    if not report["heap_pool"]:
+        sys.exit("record with CONFIG_LV_Z_MEM_POOL_SYS_HEAP, the only pool with heap stats")
+
+    widgets = {w["name"]: w["heap"] for w in report["widgets"]}
+    base = report["heap_overhead"] + report["heap_peak"] - sum(widgets.values())
+    return base, {w: widgets[w] for w in WIDGETS}
+
+
+def symbol(name):
+    return f"DONGLE_SCREEN_{name.upper()}"
+
+
+def emit(base, widgets):
+    lines = [
+        "# Generated by scripts/heap_budget.py from a 32-bit native_sim benchmark run,",
+        "# do not edit. Record it again after changing what a widget allocates.",
+        "",
+        "config DONGLE_SCREEN_HEAP_RECORDED",
+        "    bool",
+        "    default y",
+        "",
+        "config DONGLE_SCREEN_BASE_HEAP",
+        "    int",
+        f"    default {base}",
+        "    help",
+        "      LVGL pool the display and the screen object take without widgets,",
+        "      including the sys_heap bookkeeping and the first frame.",
+    ]
+    for name, heap in widgets.items():
+        lines += [
+            "",
+            f"config {symbol(name)}_HEAP",
+            "    int",
+            f"    default {heap}",
+        ]
+
+    lines += ["", "if DONGLE_SCREEN_ZERO_HEAP", "", "config LV_Z_MEM_POOL_SIZE"]
+    # Kconfig cannot add symbols, so every widget selection gets its own sum
+    for active in itertools.product((True, False), repeat=len(widgets)):
+        total = base + sum(heap for on, heap in zip(active, widgets.values()) if on)
+        cond = " && ".join(("" if on else "!") + symbol(name) + "_ACTIVE"
+                           for on, name in zip(active, widgets))
+        lines.append(f"    default {total} if {cond}")
+    lines += ["", "endif"]
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="cmd", required=True)
+    p = sub.add_parser("record", help="record the budgets of a benchmark build")
+    p.add_argument("exe")
+    p.add_argument("-o", "--output", required=True, help="Kconfig.heap to write")
+    p.add_argument("--timeout", type=int, default=30, help="simulated seconds")
+    args = parser.parse_args()
+
+    base, widgets = budgets(run_exe(args.exe, args.timeout))
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(emit(base, widgets))
+    print(f"base {base} " + " ".join(f"{k} {v}" for k, v in widgets.items()) +
+          f", all widgets {base + sum(widgets.values())} bytes")
+
+
+if __name__ == "__main__":
+    main()
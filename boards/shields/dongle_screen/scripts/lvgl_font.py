@@ -0,0 +1,661 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 The ZMK Contributors
+#
+# SPDX-License-Identifier: MIT
+
+"""
+Helpers for the lv_font_conv generated fonts in src/fonts.
+
+The fonts are parsed back into glyph lists and written out again in the same
+layout lv_font_conv produces, so they can be post-processed without the
+original TTF:
+
+    lvgl_font.py to-1bpp nerd_20.c -o nerd_20.c
+    lvgl_font.py subset nerd_20.c --sources wpm_status.c --dts zephyr.dts -o nerd_20.c
+    lvgl_font.py atlas icons.h WPM --font nerd_20.c --fallback lv_font_montserrat_20.c -o wpm_icons.c
+"""
+
+import argparse
+import re
+import sys
+from dataclasses import dataclass, field, replace
+from typing import List, Optional
+
+
+@dataclass
+class Glyph:
+    codepoint: int
+    bitmap: bytes
+    adv_w: int
+    box_w: int
+    box_h: int
+    ofs_x: int
+    ofs_y: int
+
+
+@dataclass
+class Font:
+    name: str
+    size: int
+    bpp: int
+    opts: str
+    line_height: int
+    base_line: int
+    underline_position: int
+    underline_thickness: int
+    fallback: Optional[str]
+    glyphs: List[Glyph] = field(default_factory=list)
+    # How the glyphs were changed after lv_font_conv wrote them with the Opts
+    converted: Optional[str] = None
+
+    def glyph(self, codepoint):
+        for g in self.glyphs:
+            if g.codepoint == codepoint:
+                return g
+        return None
+
+    def pixels(self, glyph):
+        """Returns the glyph as rows of coverage values in 0..(2^bpp - 1)."""
+        mask = (1 << self.bpp) - 1
+        bits = int.from_bytes(glyph.bitmap, "big") if glyph.bitmap else 0
+        total = len(glyph.bitmap) * 8
+        rows = []
+        for y in range(glyph.box_h):
+            row = []
+            for x in range(glyph.box_w):
+                pos = (y * glyph.box_w + x + 1) * self.bpp
+                row.append((bits >> (total - pos)) & mask)
+            rows.append(row)
+        return rows
+
+
+def _int(pattern, text, default=None):
+    m = re.search(pattern, text)
+    if m is None:
+        if default is None:
+            raise ValueError(f"pattern not found: {pattern}")
+        return default
+    return int(m.group(1))
+
+
+def _hex_list(text):
+    return [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", text)]
+
+
+def parse(path):
+    with open(path, encoding="utf-8") as f:
+        src = f.read()
+
+    name = re.search(r"const lv_font_t (\w+) = \{", src).group(1)
+    opts = re.search(r"\* Opts: (.*)", src).group(1).strip()
+    converted = re.search(r"\* Converted: (.*)", src)
+    fallback = re.search(r"\.fallback = &(\w+),", src)
+
+    font = Font(
+        name=name,
+        size=_int(r"\* Size: (\d+) px", src),
+        bpp=_int(r"\.bpp = (\d+),", src),
+        opts=opts,
+        line_height=_int(r"\.line_height = (-?\d+),", src),
+        base_line=_int(r"\.base_line = (-?\d+),", src),
+        underline_position=_int(r"\.underline_position = (-?\d+),", src, 0),
+        underline_thickness=_int(r"\.underline_thickness = (-?\d+),", src, 0),
+        fallback=fallback.group(1) if fallback else None,
+        converted=converted.group(1).strip() if converted else None,
+    )
+
+    bitmap_src = re.search(r"glyph_bitmap\[\] = \{(.*?)\n\};", src, re.S).group(1)
+    bitmap_src = re.sub(r"/\*.*?\*/", "", bitmap_src, flags=re.S)
+    bitmap = bytes(_hex_list(bitmap_src))
+
+    dsc_src = re.search(r"glyph_dsc\[\] = \{(.*?)\n\};", src, re.S).group(1)
+    dscs = [
+        tuple(int(v) for v in m)
+        for m in re.findall(
+            r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), "
+            r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}",
+            dsc_src,
+        )
+    ]
+
+    lists = {
+        m.group(1): _hex_list(m.group(2))
+        for m in re.finditer(r"static const uint\d+_t (\w+)\[\] = \{(.*?)\};", src, re.S)
+    }
+
+    ids = {}
+    for m in re.finditer(r"\{\s*\.range_start = (\d+), \.range_length = (\d+), "
+                         r"\.glyph_id_start = (\d+),\s*\.unicode_list = (\w+), "
+                         r"\.glyph_id_ofs_list = (\w+), \.list_length = (\d+), "
+                         r"\.type = (\w+)\s*\}", src, re.S):
+        start, length, id_start = int(m.group(1)), int(m.group(2)), int(m.group(3))
+        unicode_list, ofs_list, cmap_type = m.group(4), m.group(5), m.group(7)
+        if cmap_type == "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY":
+            for i in range(length):
+                ids[id_start + i] = start + i
+        elif cmap_type == "LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL":
+            for i, ofs in enumerate(lists[ofs_list]):
+                if ofs or i == 0:
+                    ids[id_start + ofs] = start + i
+        elif cmap_type == "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY":
+            for i, ofs in enumerate(lists[unicode_list]):
+                ids[id_start + i] = start + ofs
+        else:
+            for ofs, gid in zip(lists[unicode_list], lists[ofs_list]):
+                ids[id_start + gid] = start + ofs
+
+    for gid in range(1, len(dscs)):
+        index, adv_w, box_w, box_h, ofs_x, ofs_y = dscs[gid]
+        size = (box_w * box_h * font.bpp + 7) // 8
+        font.glyphs.append(Glyph(ids[gid], bitmap[index:index + size],
+                                 adv_w, box_w, box_h, ofs_x, ofs_y))
+
+    return font
+
+
+def _pack(rows, bpp):
+    bits = 0
+    count = 0
+    for row in rows:
+        for px in row:
+            bits = (bits << bpp) | px
+            count += bpp
+    pad = (8 - count % 8) % 8
+    return (bits << pad).to_bytes((count + pad) // 8, "big") if count else b""
+
+
+def convert_bpp(font, bpp):
+    """Requantizes the glyph coverage, 1bpp keeps pixels with >= 50% coverage."""
+    src_max = (1 << font.bpp) - 1
+    dst_max = (1 << bpp) - 1
+    glyphs = []
+    for g in font.glyphs:
+        rows = [[(px * dst_max + src_max // 2) // src_max if bpp > 1 else int(px * 2 > src_max)
+                 for px in row] for row in font.pixels(g)]
+        glyphs.append(replace(g, bitmap=_pack(rows, bpp)))
+
+    # The Opts stay those of the source font, the header names the conversion
+    converted = (f"lvgl_font.py to-{bpp}bpp from the --bpp {font.bpp} output, "
+                 + ("coverage >= 50% kept, no hinting" if bpp == 1 else "coverage rescaled"))
+    return replace(font, bpp=bpp, glyphs=glyphs, converted=converted)
+
+
+def _ranges(codes):
+    ranges = []
+    for c in sorted(set(codes)):
+        if ranges and ranges[-1][1] == c - 1:
+            ranges[-1][1] = c
+        else:
+            ranges.append([c, c])
+    return ",".join(f"{a}" if a == b else f"{a}-{b}" for a, b in ranges)
+
+
+def subset(font, codepoints):
+    """Keeps only the glyphs of codepoints, returns the font and the missing codepoints."""
+    have = {g.codepoint for g in font.glyphs}
+    missing = sorted(set(codepoints) - have)
+    glyphs = [g for g in font.glyphs if g.codepoint in codepoints]
+    opts = re.sub(r"--range \S+", f"--range {_ranges(codepoints)}", font.opts)
+    return replace(font, opts=opts, glyphs=glyphs), missing
+
+
+def _string_literals(src):
+    src = re.sub(r"/\*.*?\*/", "", src, flags=re.S)
+    src = re.sub(r"//[^\n]*", "", src)
+    return re.findall(r'"((?:[^"\\\n]|\\.)*)"', src)
+
+
+_COND_RE = re.compile(r"^\s*(\w+)\s*(<=|>=|==|!=|<|>)\s*(\d+)\s*$")
+_OPS = {"<": int.__lt__, "<=": int.__le__, ">": int.__gt__, ">=": int.__ge__,
+        "==": int.__eq__, "!=": int.__ne__}
+
+
+def _eval_cond(cond, defines):
+    """Evaluates `NAME op N` against defines, None if it can't be decided here."""
+    m = _COND_RE.match(cond)
+    if not m or m.group(1) not in defines:
+        return None
+    return _OPS[m.group(2)](defines[m.group(1)], int(m.group(3)))
+
+
+def _strip_inactive(src, defines):
+    """
+    Drops the #if/#elif/#else branches that the given defines rule out.
+    Conditions on anything else keep all of their branches.
+    """
+    out = []
+    stack = []  # [parent active, known chain, branch taken, active]
+    active = True
+    for line in src.splitlines():
+        m = re.match(r"\s*#\s*(if|ifdef|ifndef|elif|else|endif)\b(.*)", line)
+        if not m:
+            if active:
+                out.append(line)
+            continue
+        kind, cond = m.group(1), m.group(2).split("//")[0].strip()
+        if kind in ("if", "ifdef", "ifndef"):
+            value = _eval_cond(cond, defines) if kind == "if" else None
+            frame = [active, value is not None, bool(value), active and value is not False]
+            stack.append(frame)
+        elif not stack:
+            continue
+        elif kind == "elif":
+            frame = stack[-1]
+            value = _eval_cond(cond, defines) if frame[1] else None
+            frame[1] = value is not None
+            take = value is not False and not (frame[1] and frame[2])
+            frame[2] = frame[2] or bool(value)
+            frame[3] = frame[0] and take
+        elif kind == "else":
+            frame = stack[-1]
+            frame[3] = frame[0] and not (frame[1] and frame[2])
+        else:
+            stack.pop()
+            active = stack[-1][3] if stack else True
+            continue
+        active = stack[-1][3]
+    return "\n".join(out)
+
+
+def scan_codepoints(sources=(), dts=None, defines=None):
+    """
+    Collects the non-ASCII characters of the string literals in the C sources
+    and of the layer display names in a devicetree. ASCII text is rendered by
+    the Montserrat fallback, so only the icons need to be in the nerd fonts.
+    """
+    found = {}
+    for path in sources:
+        with open(path, encoding="utf-8") as f:
+            for text in _string_literals(_strip_inactive(f.read(), defines or {})):
+                for c in text:
+                    found.setdefault(ord(c), path)
+    if dts:
+        with open(dts, encoding="utf-8") as f:
+            for name in re.findall(r'display-name = "((?:[^"\\]|\\.)*)";', f.read()):
+                for c in name:
+                    found.setdefault(ord(c), f"{dts} ({name})")
+    return {cp: where for cp, where in found.items() if cp >= 0x80}
+
+
+def parse_icons(path, name):
+    """Returns the (id, symbol, small symbol) entries of the <name>_ICONS(X) list."""
+    with open(path, encoding="utf-8") as f:
+        src = f.read()
+    m = re.search(rf"#define {name}_ICONS\(X\)((?:.*\\\n)*.*)", src)
+    if m is None:
+        raise ValueError(f"{path}: no {name}_ICONS(X) list")
+    body = re.sub(r"/\*.*?\*/", "", m.group(1), flags=re.S)
+    return re.findall(r'X\((\w+),\s*"([^"]*)",\s*"([^"]*)"\)', body)
+
+
+def render_text(text, font, fallback=None, letter_space=1):
+    """
+    Lays out text like an lv_label on one line and returns the 1bpp rows,
+    glyphs missing from font are taken from fallback.
+    """
+    placed = []
+    pen = 0
+    for i, c in enumerate(text):
+        src = font if font.glyph(ord(c)) else fallback
+        g = src.glyph(ord(c)) if src else None
+        if g is None:
+            raise KeyError(ord(c))
+        if i:
+            pen += letter_space
+        placed.append((src, g, pen))
+        pen += (g.adv_w + 8) // 16
+
+    top = font.line_height - font.base_line
+    rows = [[0] * pen for _ in range(font.line_height)]
+    for src, g, x0 in placed:
+        threshold = (1 << src.bpp) - 1
+        for y, row in enumerate(src.pixels(g)):
+            py = top - g.ofs_y - g.box_h + y
+            for x, px in enumerate(row):
+                px_x = x0 + g.ofs_x + x
+                if 0 <= py < len(rows) and 0 <= px_x < pen and px * 2 > threshold:
+                    rows[py][px_x] = 1
+    return rows
+
+
+def emit_atlas(name, entries, images):
+    """
+    Writes the images as an array of A1 lv_image_dsc_t indexed by the ids of
+    the icon list. All images share the rows that carry ink in any of them,
+    so the symbols keep a common baseline.
+    """
+    inked = [y for rows in images for y, row in enumerate(rows) if any(row)]
+    y0, y1 = (min(inked), max(inked) + 1) if inked else (0, 0)
+
+    maps = []
+    dscs = []
+    offset = 0
+    for (ident, symbol), rows in zip(entries, images):
+        rows = rows[y0:y1]
+        width = len(rows[0]) if rows else 0
+        stride = (width + 7) // 8
+        data = b"".join(_pack([row], 1) for row in rows) if width else b""
+        maps.append(f"    /* {ident} \"{symbol}\" {width}x{len(rows)} */\n" +
+                    (_bytes_block(data) + "," if data else ""))
+        dscs.append(f"    [{ident}] = {{\n"
+                    f"        .header = {{.magic = LV_IMAGE_HEADER_MAGIC, .cf = LV_COLOR_FORMAT_A1,\n"
+                    f"                   .w = {width}, .h = {len(rows)}, .stride = {stride}}},\n"
+                    f"        .data_size = {len(data)},\n"
+                    f"        .data = &{name}_map[{offset}],\n"
+                    f"    }},")
+        offset += len(data)
+
+    maps_src = "\n".join(maps)
+    dscs_src = "\n".join(dscs)
+    return f"""/*
+ * Generated by scripts/lvgl_font.py atlas from include/icons.h, do not edit.
+ */
+
+#include <lvgl.h>
+#include <icons.h>
+
+static const uint8_t {name}_map[] = {{
+{maps_src}
+}};
+
+const lv_image_dsc_t {name}[] = {{
+{dscs_src}
+}};
+"""
+
+
+def _cmap_cost(codes):
+    """Size estimates lv_font_conv uses to pick the cmap subtable type."""
+    span = codes[-1] - codes[0] + 1
+    options = []
+    if span == len(codes):
+        options.append((16, "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY"))
+    if span <= 256:
+        options.append((16 + span, "LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL"))
+    if span <= 65536:
+        options.append((16 + len(codes) * 2, "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY"))
+    return min(options) if options else (None, None)
+
+
+def _split_cmaps(codes):
+    best = [(0, [])]
+    for end in range(1, len(codes) + 1):
+        candidate = None
+        for start in range(end - 1, -1, -1):
+            cost, kind = _cmap_cost(codes[start:end])
+            if cost is None:
+                break
+            total = best[start][0] + cost
+            if candidate is None or total < candidate[0]:
+                candidate = (total, best[start][1] + [(start, end, kind)])
+        best.append(candidate)
+    return best[-1][1]
+
+
+def _bytes_block(data, indent="    "):
+    lines = []
+    for i in range(0, len(data), 8):
+        lines.append(indent + ", ".join(f"0x{b:x}" for b in data[i:i + 8]))
+    return ",\n".join(lines)
+
+
+def _glyph_comment(codepoint):
+    char = chr(codepoint)
+    if char in ('"', "\\"):
+        char = "\\" + char
+    return f'/* U+{codepoint:04X} "{char}" */'
+
+
+def emit(font, guard=None):
+    glyphs = sorted(font.glyphs, key=lambda g: g.codepoint)
+    guard = guard or font.name.upper()
+    fallback_extern = f"extern const lv_font_t {font.fallback};\n" if font.fallback else ""
+    fallback = f"&{font.fallback}" if font.fallback else "NULL"
+
+    bitmap_parts = []
+    dsc_lines = ["    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} "
+                 "/* id = 0 reserved */"]
+    index = 0
+    for g in glyphs:
+        part = f"    {_glyph_comment(g.codepoint)}\n"
+        if g.bitmap:
+            part += _bytes_block(g.bitmap)
+        bitmap_parts.append(part)
+        dsc_lines.append(f"    {{.bitmap_index = {index}, .adv_w = {g.adv_w}, .box_w = {g.box_w}, "
+                         f".box_h = {g.box_h}, .ofs_x = {g.ofs_x}, .ofs_y = {g.ofs_y}}}")
+        index += len(g.bitmap)
+
+    codes = [g.codepoint for g in glyphs]
+    lists = []
+    cmaps = []
+    for n, (start, end, kind) in enumerate(_split_cmaps(codes)):
+        seg = codes[start:end]
+        unicode_list = "NULL"
+        ofs_list = "NULL"
+        list_length = 0
+        if kind == "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY":
+            unicode_list = f"unicode_list_{n}"
+            list_length = len(seg)
+            lists.append(f"static const uint16_t {unicode_list}[] = {{\n"
+                         + _bytes_block([c - seg[0] for c in seg]) + "\n};\n")
+        elif kind == "LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL":
+            ofs_list = f"glyph_id_ofs_list_{n}"
+            list_length = seg[-1] - seg[0] + 1
+            ofs = [0] * list_length
+            for i, c in enumerate(seg):
+                ofs[c - seg[0]] = i
+            lists.append(f"static const uint8_t {ofs_list}[] = {{\n" + _bytes_block(ofs) + "\n};\n")
+        cmaps.append("    {\n"
+                     f"        .range_start = {seg[0]}, .range_length = {seg[-1] - seg[0] + 1}, "
+                     f".glyph_id_start = {start + 1},\n"
+                     f"        .unicode_list = {unicode_list}, .glyph_id_ofs_list = {ofs_list}, "
+                     f".list_length = {list_length}, .type = {kind}\n"
+                     "    }")
+
+    bitmap_src = ",\n\n".join(bitmap_parts)
+    dsc_src = ",\n".join(dsc_lines)
+    lists_src = "\n".join(lists)
+    cmaps_src = ",\n".join(cmaps)
+    converted = f" * Converted: {font.converted}\n" if font.converted else ""
+    line_height = f"{font.line_height},".ljust(13)
+    base_line = f"{font.base_line},".ljust(15)
+
+    return f"""/*******************************************************************************
+ * Size: {font.size} px
+ * Bpp: {font.bpp}
+ * Opts: {font.opts}
+{converted} ******************************************************************************/
+
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+
+
+#ifndef {guard}
+#define {guard} 1
+#endif
+
+#if {guard}
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {{
+{bitmap_src}
+}};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {{
+{dsc_src}
+}};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+{lists_src}
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{{
+{cmaps_src}
+}};
+
+
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+#if LVGL_VERSION_MAJOR == 8
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+#endif
+
+#if LVGL_VERSION_MAJOR >= 8
+static const lv_font_fmt_txt_dsc_t font_dsc = {{
+#else
+static lv_font_fmt_txt_dsc_t font_dsc = {{
+#endif
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = {len(cmaps)},
+    .bpp = {font.bpp},
+    .kern_classes = 0,
+    .bitmap_format = 0,
+#if LVGL_VERSION_MAJOR == 8
+    .cache = &cache
+#endif
+
+}};
+
+{fallback_extern}
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+#if LVGL_VERSION_MAJOR >= 8
+const lv_font_t {font.name} = {{
+#else
+lv_font_t {font.name} = {{
+#endif
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = {line_height}/*The maximum line height required by the font*/
+    .base_line = {base_line}/*Baseline measured from the bottom of the line*/
+#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+#endif
+#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = {font.underline_position},
+    .underline_thickness = {font.underline_thickness},
+#endif
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
+    .fallback = {fallback},
+#endif
+    .user_data = NULL,
+}};
+
+
+
+#endif /*#if {guard}*/
+"""
+
+
+def _write(text, path):
+    if path:
+        with open(path, "w", encoding="utf-8") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+def cmd_to_1bpp(args):
+    _write(emit(convert_bpp(parse(args.font), 1)), args.output)
+
+
+def cmd_subset(args):
+    defines = dict((d.split("=", 1)[0], int(d.split("=", 1)[1])) for d in args.define)
+    used = scan_codepoints(args.sources, args.dts, defines)
+    font, missing = subset(parse(args.font), set(used))
+    if missing:
+        for cp in missing:
+            print(f"{args.font}: U+{cp:04X} \"{chr(cp)}\" used by {used[cp]} is not in the font",
+                  file=sys.stderr)
+        sys.exit(1)
+    _write(emit(font), args.output)
+
+
+def cmd_atlas(args):
+    font = parse(args.font)
+    fallback = parse(args.fallback) if args.fallback else None
+    entries = []
+    images = []
+    for ident, symbol, small in parse_icons(args.icons, args.list):
+        text = small if args.small else symbol
+        try:
+            images.append(render_text(text, font, fallback))
+        except KeyError as e:
+            fonts = " or ".join(f for f in (args.font, args.fallback) if f)
+            sys.exit(f"{args.icons}: {ident} U+{e.args[0]:04X} is not in {fonts}")
+        entries.append((ident, text))
+    _write(emit_atlas(f"{args.list.lower()}_icons", entries, images), args.output)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p = sub.add_parser("to-1bpp", help="requantize a font to 1 bit per pixel")
+    p.add_argument("font")
+    p.add_argument("-o", "--output")
+    p.set_defaults(func=cmd_to_1bpp)
+
+    p = sub.add_parser("subset", help="keep only the glyphs the given sources use")
+    p.add_argument("font")
+    p.add_argument("--sources", nargs="*", default=[], help="C files to scan for string literals")
+    p.add_argument("--dts", help="devicetree to scan for layer display-name properties")
+    p.add_argument("-D", "--define", action="append", default=[], metavar="NAME=VALUE",
+                   help="integer macro used to skip #if branches while scanning")
+    p.add_argument("-o", "--output")
+    p.set_defaults(func=cmd_subset)
+
+    p = sub.add_parser("atlas", help="render an icon list of icons.h into 1bpp images")
+    p.add_argument("icons", help="header with the <LIST>_ICONS(X) lists")
+    p.add_argument("list", help="name of the list, e.g. OUTPUT")
+    p.add_argument("--font", required=True)
+    p.add_argument("--fallback", help="font for the characters missing from --font")
+    p.add_argument("--small", action="store_true", help="use the small symbols")
+    p.add_argument("-o", "--output")
+    p.set_defaults(func=cmd_atlas)
+
+    args = parser.parse_args()
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()
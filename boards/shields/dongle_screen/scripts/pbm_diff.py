@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 The ZMK Contributors
+#
+# SPDX-License-Identifier: MIT
+
+"""
+Compare a panel capture against a golden image.
+
+    pbm_diff.py golden.pbm capture.pbm [--diff changed.pbm]
+
+Captures come from `dongle_screen panel pbm` on a native_sim build. Shell
+output around the image (prompt, echoed command) is skipped, so a saved
+console log can be passed directly. Exits with 1 if the images differ.
+"""
+
+import argparse
+import sys
+
+
+def read_pbm(path):
+    with open(path, "rb") as f:
+        raw = f.read()
+
+    start = raw.find(b"P1")
+    binary = raw.find(b"P4")
+    if start < 0 and binary < 0:
+        sys.exit(f"{path}: no PBM image found")
+
+    if start < 0 or 0 <= binary < start:
+        return read_p4(path, raw[binary:])
+
+    tokens = []
+    for line in raw[start + 2:].decode("ascii", errors="replace").splitlines():
+        line = line.split("#", 1)[0].strip()
+        if line.startswith("uart:") or line.startswith("dongle_screen"):
+            break
+        tokens.append(line)
+    header = " ".join(tokens).split()
+    width, height = int(header[0]), int(header[1])
+    bits = "".join(header[2:]).replace(" ", "")
+    if len(bits) < width * height:
+        sys.exit(f"{path}: truncated image, {len(bits)} of {width * height} pixels")
+    return width, height, [[bits[y * width + x] == "1" for x in range(width)]
+                           for y in range(height)]
+
+
+def read_p4(path, raw):
+    fields = raw.split(maxsplit=3)
+    width, height = int(fields[1]), int(fields[2])
+    data = fields[3]
+    stride = (width + 7) // 8
+    if len(data) < stride * height:
+        sys.exit(f"{path}: truncated image")
+    return width, height, [[bool(data[y * stride + x // 8] & (0x80 >> (x % 8)))
+                            for x in range(width)] for y in range(height)]
+
+
+def write_pbm(path, width, height, pixels):
+    with open(path, "w", encoding="ascii") as f:
+        f.write(f"P1\n{width} {height}\n")
+        for row in pixels:
+            f.write("".join("1" if p else "0" for p in row) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("golden")
+    parser.add_argument("capture")
+    parser.add_argument("--diff", help="write the differing pixels as PBM")
+    args = parser.parse_args()
+
+    gw, gh, golden = read_pbm(args.golden)
+    cw, ch, capture = read_pbm(args.capture)
+    if (gw, gh) != (cw, ch):
+        print(f"size differs: {gw}x{gh} golden, {cw}x{ch} capture")
+        sys.exit(1)
+
+    diff = [[golden[y][x] != capture[y][x] for x in range(gw)] for y in range(gh)]
+    changed = sum(map(sum, diff))
+    if args.diff:
+        write_pbm(args.diff, gw, gh, diff)
+
+    if changed:
+        rows = [y for y in range(gh) if any(diff[y])]
+        cols = [x for x in range(gw) if any(diff[y][x] for y in range(gh))]
+        print(f"{changed} pixels differ in x {cols[0]}..{cols[-1]}, y {rows[0]}..{rows[-1]}")
+        sys.exit(1)
+    print("identical")
+
+
+if __name__ == "__main__":
+    main()
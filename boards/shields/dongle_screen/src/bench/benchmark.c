@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/sys/mem_stats.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+#include <lvgl.h>
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP)
+#include <lvgl_mem.h>
+#endif
+#include <zmk/display.h>
+
+#include "benchmark.h"
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_SH1106_EMUL) &&                                            \
+    (DT_NODE_HAS_COMPAT(DT_CHOSEN(zephyr_display), sinowealth_sh1106) ||                       \
+     DT_NODE_HAS_COMPAT(DT_CHOSEN(zephyr_display), sinowealth_sh1107))
+#define PANEL_EMUL 1
+#include "../emul/sh1106_emul.h"
+#elif IS_ENABLED(CONFIG_DONGLE_SCREEN_PARTIAL_FLUSH)
+#include "../display/panel_flush.h"
+#endif
+
+#if IS_ENABLED(CONFIG_ARCH_POSIX)
+#include <native_rtc.h>
+#include <posix_board_if.h>
+#endif
+
+/*
+ * Cost of the status screen in the configuration it was built with, printed
+ * as one JSON line prefixed with "dongle_screen_bench " for
+ * scripts/benchmark.py:
+ *
+ * - time and LVGL heap taken by zmk_display_status_screen(), and the pool
+ *   size and sys_heap bookkeeping scripts/heap_budget.py records budgets from
+ * - per widget, the LVGL heap it allocated at init, the time to render and flush it from a blank area and the
+ *   bytes that reach the panel for it, averaged over a number of rounds
+ *
+ * Each round hides the widget, refreshes, shows it again and measures the
+ * second refresh, so every widget is timed drawing all of its pixels.
+ */
+
+#define MAX_WIDGETS 8
+
+struct bench_widget {
+    const char *name;
+    lv_obj_t *obj;
+    uint32_t heap;
+};
+
+static struct bench_widget widgets[MAX_WIDGETS];
+static int widget_count;
+
+static uint32_t init_started_us;
+static uint32_t init_us;
+static size_t heap_before;
+static size_t heap_after;
+
+// native_sim runs in simulated time, where code takes none, so use the host clock there
+static uint32_t now_us(void) {
+#if IS_ENABLED(CONFIG_ARCH_POSIX)
+    return (uint32_t)native_rtc_gettime_us(RTC_CLOCK_REALTIME);
+#else
+    return k_cyc_to_us_floor32(k_cycle_get_32());
+#endif
+}
+
+// Heap figures are only available from the sys_heap backed LVGL pool, 0 otherwise
+static void heap_stats(struct sys_memory_stats *stats) {
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP)
+    lvgl_heap_stats(stats);
+#else
+    *stats = (struct sys_memory_stats){0};
+#endif
+}
+
+static size_t heap_pool(void) {
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP)
+    return CONFIG_LV_Z_MEM_POOL_SIZE;
+#else
+    return 0;
+#endif
+}
+
+static size_t heap_used(void) {
+    struct sys_memory_stats stats;
+    heap_stats(&stats);
+    return stats.allocated_bytes;
+}
+
+static uint32_t panel_bytes(void) {
+#if defined(PANEL_EMUL)
+    struct sh1106_emul_stats stats;
+    sh1106_emul_get_stats(EMUL_DT_GET(DT_CHOSEN(zephyr_display)), &stats);
+    return stats.data_bytes;
+#elif IS_ENABLED(CONFIG_DONGLE_SCREEN_PARTIAL_FLUSH)
+    struct panel_flush_stats stats;
+    panel_flush_get_stats(&stats);
+    return stats.bytes_written;
+#else
+    return 0;
+#endif
+}
+
+void benchmark_screen_begin(void) {
+    heap_before = heap_used();
+    init_started_us = now_us();
+}
+
+void benchmark_add_widget(const char *name, lv_obj_t *obj, uint32_t heap) {
+    if (widget_count < MAX_WIDGETS) {
+        widgets[widget_count++] = (struct bench_widget){.name = name, .obj = obj, .heap = heap};
+    }
+}
+
+static void bench_work_cb(struct k_work *work) {
+    struct sys_memory_stats heap;
+
+    // First full frame, so the rounds only redraw the widget itself
+    lv_refr_now(NULL);
+    heap_stats(&heap);
+
+    printk("dongle_screen_bench {\"config\":{\"wpm\":%d,\"output\":%d,\"layer\":%d,"
+           "\"modifier\":%d,\"battery\":%d,\"flipped\":%d,\"battery_vertical\":%d,"
+           "\"partial_flush\":%d},",
+           IS_ENABLED(CONFIG_DONGLE_SCREEN_WPM_ACTIVE),
+           IS_ENABLED(CONFIG_DONGLE_SCREEN_OUTPUT_ACTIVE),
+           IS_ENABLED(CONFIG_DONGLE_SCREEN_LAYER_ACTIVE),
+           IS_ENABLED(CONFIG_DONGLE_SCREEN_MODIFIER_ACTIVE),
+           IS_ENABLED(CONFIG_DONGLE_SCREEN_BATTERY_ACTIVE),
+           IS_ENABLED(CONFIG_DONGLE_SCREEN_FLIPPED),
+           IS_ENABLED(CONFIG_DONGLE_SCREEN_BATTERY_VERTICAL),
+           IS_ENABLED(CONFIG_DONGLE_SCREEN_PARTIAL_FLUSH));
+    // The pool minus what sys_heap can hand out is its own bookkeeping
+    printk("\"init_us\":%u,\"heap_screen\":%u,\"heap_used\":%u,\"heap_peak\":%u,"
+           "\"heap_pool\":%u,\"heap_overhead\":%u,\"pointer_bytes\":%u,\"widgets\":[",
+           init_us, (uint32_t)(heap_after - heap_before), (uint32_t)heap.allocated_bytes,
+           (uint32_t)heap.max_allocated_bytes, (uint32_t)heap_pool(),
+           (uint32_t)(heap_pool() - heap.free_bytes - heap.allocated_bytes),
+           (uint32_t)sizeof(void *));
+
+    for (int i = 0; i < widget_count; i++) {
+        uint64_t render_us = 0;
+        uint32_t bytes = 0;
+
+        for (int round = 0; round < CONFIG_DONGLE_SCREEN_BENCHMARK_ROUNDS; round++) {
+            lv_obj_add_flag(widgets[i].obj, LV_OBJ_FLAG_HIDDEN);
+            lv_refr_now(NULL);
+
+            lv_obj_remove_flag(widgets[i].obj, LV_OBJ_FLAG_HIDDEN);
+            const uint32_t bytes_before = panel_bytes();
+            const uint32_t start = now_us();
+            lv_refr_now(NULL);
+            render_us += now_us() - start;
+            bytes += panel_bytes() - bytes_before;
+        }
+
+        printk("%s{\"name\":\"%s\",\"heap\":%u,\"render_us\":%u,\"bytes\":%u}",
+               i ? "," : "", widgets[i].name, widgets[i].heap,
+               (uint32_t)(render_us / CONFIG_DONGLE_SCREEN_BENCHMARK_ROUNDS),
+               bytes / CONFIG_DONGLE_SCREEN_BENCHMARK_ROUNDS);
+    }
+    printk("]}\n");
+
+#if IS_ENABLED(CONFIG_ARCH_POSIX)
+    posix_exit(0);
+#endif
+}
+
+static K_WORK_DEFINE(bench_work, bench_work_cb);
+
+void benchmark_screen_end(void) {
+    init_us = now_us() - init_started_us;
+    heap_after = heap_used();
+
+    // Runs after ZMK loaded the screen, on the same queue
+    k_work_submit_to_queue(zmk_display_work_q(), &bench_work);
+}
@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <lvgl.h>
+
+// Around zmk_display_status_screen() to measure its time and LVGL heap use
+void benchmark_screen_begin(void);
+void benchmark_screen_end(void);
+
+// heap is the LVGL heap the widget allocated at init
+void benchmark_add_widget(const char *name, lv_obj_t *obj, uint32_t heap);
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <dt-bindings/zmk/hid_usage_pages.h>
+#include <zmk/display.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/keycode_state_changed.h>
+
+#include "brightness.h"
+#include "screen_power.h"
+#include <util.h>
+
+/*
+ * Brightness is driven through the controller's contrast register, so every
+ * change is a single two byte command and nothing needs to be re-rendered.
+ * The precharge period (`prechargep` in the devicetree) is written by the
+ * display driver at init and never touched here, so it stays the drive
+ * baseline and only the contrast moves.
+ * Fades are a short timed sequence of contrast writes.
+ */
+
+#define FADE_STEPS   8
+#define FADE_STEP_MS (CONFIG_DONGLE_SCREEN_BRIGHTNESS_FADE_MS / FADE_STEPS)
+
+BUILD_ASSERT(CONFIG_DONGLE_SCREEN_MIN_BRIGHTNESS <= CONFIG_DONGLE_SCREEN_DEFAULT_BRIGHTNESS &&
+                 CONFIG_DONGLE_SCREEN_DEFAULT_BRIGHTNESS <= CONFIG_DONGLE_SCREEN_MAX_BRIGHTNESS,
+             "Default brightness must be between min and max brightness");
+
+static const struct device *display_dev = DEVICE_DT_GET(DISPLAY_NODE);
+
+static uint8_t brightness = CONFIG_DONGLE_SCREEN_DEFAULT_BRIGHTNESS;
+static uint8_t contrast;
+static uint8_t fade_from;
+static uint8_t fade_to;
+static uint8_t fade_step;
+static brightness_fade_done_t fade_done;
+
+static uint8_t percent_to_contrast(uint8_t percent) { return (percent * UINT8_MAX + 50) / 100; }
+
+static void write_contrast(uint8_t value) {
+    if (value == contrast) {
+        return;
+    }
+
+    int err = display_set_contrast(display_dev, value);
+    if (err) {
+        LOG_WRN("Failed to set contrast %d: %d", value, err);
+        return;
+    }
+    contrast = value;
+}
+
+static void fade_work_cb(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(fade_work, fade_work_cb);
+
+static void fade_work_cb(struct k_work *work) {
+    fade_step++;
+    write_contrast(fade_from + ((int)fade_to - fade_from) * fade_step / FADE_STEPS);
+
+    if (fade_step < FADE_STEPS) {
+        k_work_schedule_for_queue(zmk_display_work_q(), &fade_work, K_MSEC(FADE_STEP_MS));
+        return;
+    }
+
+    brightness_fade_done_t done = fade_done;
+    fade_done = NULL;
+    if (done) {
+        done();
+    }
+}
+
+void brightness_fade_to(uint8_t percent, brightness_fade_done_t done) {
+    const uint8_t target = percent_to_contrast(percent);
+
+    k_work_cancel_delayable(&fade_work);
+    fade_done = NULL;
+
+    if (FADE_STEP_MS == 0 || target == contrast) {
+        write_contrast(target);
+        if (done) {
+            done();
+        }
+        return;
+    }
+
+    fade_from = contrast;
+    fade_to = target;
+    fade_step = 0;
+    fade_done = done;
+    k_work_schedule_for_queue(zmk_display_work_q(), &fade_work, K_NO_WAIT);
+}
+
+void brightness_restore(void) { brightness_fade_to(brightness, NULL); }
+
+void brightness_reset(void) {
+    k_work_cancel_delayable(&fade_work);
+    fade_done = NULL;
+    write_contrast(percent_to_contrast(brightness));
+}
+
+uint8_t brightness_get(void) { return brightness; }
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_BRIGHTNESS_KEYBOARD_CONTROL)
+
+static atomic_t pending_steps;
+
+static void brightness_step_work_cb(struct k_work *work) {
+    const int steps = atomic_clear(&pending_steps);
+    const int next = brightness + steps * CONFIG_DONGLE_SCREEN_BRIGHTNESS_STEP;
+
+    brightness = CLAMP(next, CONFIG_DONGLE_SCREEN_MIN_BRIGHTNESS,
+                       CONFIG_DONGLE_SCREEN_MAX_BRIGHTNESS);
+    LOG_DBG("Brightness %d%%", brightness);
+
+    if (screen_power_is_on()) {
+        brightness_restore();
+    }
+}
+
+static K_WORK_DEFINE(brightness_step_work, brightness_step_work_cb);
+
+static int brightness_keycode_cb(const zmk_event_t *eh) {
+    const struct zmk_keycode_state_changed *ev = as_zmk_keycode_state_changed(eh);
+
+    if (ev == NULL || !ev->state || ev->usage_page != HID_USAGE_KEY) {
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+    if (ev->keycode == CONFIG_DONGLE_SCREEN_BRIGHTNESS_UP_KEYCODE) {
+        atomic_inc(&pending_steps);
+    } else if (ev->keycode == CONFIG_DONGLE_SCREEN_BRIGHTNESS_DOWN_KEYCODE) {
+        atomic_dec(&pending_steps);
+    } else {
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+    if (zmk_display_is_initialized()) {
+        k_work_submit_to_queue(zmk_display_work_q(), &brightness_step_work);
+    }
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(dongle_screen_brightness, brightness_keycode_cb);
+ZMK_SUBSCRIPTION(dongle_screen_brightness, zmk_keycode_state_changed);
+
+#endif /* IS_ENABLED(CONFIG_DONGLE_SCREEN_BRIGHTNESS_KEYBOARD_CONTROL) */
+
+int brightness_init(void) {
+    if (!device_is_ready(display_dev)) {
+        return -ENODEV;
+    }
+
+    // Force the first write, the controller's reset contrast is unknown here
+    contrast = ~percent_to_contrast(brightness);
+    brightness_reset();
+    return 0;
+}
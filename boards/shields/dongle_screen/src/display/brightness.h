@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+typedef void (*brightness_fade_done_t)(void);
+
+int brightness_init(void);
+
+/*
+ * Fade the panel to the given brightness in percent (0 = contrast off). The
+ * optional callback runs on the display work queue once the target is
+ * reached and is dropped if another fade replaces this one. Must be called
+ * from the display work queue.
+ */
+void brightness_fade_to(uint8_t percent, brightness_fade_done_t done);
+
+// Fade back to the user brightness, e.g. after waking from idle
+void brightness_restore(void);
+
+// Stop any running fade and jump to the user brightness
+void brightness_reset(void);
+
+uint8_t brightness_get(void);
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+
+#include <lvgl.h>
+#include <zmk/display.h>
+
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP)
+#include <zephyr/sys/sys_heap.h>
+#include <lvgl_mem.h>
+#endif
+
+#include "../widgets/widget_registry.h"
+
+/*
+ * LVGL pool and object statistics for the shell. Nothing is counted while
+ * the screen runs: the pool totals and high-water mark are the sys_heap
+ * runtime stats, and everything else is gathered when a command asks for
+ * it. The gathering runs on the display queue, where LVGL allocates, so it
+ * never races LVGL.
+ */
+
+struct obj_count {
+    uint32_t objs;
+    uint32_t local_styles;
+    uint32_t local_props;
+};
+
+struct display_job {
+    struct k_work work;
+    struct k_sem done;
+    void (*fn)(void *arg);
+    void *arg;
+};
+
+static void display_job_cb(struct k_work *work) {
+    struct display_job *job = CONTAINER_OF(work, struct display_job, work);
+
+    job->fn(job->arg);
+    k_sem_give(&job->done);
+}
+
+static void run_on_display(void (*fn)(void *arg), void *arg) {
+    static struct display_job job;
+
+    k_work_init(&job.work, display_job_cb);
+    k_sem_init(&job.done, 0, 1);
+    job.fn = fn;
+    job.arg = arg;
+    k_work_submit_to_queue(zmk_display_work_q(), &job.work);
+    k_sem_take(&job.done, K_FOREVER);
+}
+
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP)
+static void mem_job(void *arg) { lvgl_heap_stats(arg); }
+#endif
+
+// Only default state selectors are checked, the widgets style no other states
+static const lv_style_selector_t local_selectors[] = {
+    LV_PART_MAIN,     LV_PART_SCROLLBAR, LV_PART_INDICATOR, LV_PART_KNOB,
+    LV_PART_SELECTED, LV_PART_ITEMS,     LV_PART_CURSOR,
+};
+
+static void count_objs(lv_obj_t *obj, struct obj_count *count) {
+    count->objs++;
+    for (int i = 0; i < ARRAY_SIZE(local_selectors); i++) {
+        uint32_t props = 0;
+
+        for (lv_style_prop_t prop = 1; prop < LV_STYLE_LAST_BUILT_IN_PROP; prop++) {
+            lv_style_value_t value;
+
+            if (lv_obj_get_local_style_prop(obj, prop, &value, local_selectors[i]) ==
+                LV_STYLE_RES_FOUND) {
+                props++;
+            }
+        }
+        if (props) {
+            count->local_styles++;
+            count->local_props += props;
+        }
+    }
+
+    const uint32_t children = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < children; i++) {
+        count_objs(lv_obj_get_child(obj, i), count);
+    }
+}
+
+struct objs_report {
+    struct obj_count screen;
+    struct obj_count widgets[8];
+};
+
+static void objs_job(void *arg) {
+    struct objs_report *report = arg;
+    int i = 0;
+
+    count_objs(lv_screen_active(), &report->screen);
+    STRUCT_SECTION_FOREACH(dongle_screen_widget, widget) {
+        if (i == ARRAY_SIZE(report->widgets)) {
+            break;
+        }
+        count_objs(widget->obj(widget->instance), &report->widgets[i++]);
+    }
+}
+
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP)
+static int cmd_mem(const struct shell *sh, size_t argc, char **argv) {
+    struct sys_memory_stats stats;
+
+    run_on_display(mem_job, &stats);
+
+    const size_t total = stats.allocated_bytes + stats.free_bytes;
+    shell_print(sh, "pool:      %u bytes (CONFIG_LV_Z_MEM_POOL_SIZE=%u)", (uint32_t)total,
+                CONFIG_LV_Z_MEM_POOL_SIZE);
+    shell_print(sh, "used:      %u bytes", (uint32_t)stats.allocated_bytes);
+    shell_print(sh, "free:      %u bytes", (uint32_t)stats.free_bytes);
+    shell_print(sh, "peak used: %u bytes", (uint32_t)stats.max_allocated_bytes);
+    return 0;
+}
+#endif
+
+static void print_count(const struct shell *sh, const char *name, const struct obj_count *c) {
+    shell_print(sh, "%-10s %6u %7u %7u", name, c->objs, c->local_styles, c->local_props);
+}
+
+static int cmd_objs(const struct shell *sh, size_t argc, char **argv) {
+    struct objs_report report = {0};
+    int i = 0;
+
+    run_on_display(objs_job, &report);
+
+    shell_print(sh, "%-10s %6s %7s %7s", "widget", "objs", "local", "props");
+    STRUCT_SECTION_FOREACH(dongle_screen_widget, widget) {
+        if (i == ARRAY_SIZE(report.widgets)) {
+            break;
+        }
+        print_count(sh, widget->name, &report.widgets[i++]);
+    }
+    print_count(sh, "screen", &report.screen);
+    return 0;
+}
+
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP)
+SHELL_SUBCMD_ADD((dongle_screen), mem, NULL, "LVGL pool use and peak", cmd_mem, 1,
+                 0);
+#endif
+SHELL_SUBCMD_ADD((dongle_screen), objs, NULL, "LVGL objects and styles per widget", cmd_objs, 1,
+                 0);
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * 8x8 bit matrix transpose used to turn row-major 1bpp data (MSB = leftmost
+ * pixel) into the vertical page bytes of SH1106/SH1107 controllers.
+ *
+ * The block is packed into two 32-bit words and transposed with three
+ * swap stages (Hacker's Delight 7-3), which replaces 64 single-pixel
+ * get/set operations with a dozen shifts and masks.
+ */
+static inline void page_transpose8_words(uint32_t x, uint32_t y, uint8_t cols[8]) {
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    cols[0] = x >> 24;
+    cols[1] = x >> 16;
+    cols[2] = x >> 8;
+    cols[3] = x;
+    cols[4] = y >> 24;
+    cols[5] = y >> 16;
+    cols[6] = y >> 8;
+    cols[7] = y;
+}
+
+/*
+ * cols[j] receives pixel column j of the block with rows[0] in bit 0, which
+ * is the native page layout (top row in the LSB).
+ */
+static inline void page_transpose8(const uint8_t rows[8], uint8_t cols[8]) {
+    const uint32_t x = ((uint32_t)rows[7] << 24) | ((uint32_t)rows[6] << 16) |
+                       ((uint32_t)rows[5] << 8) | rows[4];
+    const uint32_t y = ((uint32_t)rows[3] << 24) | ((uint32_t)rows[2] << 16) |
+                       ((uint32_t)rows[1] << 8) | rows[0];
+
+    page_transpose8_words(x, y, cols);
+}
+
+/*
+ * Same as page_transpose8() but with rows[0] in bit 7, as needed when the
+ * panel is mounted upside down and the page order is reversed.
+ */
+static inline void page_transpose8_msb(const uint8_t rows[8], uint8_t cols[8]) {
+    const uint32_t x = ((uint32_t)rows[0] << 24) | ((uint32_t)rows[1] << 16) |
+                       ((uint32_t)rows[2] << 8) | rows[3];
+    const uint32_t y = ((uint32_t)rows[4] << 24) | ((uint32_t)rows[5] << 16) |
+                       ((uint32_t)rows[6] << 8) | rows[7];
+
+    page_transpose8_words(x, y, cols);
+}
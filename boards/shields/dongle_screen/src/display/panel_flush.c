@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <lvgl.h>
+
+#include "panel_flush.h"
+#include "page_transpose.h"
+#include <util.h>
+
+/*
+ * SH1106/SH1107 controllers store the frame as pages of 8 rows, one byte per
+ * column and page. We keep a shadow of what was last sent to GDDRAM and only
+ * push the column ranges of each page that really changed.
+ */
+#define PAGE_HEIGHT 8
+#define PAGE_COUNT  (DISPLAY_HEIGHT / PAGE_HEIGHT)
+
+// LVGL prefixes I1 buffers with a two entry ARGB8888 palette
+#define I1_PALETTE_SIZE 8
+
+// A new write costs the column/page address commands plus a second I2C
+// transaction, so short unchanged gaps are cheaper to resend than to skip.
+#define RUN_MERGE_GAP 6
+
+#define FLIPPED IS_ENABLED(CONFIG_DONGLE_SCREEN_FLIPPED)
+
+BUILD_ASSERT(DISPLAY_HEIGHT % PAGE_HEIGHT == 0, "Display height must be a multiple of a page");
+BUILD_ASSERT(PAGE_COUNT <= 32, "Page sync mask only covers 32 pages");
+
+static const struct device *display_dev = DEVICE_DT_GET(DISPLAY_NODE);
+
+static uint8_t gddram[PAGE_COUNT][DISPLAY_WIDTH];
+static uint32_t synced_pages;
+static uint32_t dirty_cols[DIV_ROUND_UP(DISPLAY_WIDTH, 32)];
+static uint8_t xor_mask;
+static struct panel_flush_stats stats;
+
+static void write_run(int page, int x1, int x2) {
+    struct display_buffer_descriptor desc = {
+        .buf_size = x2 - x1 + 1,
+        .width = x2 - x1 + 1,
+        .height = PAGE_HEIGHT,
+        .pitch = x2 - x1 + 1,
+    };
+
+    int err = display_write(display_dev, x1, page * PAGE_HEIGHT, &desc, &gddram[page][x1]);
+    if (err) {
+        LOG_ERR("Failed to write page %d [%d..%d]: %d", page, x1, x2, err);
+        synced_pages &= ~BIT(page);
+        return;
+    }
+
+    stats.writes++;
+    stats.bytes_written += desc.width;
+}
+
+static void write_dirty_runs(int page, int lo, int hi) {
+    int run_start = -1;
+    int run_end = -1;
+
+    for (int x = lo; x <= hi; x++) {
+        if (!(dirty_cols[x / 32] & BIT(x % 32))) {
+            continue;
+        }
+        dirty_cols[x / 32] &= ~BIT(x % 32);
+        if (run_start >= 0 && x - run_end > RUN_MERGE_GAP) {
+            write_run(page, run_start, run_end);
+            run_start = -1;
+        }
+        if (run_start < 0) {
+            run_start = x;
+        }
+        run_end = x;
+    }
+
+    if (run_start >= 0) {
+        write_run(page, run_start, run_end);
+    }
+}
+
+/*
+ * Converts the rendered rows of one page straight into the GDDRAM shadow and
+ * sends the changed runs from there, so no intermediate conversion buffer is
+ * needed between LVGL's draw buffer and the bus transfer.
+ */
+static void flush_page(int page, const lv_area_t *area, const uint8_t *px_map, uint32_t stride) {
+    const int page_y = page * PAGE_HEIGHT;
+    const int y_first = MAX(area->y1, page_y);
+    const int y_last = MIN(area->y2, page_y + PAGE_HEIGHT - 1);
+    const int width = lv_area_get_width(area);
+    const int dst_page = FLIPPED ? PAGE_COUNT - 1 - page : page;
+    const uint8_t row_mask = FLIPPED ? GENMASK(7 - (y_first - page_y), 7 - (y_last - page_y))
+                                     : GENMASK(y_last - page_y, y_first - page_y);
+    const bool synced = synced_pages & BIT(dst_page);
+    uint8_t *dst = gddram[dst_page];
+    int dirty_lo = DISPLAY_WIDTH;
+    int dirty_hi = -1;
+    uint8_t rows[PAGE_HEIGHT];
+    uint8_t cols[8];
+
+    for (int src_x = 0; src_x < width; src_x += 8) {
+        for (int r = 0; r < PAGE_HEIGHT; r++) {
+            const int y = page_y + r;
+            rows[r] = (y >= y_first && y <= y_last)
+                          ? px_map[(y - area->y1) * stride + src_x / 8] ^ xor_mask
+                          : 0;
+        }
+
+        if (FLIPPED) {
+            page_transpose8_msb(rows, cols);
+        } else {
+            page_transpose8(rows, cols);
+        }
+
+        for (int j = 0; j < 8 && src_x + j < width; j++) {
+            const int x = area->x1 + src_x + j;
+            const int dst_x = FLIPPED ? DISPLAY_WIDTH - 1 - x : x;
+            const uint8_t byte = (dst[dst_x] & ~row_mask) | (cols[j] & row_mask);
+
+            if (synced && byte == dst[dst_x]) {
+                continue;
+            }
+            dst[dst_x] = byte;
+            dirty_cols[dst_x / 32] |= BIT(dst_x % 32);
+            dirty_lo = MIN(dirty_lo, dst_x);
+            dirty_hi = MAX(dirty_hi, dst_x);
+        }
+    }
+
+    // Unknown GDDRAM content is sent in full until a full page covered it once
+    if (!synced && row_mask == 0xFF && width == DISPLAY_WIDTH) {
+        synced_pages |= BIT(dst_page);
+    }
+
+    write_dirty_runs(dst_page, dirty_lo, dirty_hi);
+}
+
+static void panel_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    const uint32_t stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), LV_COLOR_FORMAT_I1);
+
+    px_map += I1_PALETTE_SIZE;
+    stats.flushes++;
+
+    for (int page = area->y1 / PAGE_HEIGHT; page <= area->y2 / PAGE_HEIGHT; page++) {
+        flush_page(page, area, px_map, stride);
+        stats.bytes_rendered += lv_area_get_width(area);
+    }
+
+    lv_display_flush_ready(disp);
+}
+
+int panel_flush_init(void) {
+    struct display_capabilities caps;
+    lv_display_t *disp = lv_display_get_default();
+
+    if (!disp || !device_is_ready(display_dev)) {
+        return -ENODEV;
+    }
+
+    display_get_capabilities(display_dev, &caps);
+    if (!(caps.screen_info & SCREEN_INFO_MONO_VTILED) ||
+        (caps.screen_info & SCREEN_INFO_MONO_MSB_FIRST) ||
+        caps.x_resolution != DISPLAY_WIDTH || caps.y_resolution != DISPLAY_HEIGHT) {
+        LOG_WRN("Panel layout not supported, keeping the default flush");
+        return -ENOTSUP;
+    }
+
+    // LVGL renders light pixels as 1, while Zephyr lights dark pixels on MONO01 panels
+    xor_mask = caps.current_pixel_format == PIXEL_FORMAT_MONO01 ? 0xFF : 0x00;
+    synced_pages = 0;
+
+    lv_display_set_flush_cb(disp, panel_flush_cb);
+    return 0;
+}
+
+void panel_flush_get_stats(struct panel_flush_stats *out) {
+    *out = stats;
+}
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+struct panel_flush_stats {
+    uint32_t flushes;       // LVGL flush calls handled
+    uint32_t bytes_rendered; // GDDRAM bytes covered by the flushed areas
+    uint32_t bytes_written; // GDDRAM bytes actually sent to the panel
+    uint32_t writes;        // display_write() transactions issued
+};
+
+int panel_flush_init(void);
+void panel_flush_get_stats(struct panel_flush_stats *stats);
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <lvgl.h>
+#include <zmk/display.h>
+
+#include "render.h"
+#include "screen_power.h"
+
+/*
+ * Render on demand. ZMK runs the LVGL timer handler from a fixed 10 ms
+ * timer, which wakes the display thread even when nothing changed. Instead
+ * the handler runs when LVGL resumes a timer, which it does on every
+ * invalidation and animation start, and then only as long as the handler
+ * reports a timer to come back for. LVGL pauses its refresh timer once
+ * nothing is invalid and its animation timer once no animation runs, so an
+ * idle screen does not wake the thread at all.
+ */
+
+// Defined by ZMK's display main with K_TIMER_DEFINE, which is not static.
+// ZMK has no hook to stop the tick, cmake/tickless.cmake checks the definition.
+extern struct k_timer display_timer;
+
+static struct render_stats stats;
+
+static void render_work_cb(struct k_work *work) {
+    // Panel off: timers are disabled and screen_power requests a run on wake
+    if (!screen_power_is_on()) {
+        return;
+    }
+
+    stats.wakeups++;
+    const uint32_t next = lv_timer_handler();
+    if (next == LV_NO_TIMER_READY) {
+        stats.idle++;
+        return;
+    }
+
+    k_work_schedule_for_queue(zmk_display_work_q(), k_work_delayable_from_work(work),
+                              K_MSEC(next));
+}
+
+static K_WORK_DELAYABLE_DEFINE(render_work, render_work_cb);
+
+static void resume_cb(void *data) { render_request(); }
+
+static void takeover_work_cb(struct k_work *work) {
+    k_timer_stop(&display_timer);
+    lv_timer_handler_set_resume_cb(resume_cb, NULL);
+    render_request();
+}
+
+static K_WORK_DEFINE(takeover_work, takeover_work_cb);
+
+void render_request(void) {
+    k_work_reschedule_for_queue(zmk_display_work_q(), &render_work, K_NO_WAIT);
+}
+
+void render_get_stats(struct render_stats *out) { *out = stats; }
+
+int render_init(void) {
+    // The status screen is built by ZMK's display init work, which starts the
+    // fixed tick when it returns. Stop the tick after it on the same queue.
+    k_work_submit_to_queue(zmk_display_work_q(), &takeover_work);
+    return 0;
+}
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_SHELL)
+#include <zephyr/shell/shell.h>
+
+static int cmd_render(const struct shell *sh, size_t argc, char **argv) {
+    shell_print(sh, "wakeups: %u", stats.wakeups);
+    shell_print(sh, "idle:    %u", stats.idle);
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((dongle_screen), render, NULL, "Display thread wakeups of the renderer",
+                 cmd_render, 1, 0);
+#endif
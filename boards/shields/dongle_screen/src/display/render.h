@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+struct render_stats {
+    uint32_t wakeups; // display thread runs of the LVGL timer handler
+    uint32_t idle;    // runs after which no LVGL timer was left to wait for
+};
+
+int render_init(void);
+
+// Run the LVGL timers on the display work queue as soon as possible
+void render_request(void);
+
+void render_get_stats(struct render_stats *stats);
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <lvgl.h>
+#include <dt-bindings/zmk/hid_usage_pages.h>
+#include <zmk/display.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/keycode_state_changed.h>
+#include <zmk/events/layer_state_changed.h>
+
+#include "screen_power.h"
+#include "brightness.h"
+#if CONFIG_DONGLE_SCREEN_TICKLESS
+#include "render.h"
+#endif
+#include <util.h>
+
+/*
+ * Panel power handling. While off, the controller is sent its display-off
+ * command and the whole LVGL timer handling is disabled, so neither rendering
+ * nor bus traffic happens. Going idle fades the contrast out first, toggling
+ * is instant. GDDRAM keeps its content, so turning the panel on
+ * again only renders what widgets invalidated in the meantime.
+ *
+ * The state is updated right away from the event listeners and the panel is
+ * brought in line with it on the display work queue.
+ */
+
+enum screen_state {
+    SCREEN_ON,
+    SCREEN_IDLE,        // off after the idle timeout, any activity wakes it
+    SCREEN_TOGGLED_OFF, // off by the toggle key, only the toggle key wakes it
+};
+
+static const struct device *display_dev = DEVICE_DT_GET(DISPLAY_NODE);
+
+static struct k_spinlock lock;
+static enum screen_state state = SCREEN_ON;
+static bool panel_on = true;
+static bool idle_dimmed;
+static bool initialized;
+
+static void screen_blank(void) { display_blanking_on(display_dev); }
+
+static void screen_apply_work_cb(struct k_work *work) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    const enum screen_state target = state;
+    k_spin_unlock(&lock, key);
+    const bool target_on = target == SCREEN_ON;
+
+    if (target_on == panel_on) {
+        return;
+    }
+
+    if (target_on) {
+        lv_timer_enable(true);
+        // Push whatever changed while the panel was off before showing it again
+        lv_refr_now(NULL);
+#if CONFIG_DONGLE_SCREEN_TICKLESS
+        // Pick up animations and timers that were held while off
+        render_request();
+#endif
+        display_blanking_off(display_dev);
+        if (idle_dimmed) {
+            brightness_restore();
+        } else {
+            brightness_reset();
+        }
+    } else {
+        lv_timer_enable(false);
+        if (target == SCREEN_IDLE) {
+            // Dim out first, the panel is switched off once the fade is done
+            brightness_fade_to(0, screen_blank);
+        } else {
+            brightness_reset();
+            screen_blank();
+        }
+    }
+    panel_on = target_on;
+    idle_dimmed = target == SCREEN_IDLE;
+
+    LOG_DBG("Screen %s", target_on ? "on" : "off");
+}
+
+static K_WORK_DEFINE(screen_apply_work, screen_apply_work_cb);
+
+static void screen_set_state(enum screen_state new_state) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    const bool changed = state != new_state;
+    state = new_state;
+    k_spin_unlock(&lock, key);
+
+    if (changed) {
+        k_work_submit_to_queue(zmk_display_work_q(), &screen_apply_work);
+    }
+}
+
+static void screen_idle_work_cb(struct k_work *work) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    const bool on = state == SCREEN_ON;
+    k_spin_unlock(&lock, key);
+
+    // A toggled off screen stays off until the toggle key is pressed again
+    if (on) {
+        screen_set_state(SCREEN_IDLE);
+    }
+}
+
+static K_WORK_DELAYABLE_DEFINE(screen_idle_work, screen_idle_work_cb);
+
+static void restart_idle_timer(void) {
+#if CONFIG_DONGLE_SCREEN_IDLE_TIMEOUT_S > 0
+    k_work_reschedule_for_queue(zmk_display_work_q(), &screen_idle_work,
+                                K_SECONDS(CONFIG_DONGLE_SCREEN_IDLE_TIMEOUT_S));
+#endif
+}
+
+void screen_power_notify_activity(void) {
+    if (!initialized) {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    const bool wake = state == SCREEN_IDLE;
+    k_spin_unlock(&lock, key);
+
+    if (wake) {
+        screen_set_state(SCREEN_ON);
+    }
+    restart_idle_timer();
+}
+
+void screen_power_toggle(void) {
+    if (!initialized) {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    const enum screen_state next = state == SCREEN_ON ? SCREEN_TOGGLED_OFF : SCREEN_ON;
+    k_spin_unlock(&lock, key);
+
+    screen_set_state(next);
+    if (next == SCREEN_ON) {
+        restart_idle_timer();
+    } else {
+        k_work_cancel_delayable(&screen_idle_work);
+    }
+}
+
+bool screen_power_is_on(void) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    const bool on = state == SCREEN_ON;
+    k_spin_unlock(&lock, key);
+    return on;
+}
+
+static int screen_power_event_cb(const zmk_event_t *eh) {
+    const struct zmk_keycode_state_changed *ev = as_zmk_keycode_state_changed(eh);
+
+    if (ev != NULL && ev->usage_page == HID_USAGE_KEY &&
+        ev->keycode == CONFIG_DONGLE_SCREEN_TOGGLE_KEYCODE) {
+        if (ev->state) {
+            screen_power_toggle();
+        }
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+    screen_power_notify_activity();
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(dongle_screen_power, screen_power_event_cb);
+ZMK_SUBSCRIPTION(dongle_screen_power, zmk_keycode_state_changed);
+ZMK_SUBSCRIPTION(dongle_screen_power, zmk_layer_state_changed);
+
+int screen_power_init(void) {
+    if (!device_is_ready(display_dev)) {
+        return -ENODEV;
+    }
+
+    brightness_init();
+
+    initialized = true;
+    restart_idle_timer();
+    return 0;
+}
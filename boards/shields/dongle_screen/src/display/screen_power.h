@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <stdbool.h>
+
+int screen_power_init(void);
+
+// Restarts the idle timeout and turns the panel back on if it was idle
+void screen_power_notify_activity(void);
+
+// Switches between on and off, as done by CONFIG_DONGLE_SCREEN_TOGGLE_KEYCODE
+void screen_power_toggle(void);
+
+bool screen_power_is_on(void);
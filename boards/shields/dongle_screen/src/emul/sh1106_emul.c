@@ -0,0 +1,406 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "sh1106_emul.h"
+
+/*
+ * I2C emulator of the SH1106/SH1107 OLED controllers, bound to the same
+ * compatibles as Zephyr's ssd1306 driver, so on native_sim the driver, LVGL
+ * and the shield's flush path run unchanged against it.
+ *
+ * Every write transaction starts with a control byte: bit 6 selects data or
+ * commands, bit 7 (continuation) means only one byte follows before the
+ * next control byte. Data goes to the current page and column, which
+ * advances without wrapping into the next page like on the real chip.
+ */
+
+#define CONTROL_CO BIT(7)
+#define CONTROL_DC BIT(6)
+
+#define MAX_ARGS 2
+
+struct sh1106_emul_cfg {
+    uint16_t columns;
+    uint8_t pages;
+    bool sh1107;
+    uint16_t x_offset;
+    uint16_t y_offset;
+    uint16_t width;
+    uint16_t height;
+};
+
+struct sh1106_emul_data {
+    uint8_t gddram[SH1106_EMUL_PAGES][SH1106_EMUL_COLUMNS];
+    struct sh1106_emul_stats stats;
+    uint8_t checkpoint[SH1106_EMUL_PAGES][SH1106_EMUL_COLUMNS];
+    uint32_t checkpoint_data_bytes;
+
+    uint8_t page;
+    uint8_t column;
+    bool on;
+    bool inverted;
+    bool segment_remap;
+    bool com_reverse;
+    uint8_t contrast;
+    uint8_t start_line;
+    uint8_t display_offset;
+    uint8_t multiplex;
+
+    // Command parser, a command's arguments may come in later control blocks
+    uint8_t cmd;
+    uint8_t args[MAX_ARGS];
+    uint8_t args_seen;
+    uint8_t args_left;
+};
+
+static uint8_t arg_count(const struct sh1106_emul_cfg *cfg, uint8_t cmd) {
+    switch (cmd) {
+    case 0x81: // contrast
+    case 0xA8: // multiplex ratio
+    case 0xAD: // DC-DC control
+    case 0x8D: // SSD1306 charge pump, sent by the shared driver
+    case 0xD3: // display offset
+    case 0xD5: // clock divide
+    case 0xD9: // precharge period
+    case 0xDA: // COM pins
+    case 0xDB: // VCOM deselect level
+    case 0xDC: // SH1107 display start line
+        return 1;
+    case 0x20: // SH1107 page addressing, SSD1306 addressing mode on the SH1106
+        return cfg->sh1107 ? 0 : 1;
+    case 0x21: // SH1107 vertical addressing, SSD1306 column range on the SH1106
+        return cfg->sh1107 ? 0 : 2;
+    case 0x22: // SSD1306 page range
+        return cfg->sh1107 ? 0 : 2;
+    default:
+        return 0;
+    }
+}
+
+static void exec_cmd(const struct emul *target, uint8_t cmd, const uint8_t *args) {
+    const struct sh1106_emul_cfg *cfg = target->cfg;
+    struct sh1106_emul_data *data = target->data;
+
+    if (cmd <= 0x0F) {
+        data->column = (data->column & 0xF0) | cmd;
+    } else if (cmd <= 0x1F) {
+        // Drivers send the higher nibble last, the address is complete here
+        data->column = (data->column & 0x0F) | ((cmd & 0x0F) << 4);
+        if (data->column >= SH1106_EMUL_COLUMNS) {
+            data->stats.out_of_range++;
+            LOG_WRN("SH1106 emulator: column %u out of range", data->column);
+        }
+    } else if (cmd >= 0x40 && cmd <= 0x7F && !cfg->sh1107) {
+        data->start_line = cmd & 0x3F;
+    } else if ((cmd & 0xF0) == 0xB0) {
+        data->page = (cmd & 0x0F) % cfg->pages;
+    } else {
+        switch (cmd) {
+        case 0xAE:
+        case 0xAF:
+            data->on = cmd == 0xAF;
+            break;
+        case 0xA6:
+        case 0xA7:
+            data->inverted = cmd == 0xA7;
+            break;
+        case 0xA0:
+        case 0xA1:
+            data->segment_remap = cmd == 0xA1;
+            break;
+        case 0xC0:
+        case 0xC8:
+            data->com_reverse = cmd == 0xC8;
+            break;
+        case 0x81:
+            data->contrast = args[0];
+            break;
+        case 0xA8:
+            data->multiplex = args[0];
+            break;
+        case 0xD3:
+            data->display_offset = args[0];
+            break;
+        case 0xDC:
+            data->start_line = args[0];
+            break;
+        case 0x20: case 0x21: case 0x22:
+        case 0xA4: case 0xA5:
+        case 0xAD: case 0x8D:
+        case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+        case 0xE3: // nop
+            break;
+        default:
+            data->stats.unknown++;
+            LOG_WRN("SH1106 emulator: unknown command 0x%02x", cmd);
+            break;
+        }
+    }
+}
+
+static void feed_cmd(const struct emul *target, uint8_t byte) {
+    struct sh1106_emul_data *data = target->data;
+
+    data->stats.commands++;
+    if (data->args_left > 0) {
+        data->args[data->args_seen++] = byte;
+        if (--data->args_left == 0) {
+            exec_cmd(target, data->cmd, data->args);
+        }
+        return;
+    }
+
+    data->cmd = byte;
+    data->args_seen = 0;
+    data->args_left = arg_count(target->cfg, byte);
+    if (data->args_left == 0) {
+        exec_cmd(target, byte, NULL);
+    }
+}
+
+static void feed_data(const struct emul *target, uint8_t byte) {
+    const struct sh1106_emul_cfg *cfg = target->cfg;
+    struct sh1106_emul_data *data = target->data;
+
+    data->stats.data_bytes++;
+    if (data->column < cfg->columns) {
+        data->gddram[data->page][data->column++] = byte;
+    } else {
+        data->stats.out_of_range++;
+    }
+}
+
+static int sh1106_emul_transfer(const struct emul *target, struct i2c_msg *msgs, int num_msgs,
+                                int addr) {
+    struct sh1106_emul_data *data = target->data;
+    bool control = true;
+    bool continuation = false;
+    bool is_data = false;
+
+    data->stats.transfers++;
+    for (int i = 0; i < num_msgs; i++) {
+        if (msgs[i].flags & I2C_MSG_READ) {
+            // The status read of the SH1106 is not used by the driver
+            return -EIO;
+        }
+
+        for (uint32_t j = 0; j < msgs[i].len; j++) {
+            const uint8_t byte = msgs[i].buf[j];
+
+            if (control) {
+                continuation = byte & CONTROL_CO;
+                is_data = byte & CONTROL_DC;
+                control = false;
+                continue;
+            }
+
+            if (is_data) {
+                feed_data(target, byte);
+            } else {
+                feed_cmd(target, byte);
+            }
+            control = continuation;
+        }
+    }
+    return 0;
+}
+
+static const struct i2c_emul_api sh1106_emul_api = {
+    .transfer = sh1106_emul_transfer,
+};
+
+static int sh1106_emul_init(const struct emul *target, const struct device *parent) {
+    struct sh1106_emul_data *data = target->data;
+
+    memset(data->gddram, 0, sizeof(data->gddram));
+    data->contrast = 0x80;
+    return 0;
+}
+
+const uint8_t (*sh1106_emul_gddram(const struct emul *target))[SH1106_EMUL_COLUMNS] {
+    const struct sh1106_emul_data *data = target->data;
+    return data->gddram;
+}
+
+bool sh1106_emul_pixel(const struct emul *target, int x, int y) {
+    const struct sh1106_emul_cfg *cfg = target->cfg;
+    const struct sh1106_emul_data *data = target->data;
+
+    if (x < 0 || x >= cfg->columns || y < 0 || y >= cfg->pages * 8) {
+        return false;
+    }
+    return data->gddram[y / 8][x] & BIT(y % 8);
+}
+
+void sh1106_emul_panel_size(const struct emul *target, int *width, int *height) {
+    const struct sh1106_emul_cfg *cfg = target->cfg;
+
+    *width = cfg->width;
+    *height = cfg->height;
+}
+
+bool sh1106_emul_panel_pixel(const struct emul *target, int x, int y) {
+    const struct sh1106_emul_cfg *cfg = target->cfg;
+
+    return sh1106_emul_pixel(target, x + cfg->x_offset, y + cfg->y_offset);
+}
+
+void sh1106_emul_checkpoint(const struct emul *target, struct sh1106_emul_transition *transition) {
+    const struct sh1106_emul_cfg *cfg = target->cfg;
+    struct sh1106_emul_data *data = target->data;
+
+    *transition = (struct sh1106_emul_transition){
+        .bytes_written = data->stats.data_bytes - data->checkpoint_data_bytes,
+    };
+    for (int page = 0; page < cfg->pages; page++) {
+        for (int x = 0; x < cfg->columns; x++) {
+            const uint8_t diff = data->gddram[page][x] ^ data->checkpoint[page][x];
+            if (diff) {
+                transition->bytes_changed++;
+                transition->pixels_changed += __builtin_popcount(diff);
+            }
+        }
+    }
+
+    memcpy(data->checkpoint, data->gddram, sizeof(data->checkpoint));
+    data->checkpoint_data_bytes = data->stats.data_bytes;
+}
+
+bool sh1106_emul_is_on(const struct emul *target) {
+    return ((const struct sh1106_emul_data *)target->data)->on;
+}
+
+uint8_t sh1106_emul_contrast(const struct emul *target) {
+    return ((const struct sh1106_emul_data *)target->data)->contrast;
+}
+
+bool sh1106_emul_is_inverted(const struct emul *target) {
+    return ((const struct sh1106_emul_data *)target->data)->inverted;
+}
+
+void sh1106_emul_get_stats(const struct emul *target, struct sh1106_emul_stats *stats) {
+    *stats = ((const struct sh1106_emul_data *)target->data)->stats;
+}
+
+void sh1106_emul_reset_stats(const struct emul *target) {
+    struct sh1106_emul_data *data = target->data;
+    memset(&data->stats, 0, sizeof(data->stats));
+    data->checkpoint_data_bytes = 0;
+}
+
+// Sized like the panel in the devicetree, panels taller than 64 rows use the sh1106 driver too
+#define SH1106_EMUL_DEFINE(n, _sh1107)                                                          \
+    BUILD_ASSERT(DT_INST_PROP(n, width) + DT_INST_PROP(n, segment_offset) <=                    \
+                     SH1106_EMUL_COLUMNS,                                                       \
+                 "Panel wider than the emulated GDDRAM");                                       \
+    BUILD_ASSERT(DT_INST_PROP(n, height) / 8 + DT_INST_PROP(n, page_offset) <=                  \
+                     SH1106_EMUL_PAGES,                                                         \
+                 "Panel taller than the emulated GDDRAM");                                      \
+    static struct sh1106_emul_data sh1106_emul_data_##_sh1107##_##n;                            \
+    static const struct sh1106_emul_cfg sh1106_emul_cfg_##_sh1107##_##n = {                     \
+        .columns = DT_INST_PROP(n, width) + DT_INST_PROP(n, segment_offset),                    \
+        .pages = DT_INST_PROP(n, height) / 8 + DT_INST_PROP(n, page_offset),                    \
+        .sh1107 = _sh1107,                                                                      \
+        .x_offset = DT_INST_PROP(n, segment_offset),                                            \
+        .y_offset = DT_INST_PROP(n, page_offset) * 8,                                           \
+        .width = DT_INST_PROP(n, width),                                                        \
+        .height = DT_INST_PROP(n, height),                                                      \
+    };                                                                                          \
+    EMUL_DT_INST_DEFINE(n, sh1106_emul_init, &sh1106_emul_data_##_sh1107##_##n,                 \
+                        &sh1106_emul_cfg_##_sh1107##_##n, &sh1106_emul_api, NULL)
+
+#define DT_DRV_COMPAT sinowealth_sh1106
+#define SH1106_EMUL(n) SH1106_EMUL_DEFINE(n, 0)
+DT_INST_FOREACH_STATUS_OKAY(SH1106_EMUL)
+#undef DT_DRV_COMPAT
+
+#define DT_DRV_COMPAT sinowealth_sh1107
+#define SH1107_EMUL(n) SH1106_EMUL_DEFINE(n, 1)
+DT_INST_FOREACH_STATUS_OKAY(SH1107_EMUL)
+#undef DT_DRV_COMPAT
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_SHELL) &&                                                   \
+    (DT_NODE_HAS_COMPAT(DT_CHOSEN(zephyr_display), sinowealth_sh1106) ||                        \
+     DT_NODE_HAS_COMPAT(DT_CHOSEN(zephyr_display), sinowealth_sh1107))
+#include <zephyr/shell/shell.h>
+
+// Plain PBM keeps lines at most 70 characters long
+#define PBM_LINE 70
+
+static int cmd_panel(const struct shell *sh, size_t argc, char **argv) {
+    const struct emul *target = EMUL_DT_GET(DT_CHOSEN(zephyr_display));
+    struct sh1106_emul_stats stats;
+    char line[SH1106_EMUL_COLUMNS + 1];
+    int width, height;
+
+    sh1106_emul_get_stats(target, &stats);
+    shell_print(sh, "%s, contrast %u%s", sh1106_emul_is_on(target) ? "on" : "off",
+                sh1106_emul_contrast(target), sh1106_emul_is_inverted(target) ? ", inverted" : "");
+    shell_print(sh, "transfers %u, command bytes %u, data bytes %u, unknown commands %u, "
+                "out of range %u",
+                stats.transfers, stats.commands, stats.data_bytes, stats.unknown,
+                stats.out_of_range);
+
+    sh1106_emul_panel_size(target, &width, &height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            line[x] = sh1106_emul_panel_pixel(target, x, y) ? '#' : '.';
+        }
+        line[width] = '\0';
+        shell_print(sh, "%s", line);
+    }
+    return 0;
+}
+
+static int cmd_panel_pbm(const struct shell *sh, size_t argc, char **argv) {
+    const struct emul *target = EMUL_DT_GET(DT_CHOSEN(zephyr_display));
+    char line[PBM_LINE + 1];
+    int width, height;
+
+    sh1106_emul_panel_size(target, &width, &height);
+    shell_print(sh, "P1");
+    shell_print(sh, "%d %d", width, height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x += PBM_LINE) {
+            const int n = MIN(PBM_LINE, width - x);
+            for (int i = 0; i < n; i++) {
+                line[i] = sh1106_emul_panel_pixel(target, x + i, y) ? '1' : '0';
+            }
+            line[n] = '\0';
+            shell_print(sh, "%s", line);
+        }
+    }
+    return 0;
+}
+
+static int cmd_panel_diff(const struct shell *sh, size_t argc, char **argv) {
+    const struct emul *target = EMUL_DT_GET(DT_CHOSEN(zephyr_display));
+    struct sh1106_emul_transition transition;
+
+    sh1106_emul_checkpoint(target, &transition);
+    shell_print(sh, "pixels changed %u, bytes changed %u, bytes written %u",
+                transition.pixels_changed, transition.bytes_changed, transition.bytes_written);
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(panel_cmds,
+                               SHELL_CMD(pbm, NULL, "Panel image as plain PBM", cmd_panel_pbm),
+                               SHELL_CMD(diff, NULL, "Changes since the last diff", cmd_panel_diff),
+                               SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((dongle_screen), panel, &panel_cmds,
+                 "Image and bus statistics of the emulated panel", cmd_panel, 1, 0);
+#endif
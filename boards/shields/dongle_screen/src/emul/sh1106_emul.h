@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/drivers/emul.h>
+
+// Large enough for both controllers, SH1106 has 132x64 and SH1107 128x128 pixels of GDDRAM
+#define SH1106_EMUL_COLUMNS 132
+#define SH1106_EMUL_PAGES 16
+
+struct sh1106_emul_stats {
+    uint32_t transfers;    // I2C write transactions
+    uint32_t commands;     // command bytes, arguments included
+    uint32_t data_bytes;   // GDDRAM bytes written
+    uint32_t unknown;      // commands the emulator does not know
+    uint32_t out_of_range; // column addresses and data bytes past the GDDRAM
+};
+
+/*
+ * GDDRAM as written by the driver, one byte per column and page with the
+ * topmost row in bit 0. Segment remap, COM direction and offsets are only
+ * recorded, not applied, so this is the image in the driver's coordinates.
+ */
+const uint8_t (*sh1106_emul_gddram(const struct emul *target))[SH1106_EMUL_COLUMNS];
+
+bool sh1106_emul_pixel(const struct emul *target, int x, int y);
+
+// The panel area of the devicetree node, without segment and page offsets
+void sh1106_emul_panel_size(const struct emul *target, int *width, int *height);
+bool sh1106_emul_panel_pixel(const struct emul *target, int x, int y);
+
+// What changed on the panel between two checkpoints
+struct sh1106_emul_transition {
+    uint32_t pixels_changed;
+    uint32_t bytes_changed; // GDDRAM bytes that differ
+    uint32_t bytes_written; // GDDRAM bytes sent, changed or not
+};
+
+// Compare against the previous checkpoint and make the current image the new one
+void sh1106_emul_checkpoint(const struct emul *target, struct sh1106_emul_transition *transition);
+
+bool sh1106_emul_is_on(const struct emul *target);
+uint8_t sh1106_emul_contrast(const struct emul *target);
+bool sh1106_emul_is_inverted(const struct emul *target);
+
+void sh1106_emul_get_stats(const struct emul *target, struct sh1106_emul_stats *stats);
+void sh1106_emul_reset_stats(const struct emul *target);
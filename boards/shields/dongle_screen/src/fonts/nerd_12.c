@@ -1,7 +1,8 @@
 /*******************************************************************************
  * Size: 12 px
- * Bpp: 4
+ * Bpp: 1
  * Opts: --bpp 4 --size 12 --no-compress --stride 1 --align 1 --font FiraCodeNerdFontMono-Regular.ttf --range 983215,983216-983220,985406-985418,62087,984403,987632,62711,983968-983985,57943,987014,987014,987013,984261,986807,986925,985630,61818,61820,62210,984627,984626,984628,984629,984630,983161-983185 --format lvgl -o nerd_12.c
+ * Converted: lvgl_font.py to-1bpp from the --bpp 4 output, coverage >= 50% kept, no hinting
  ******************************************************************************/
 
 #ifdef __has_include
@@ -33,536 +34,276 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+E257 "" */
-    0x0, 0x17, 0x30, 0x0, 0x3a, 0xff, 0xfd, 0x60,
-    0x3a, 0xff, 0xfd, 0x60, 0x68, 0x47, 0x56, 0x81,
-    0x65, 0x69, 0x84, 0x71, 0x4, 0x98, 0x96, 0x10,
-    0x0, 0x1, 0x0, 0x0,
+    0x0, 0x7c, 0x7c, 0x42, 0x18, 0x38, 0x0,
 
     /* U+F17A "" */
-    0x0, 0x0, 0x2, 0x42, 0x69, 0xb9, 0xff, 0xf6,
-    0xff, 0xfa, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xf6,
-    0xaa, 0xa6, 0xaa, 0xa3, 0xff, 0xfa, 0xff, 0xf6,
-    0xff, 0xfa, 0xff, 0xf6, 0x3, 0x55, 0x9b, 0xe6,
+    0x0, 0x7e, 0xfe, 0xfe, 0xee, 0xfe, 0xfe, 0xe,
 
     /* U+F17C "" */
-    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x4f, 0xe0,
-    0x0, 0x0, 0x5, 0x9b, 0x30, 0x0, 0x0, 0x51,
-    0x94, 0x0, 0x0, 0x17, 0x2, 0xc0, 0x0, 0x9,
-    0x20, 0x9, 0x70, 0x0, 0xb0, 0x0, 0x6a, 0x0,
-    0x22, 0x60, 0x4, 0x30, 0x1, 0x4, 0x35, 0x1,
-    0x10, 0x11, 0x23, 0x32, 0x10,
+    0x0, 0x6, 0x3, 0x0, 0x80, 0x21, 0x10, 0x84,
+    0x0, 0x0, 0x0, 0x0,
 
     /* U+F287 "" */
-    0x0, 0x7, 0xd0, 0x0, 0x44, 0x61, 0x20, 0x30,
-    0x9a, 0x5a, 0x55, 0x93, 0x0, 0x4, 0x9d, 0x0,
-    0x0, 0x0, 0x15, 0x0,
+    0x8, 0x0, 0xd2, 0xc, 0x0,
 
     /* U+F302 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x96, 0x0,
-    0x0, 0x3, 0xb0, 0x0, 0x1c, 0xea, 0xcf, 0xa0,
-    0xcf, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0x30,
-    0xef, 0xff, 0xff, 0x70, 0x9f, 0xff, 0xff, 0xf3,
-    0x1f, 0xff, 0xff, 0xc0, 0x3, 0xa6, 0x79, 0x10,
+    0x0, 0x8, 0x8, 0x7e, 0xfe, 0xfc, 0xfc, 0xfe,
+    0x7e, 0x24,
 
     /* U+F4F7 "" */
-    0x27, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x0,
-    0xe, 0x0, 0x0, 0x0, 0x1e, 0x0, 0xef, 0xf4,
-    0xce, 0xa0, 0x1c, 0x80, 0x0, 0x0, 0x3a, 0xc1,
-    0x6c, 0x50, 0x30, 0xb5, 0xa5, 0xd0, 0xbf, 0xa0,
-    0x2c, 0x60, 0x0, 0x0, 0xed, 0xa0, 0x0, 0x0,
-    0x23, 0x30, 0x0, 0x0,
+    0x0, 0xc0, 0x40, 0x4e, 0xe6, 0x6, 0x42, 0xae,
+    0x40, 0xe0, 0x0,
 
     /* U+F0079 "󰁹" */
-    0x0, 0xdf, 0xf5, 0x4, 0xef, 0xff, 0xfb, 0x6f,
-    0xff, 0xff, 0xe6, 0xff, 0xff, 0xfe, 0x6f, 0xff,
-    0xff, 0xe6, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff,
-    0xe6, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xe6,
-    0xff, 0xff, 0xfe, 0x29, 0x99, 0x99, 0x60,
+    0x38, 0xfd, 0xfb, 0xf7, 0xef, 0xdf, 0xbf, 0x7e,
+    0xfd, 0xf0,
 
     /* U+F007A "󰁺" */
-    0x0, 0xaf, 0xf7, 0x0, 0x2e, 0xff, 0xff, 0xd0,
-    0x4d, 0x11, 0x11, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4c, 0x0, 0x0, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4c, 0x0, 0x0, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4d, 0x44, 0x44, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x1c, 0xcc, 0xcc, 0xb0,
+    0x38, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x7e, 0x7e,
 
     /* U+F007B "󰁻" */
-    0x0, 0xaf, 0xf7, 0x0, 0x2e, 0xff, 0xff, 0xd0,
-    0x4d, 0x11, 0x11, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4c, 0x0, 0x0, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4c, 0x0, 0x0, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x8, 0x99, 0x99, 0x80,
+    0x38, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x7e, 0x7e, 0x7e,
 
     /* U+F007C "󰁼" */
-    0x0, 0xaf, 0xf7, 0x0, 0x2e, 0xff, 0xff, 0xd0,
-    0x4d, 0x11, 0x11, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4c, 0x0, 0x0, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4c, 0x0, 0x0, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x19, 0xaa, 0xaa, 0x90,
+    0x38, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7e,
+    0x7e, 0x7e, 0x7e,
 
     /* U+F007D "󰁽" */
-    0x0, 0xaf, 0xf7, 0x0, 0x2e, 0xff, 0xff, 0xd0,
-    0x4d, 0x11, 0x11, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4c, 0x0, 0x0, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4f, 0xdd, 0xdd, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xf1,
-    0x5, 0x55, 0x55, 0x40,
+    0x38, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x7e,
+    0x7e, 0x7e, 0x0,
 
     /* U+F007E "󰁾" */
-    0x0, 0xaf, 0xf7, 0x0, 0x2e, 0xff, 0xff, 0xd0,
-    0x4d, 0x11, 0x11, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4c, 0x0, 0x0, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x1a, 0xbb, 0xbb, 0xa0,
+    0x38, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x7e,
+    0x7e, 0x7e, 0x7e,
 
     /* U+F007F "󰁿" */
-    0x0, 0xaf, 0xf7, 0x0, 0x2e, 0xff, 0xff, 0xd0,
-    0x4d, 0x11, 0x11, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4c, 0x0, 0x0, 0xf1, 0x4f, 0xee, 0xee, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xf1,
-    0x5, 0x55, 0x55, 0x40,
+    0x38, 0x7e, 0x42, 0x42, 0x42, 0x7e, 0x7e, 0x7e,
+    0x7e, 0x7e, 0x0,
 
     /* U+F0080 "󰂀" */
-    0x0, 0xaf, 0xf7, 0x0, 0x2e, 0xff, 0xff, 0xd0,
-    0x4d, 0x11, 0x11, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xf1,
-    0x5, 0x66, 0x66, 0x50,
+    0x38, 0x7e, 0x42, 0x42, 0x7e, 0x7e, 0x7e, 0x7e,
+    0x7e, 0x7e, 0x0,
 
     /* U+F0081 "󰂁" */
-    0x0, 0xaf, 0xf7, 0x0, 0x2e, 0xff, 0xff, 0xd0,
-    0x4d, 0x11, 0x11, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x1c, 0xcc, 0xcc, 0xb0,
+    0x38, 0x7e, 0x42, 0x42, 0x7e, 0x7e, 0x7e, 0x7e,
+    0x7e, 0x7e, 0x7e,
 
     /* U+F0082 "󰂂" */
-    0x0, 0xaf, 0xf7, 0x0, 0x2f, 0xff, 0xff, 0xe0,
-    0x4c, 0x0, 0x0, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x6, 0x66, 0x66, 0x50,
+    0x38, 0x7e, 0x42, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+    0x7e, 0x7e, 0x0,
 
     /* U+F0083 "󰂃" */
-    0x0, 0xff, 0xf2, 0x4, 0xbf, 0xff, 0xc6, 0x8f,
-    0xff, 0xff, 0xa8, 0xff, 0x4f, 0xfa, 0x8f, 0xf1,
-    0xef, 0xa8, 0xff, 0x1e, 0xfa, 0x8f, 0xfd, 0xff,
-    0xa8, 0xff, 0x4e, 0xfa, 0x8f, 0xf5, 0xff, 0xa8,
-    0xff, 0xff, 0xfa, 0x4c, 0xcc, 0xcc, 0x60,
+    0x38, 0xfb, 0xff, 0x7e, 0xfd, 0xff, 0xf7, 0xef,
+    0xfd, 0xf0,
 
     /* U+F0084 "󰂄" */
-    0x0, 0xff, 0xf2, 0x4, 0xbf, 0xff, 0xc6, 0x8f,
-    0xff, 0xff, 0xb8, 0xff, 0xbe, 0xfb, 0x8f, 0xf3,
-    0xef, 0xb8, 0xfb, 0x8, 0xfb, 0x8f, 0x50, 0x4f,
-    0xb8, 0xff, 0x1c, 0xfb, 0x8f, 0xf5, 0xff, 0xb8,
-    0xff, 0xdf, 0xfb, 0x5c, 0xcc, 0xcc, 0x70,
+    0x38, 0xfb, 0xff, 0xfe, 0xfd, 0xf1, 0xf7, 0xef,
+    0xfd, 0xf0,
 
     /* U+F0085 "󰂅" */
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0,
-    0xff, 0xff, 0x32, 0x40, 0xff, 0xff, 0x39, 0x50,
-    0xff, 0xff, 0x5f, 0xe2, 0xff, 0xff, 0x47, 0xb0,
-    0xff, 0xff, 0x35, 0x40, 0xef, 0xff, 0x23, 0x0,
+    0x0, 0x60, 0xf0, 0xf4, 0xf6, 0xf2, 0xf0, 0xf0,
 
     /* U+F0086 "󰂆" */
-    0x6, 0x60, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x10,
-    0xb0, 0xb, 0x7, 0x10, 0xb0, 0xb, 0xe, 0x30,
-    0xb0, 0xb, 0x6f, 0xd0, 0xb0, 0xb, 0x9, 0x60,
-    0xff, 0xff, 0x8, 0x0, 0xbc, 0xcb, 0x2, 0x0,
+    0x0, 0xf0, 0x90, 0x94, 0x96, 0x94, 0xf4, 0xf0,
 
     /* U+F0087 "󰂇" */
-    0x6, 0x60, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x10,
-    0xb0, 0xb, 0x7, 0x10, 0xb0, 0xb, 0xe, 0x20,
-    0xb0, 0xb, 0x5f, 0xe0, 0xd7, 0x7d, 0x1a, 0x70,
-    0xff, 0xff, 0x8, 0x10, 0xef, 0xfe, 0x3, 0x0,
+    0x0, 0xf0, 0x90, 0x94, 0x96, 0x94, 0xf4, 0xf0,
 
     /* U+F0088 "󰂈" */
-    0x6, 0x60, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x10,
-    0xb0, 0xb, 0x7, 0x10, 0xb0, 0xb, 0xe, 0x20,
-    0xb0, 0xb, 0x5f, 0xe0, 0xea, 0xae, 0x1a, 0x70,
-    0xff, 0xff, 0x8, 0x10, 0xef, 0xfe, 0x3, 0x0,
+    0x0, 0xf0, 0x90, 0x94, 0x96, 0xf4, 0xf4, 0xf0,
 
     /* U+F0089 "󰂉" */
-    0x6, 0x60, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x10,
-    0xb0, 0xb, 0x7, 0x10, 0xb0, 0xb, 0xe, 0x20,
-    0xff, 0xff, 0x6f, 0xe0, 0xff, 0xff, 0x9, 0x70,
-    0xff, 0xff, 0x8, 0x0, 0xcc, 0xcc, 0x2, 0x0,
+    0x0, 0xf0, 0x90, 0x94, 0xf6, 0xf4, 0xf4, 0xf0,
 
     /* U+F008A "󰂊" */
-    0x6, 0x60, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x10,
-    0xb0, 0xb, 0x7, 0x10, 0xe9, 0x9e, 0xe, 0x10,
-    0xff, 0xff, 0x5f, 0xd0, 0xff, 0xff, 0x1a, 0x80,
-    0xff, 0xff, 0x9, 0x10, 0xef, 0xfe, 0x3, 0x0,
+    0x0, 0xf0, 0x90, 0xf4, 0xf6, 0xf6, 0xf4, 0xf0,
 
     /* U+F008B "󰂋" */
-    0x3, 0x30, 0x0, 0x0, 0x7f, 0xf6, 0x0, 0x0,
-    0xc4, 0x4c, 0x6, 0x10, 0xff, 0xff, 0xd, 0x10,
-    0xff, 0xff, 0x6f, 0xe0, 0xff, 0xff, 0x9, 0x70,
-    0xff, 0xff, 0x8, 0x10, 0xcd, 0xdc, 0x2, 0x0,
+    0x0, 0x60, 0x90, 0xf4, 0xf6, 0xf4, 0xf4, 0xf0,
 
     /* U+F008C "󰂌" */
-    0x0, 0xaf, 0xf7, 0x0, 0x2f, 0xff, 0xff, 0xe0,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x4d, 0x22, 0x22, 0xf1,
-    0x4f, 0xdd, 0xdd, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xf1,
-    0x5, 0x66, 0x66, 0x40,
+    0x38, 0x7e, 0x7e, 0x7e, 0x7e, 0x42, 0x7e, 0x7e,
+    0x7e, 0x7e, 0x0,
 
     /* U+F008D "󰂍" */
-    0x4, 0x40, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0,
-    0xb1, 0x1b, 0x0, 0x0, 0xa0, 0xa, 0x0, 0x0,
-    0xb2, 0x2b, 0x28, 0x83, 0xff, 0xff, 0x13, 0x31,
-    0xff, 0xff, 0x0, 0x0, 0xde, 0xed, 0x0, 0x0,
+    0x0, 0xf0, 0x90, 0x90, 0x96, 0xf0, 0xf0, 0xf0,
 
     /* U+F008E "󰂎" */
-    0x0, 0xaf, 0xf7, 0x0, 0x2e, 0xff, 0xff, 0xd0,
-    0x4d, 0x11, 0x11, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4c, 0x0, 0x0, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4c, 0x0, 0x0, 0xf1, 0x4c, 0x0, 0x0, 0xf1,
-    0x4c, 0x0, 0x0, 0xf1, 0x4d, 0x33, 0x33, 0xf1,
-    0x1c, 0xcc, 0xcc, 0xb0,
+    0x38, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+    0x42, 0x42, 0x7e,
 
     /* U+F008F "󰂏" */
-    0x0, 0xaf, 0xf8, 0x0, 0x2e, 0xff, 0xff, 0xd0,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xfd, 0xdf, 0xf1,
-    0x4f, 0xf6, 0x9f, 0xf1, 0x4d, 0x41, 0x24, 0xf1,
-    0x4e, 0xa3, 0x5a, 0xf1, 0x4f, 0xf6, 0x9f, 0xf1,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x8, 0x99, 0x99, 0x80,
+    0x3c, 0x7e, 0x7e, 0x7e, 0x6e, 0x42, 0x66, 0x6e,
+    0x7e, 0x7e, 0x7e,
 
     /* U+F0090 "󰂐" */
-    0x4, 0x40, 0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0,
-    0xb1, 0x1b, 0x0, 0x0, 0xa0, 0xa, 0x3, 0x40,
-    0xb2, 0x2b, 0x2a, 0xb3, 0xff, 0xff, 0x17, 0x71,
-    0xff, 0xff, 0x1, 0x10, 0xde, 0xed, 0x0, 0x0,
+    0x0, 0xf0, 0x90, 0x90, 0x96, 0xf0, 0xf0, 0xf0,
 
     /* U+F0091 "󰂑" */
-    0x0, 0xaf, 0xf7, 0x0, 0x2e, 0xff, 0xff, 0xd0,
-    0x4f, 0xb3, 0x4d, 0xf1, 0x4f, 0x1a, 0x82, 0xf1,
-    0x4f, 0xcf, 0xe0, 0xf1, 0x4f, 0xff, 0x39, 0xf1,
-    0x4f, 0xf9, 0x6f, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x4f, 0xf5, 0x9f, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x8, 0x99, 0x99, 0x80,
+    0x38, 0x7e, 0x66, 0x5a, 0x7a, 0x76, 0x76, 0x7e,
+    0x6e, 0x7e, 0x7e,
 
     /* U+F00AF "󰂯" */
-    0x0, 0x4, 0xb0, 0x0, 0x2, 0x4, 0xfb, 0x0,
-    0x3e, 0x34, 0xcb, 0xb0, 0x5, 0xe8, 0xcb, 0xb0,
-    0x0, 0x5f, 0xfc, 0x0, 0x0, 0xc, 0xf4, 0x0,
-    0x0, 0xae, 0xee, 0x30, 0xa, 0xb5, 0xc8, 0xe1,
-    0x2b, 0x4, 0xee, 0x50, 0x0, 0x4, 0xf5, 0x0,
-    0x0, 0x2, 0x50, 0x0,
+    0x8, 0xc, 0x4e, 0x3e, 0x1c, 0x18, 0x3c, 0x6e,
+    0x4c, 0x8, 0x0,
 
     /* U+F00B0 "󰂰" */
-    0x0, 0xa, 0x20, 0x0, 0x0, 0x70, 0xcd, 0x20,
-    0x0, 0x9, 0x9c, 0x8b, 0x8, 0x0, 0x9, 0xfc,
-    0x33, 0xb0, 0x0, 0x4f, 0x95, 0x5b, 0x0, 0x4c,
-    0xda, 0x70, 0xa0, 0xb, 0x1c, 0xc5, 0x0, 0x0,
-    0x0, 0xc5, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0,
-    0x0,
+    0x10, 0xc, 0x1f, 0x47, 0x21, 0x91, 0xc9, 0x60,
+    0x20, 0x0, 0x0,
 
     /* U+F00B1 "󰂱" */
-    0x0, 0x0, 0xb2, 0x0, 0x0, 0x6, 0xc, 0xd2,
-    0x0, 0x0, 0x98, 0xd8, 0xa0, 0x0, 0x61, 0x9f,
-    0xc1, 0x60, 0xa, 0x35, 0xf8, 0x1b, 0x10, 0x5,
-    0xcd, 0xa8, 0x0, 0x1, 0xb0, 0xcc, 0x50, 0x0,
-    0x0, 0xc, 0x50, 0x0, 0x0, 0x0, 0x20, 0x0,
-    0x0,
+    0x8, 0x6, 0xf, 0x83, 0x84, 0xd0, 0xf0, 0xb0,
+    0x10, 0x0, 0x0,
 
     /* U+F00B2 "󰂲" */
-    0x0, 0x0, 0x20, 0x0, 0x0, 0x10, 0xe, 0x50,
-    0x0, 0xd, 0x50, 0xed, 0x50, 0x0, 0x1d, 0x57,
-    0x6e, 0x0, 0x0, 0x1d, 0x56, 0x20, 0x0, 0x0,
-    0x5f, 0x50, 0x0, 0x0, 0x4d, 0xfd, 0x50, 0x0,
-    0x4d, 0x2e, 0x6f, 0x50, 0x2, 0x20, 0xed, 0x3c,
-    0x0, 0x0, 0xc, 0x20, 0x0,
+    0x0, 0x4, 0x13, 0x4, 0x41, 0x0, 0x40, 0x70,
+    0x54, 0xd, 0x4, 0x0,
 
     /* U+F00B3 "󰂳" */
-    0x0, 0x66, 0x0, 0x51, 0x6f, 0x60, 0x5c, 0x68,
-    0xf2, 0x6, 0xff, 0x60, 0x0, 0xcb, 0x0, 0x9,
-    0xed, 0x70, 0x7a, 0x67, 0xe1, 0x30, 0x6f, 0x30,
-    0x0, 0x54, 0x0, 0x1, 0x0, 0x10, 0xa, 0x44,
-    0xb0,
+    0x0, 0x45, 0x8c, 0x31, 0xc4, 0x84, 0x0, 0x4,
+    0x80,
 
     /* U+F00B4 "󰂴" */
-    0x0, 0x30, 0x0, 0x0, 0x10, 0xc7, 0x0, 0x50,
-    0xa5, 0xba, 0x66, 0xf2, 0xb, 0xec, 0x10, 0xb0,
-    0x3, 0xf6, 0x0, 0x30, 0x3c, 0xdb, 0x52, 0xc1,
-    0x91, 0xcc, 0x33, 0xd1, 0x0, 0xb3, 0x0, 0x0,
+    0x0, 0x20, 0xb2, 0x72, 0x20, 0x72, 0xb2, 0x20,
 
     /* U+F03A0 "󰎠" */
-    0x98, 0x6b, 0x65, 0xc6, 0xb, 0x3, 0xb0, 0x3b,
-    0xb, 0x79, 0x30, 0x59, 0xb, 0x8c, 0x95, 0xc9,
+    0xd2, 0x49, 0x51, 0x7b,
 
     /* U+F03A1 "󰎡" */
-    0x69, 0x99, 0x99, 0x81, 0xff, 0xff, 0xff, 0xf6,
-    0xff, 0xa1, 0x5f, 0xf6, 0xff, 0x7b, 0x2f, 0xf6,
-    0xff, 0x7b, 0x2f, 0xf6, 0xff, 0x85, 0x2f, 0xf6,
-    0xff, 0xfa, 0xdf, 0xf6, 0xcf, 0xff, 0xff, 0xf3,
+    0x7e, 0xfe, 0xe6, 0xd6, 0xd6, 0xe6, 0xfe, 0xfe,
 
     /* U+F03A2 "󰎢" */
-    0x1, 0x55, 0x55, 0x51, 0xa, 0x55, 0x55, 0x69,
-    0xaa, 0x8, 0xb4, 0x19, 0xaa, 0xa, 0x56, 0x19,
-    0xaa, 0x9, 0xb4, 0x19, 0xaa, 0x22, 0x32, 0x39,
-    0xa4, 0x99, 0x99, 0x93, 0xca, 0xaa, 0xaa, 0x0,
+    0x0, 0x41, 0xd9, 0xd1, 0xd9, 0xc1, 0xbe, 0xfc,
 
     /* U+F03A3 "󰎣" */
-    0x47, 0x77, 0x77, 0x60, 0xd5, 0x55, 0x55, 0xc2,
-    0xd0, 0x6d, 0x90, 0xa2, 0xd0, 0xb1, 0xd0, 0xa2,
-    0xd0, 0xc1, 0xd0, 0xa2, 0xd0, 0xb8, 0xd0, 0xa2,
-    0xd0, 0x15, 0x20, 0xa2, 0xcd, 0xdd, 0xdd, 0xd1,
+    0x0, 0x82, 0x9a, 0xaa, 0xaa, 0xba, 0x82, 0xfe,
 
     /* U+F03A4 "󰎤" */
-    0x69, 0x99, 0x99, 0x80, 0xff, 0xff, 0xff, 0xf2,
-    0xff, 0xd0, 0xbf, 0xf2, 0xff, 0xfa, 0xbf, 0xf2,
-    0xff, 0xfa, 0xbf, 0xf2, 0xff, 0xfa, 0xbf, 0xf2,
-    0xff, 0xfe, 0xef, 0xf2, 0xcf, 0xff, 0xff, 0xe1,
+    0x7e, 0xfe, 0xee, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
 
     /* U+F03A5 "󰎥" */
-    0x1, 0x55, 0x55, 0x51, 0xa, 0x55, 0x55, 0x69,
-    0xaa, 0x3, 0xe0, 0x19, 0xaa, 0x0, 0xa0, 0x19,
-    0xaa, 0x0, 0xa0, 0x19, 0xaa, 0x0, 0x30, 0x19,
-    0xa4, 0xaa, 0xaa, 0xa4, 0xca, 0xaa, 0xaa, 0x0,
+    0x0, 0x41, 0xc9, 0xc9, 0xc9, 0xc1, 0xbe, 0xfc,
 
     /* U+F03A6 "󰎦" */
-    0x47, 0x77, 0x77, 0x60, 0xd5, 0x55, 0x55, 0xc2,
-    0xd0, 0xc, 0x90, 0xa2, 0xd0, 0x1, 0xb0, 0xa2,
-    0xd0, 0x1, 0xb0, 0xa2, 0xd0, 0x1, 0xb0, 0xa2,
-    0xd0, 0x0, 0x30, 0xa2, 0xcd, 0xdd, 0xdd, 0xd1,
+    0x0, 0x82, 0x9a, 0x8a, 0x8a, 0x8a, 0x82, 0xfe,
 
     /* U+F03A7 "󰎧" */
-    0x36, 0x66, 0x66, 0x50, 0xff, 0xff, 0xff, 0xf5,
-    0xff, 0x93, 0x8f, 0xf6, 0xff, 0xfd, 0x2f, 0xf6,
-    0xff, 0x93, 0x8f, 0xf6, 0xff, 0x76, 0x9f, 0xf6,
-    0xff, 0xca, 0xaf, 0xf6, 0xcf, 0xff, 0xff, 0xf3,
+    0x0, 0xfe, 0xee, 0xf6, 0xee, 0xce, 0xfe, 0xfe,
 
     /* U+F03A8 "󰎨" */
-    0x1, 0x55, 0x55, 0x51, 0xa, 0x55, 0x55, 0x69,
-    0xaa, 0x7, 0xb4, 0x19, 0xaa, 0x6, 0xa3, 0x19,
-    0xaa, 0xa, 0x93, 0x19, 0xaa, 0x23, 0x33, 0x39,
-    0xa4, 0x99, 0x99, 0x93, 0xca, 0xaa, 0xaa, 0x0,
+    0x0, 0x41, 0xc9, 0xc9, 0xd9, 0xc1, 0xbe, 0xfc,
 
     /* U+F03A9 "󰎩" */
-    0x12, 0x22, 0x22, 0x10, 0xda, 0xaa, 0xaa, 0xd1,
-    0xd0, 0x69, 0x50, 0xa2, 0xd0, 0x23, 0xd0, 0xa2,
-    0xd0, 0x9d, 0x80, 0xa2, 0xd0, 0xb7, 0x50, 0xa2,
-    0xd0, 0x46, 0x50, 0xa2, 0xcd, 0xdd, 0xdd, 0xd1,
+    0x0, 0xfe, 0x92, 0x8a, 0xba, 0xa2, 0x82, 0xfe,
 
     /* U+F03AA "󰎪" */
-    0x36, 0x66, 0x66, 0x50, 0xff, 0xff, 0xff, 0xf5,
-    0xff, 0x93, 0x8f, 0xf6, 0xff, 0xfd, 0x2f, 0xf6,
-    0xff, 0xf7, 0x5f, 0xf6, 0xff, 0xc8, 0x2f, 0xf6,
-    0xff, 0xca, 0xdf, 0xf6, 0xcf, 0xff, 0xff, 0xf3,
+    0x0, 0xfe, 0xee, 0xf6, 0xe6, 0xf6, 0xfe, 0xfe,
 
     /* U+F03AB "󰎫" */
-    0x1, 0x55, 0x55, 0x51, 0x9, 0x65, 0x55, 0x69,
-    0xa9, 0x14, 0xa7, 0x19, 0xa9, 0x10, 0x77, 0x19,
-    0xa9, 0x13, 0x98, 0x19, 0xa9, 0x33, 0x32, 0x39,
-    0xa3, 0x99, 0x99, 0x93, 0xca, 0xaa, 0xaa, 0x0,
+    0x0, 0x41, 0xc9, 0xc1, 0xcd, 0xc1, 0xbe, 0xfc,
 
     /* U+F03AC "󰎬" */
-    0x12, 0x22, 0x22, 0x10, 0xda, 0xaa, 0xaa, 0xd1,
-    0xd0, 0x49, 0x50, 0xa2, 0xd0, 0x13, 0xd0, 0xa2,
-    0xd0, 0x9, 0xb0, 0xa2, 0xd0, 0x36, 0xd0, 0xa2,
-    0xd0, 0x36, 0x30, 0xa2, 0xcd, 0xdd, 0xdd, 0xd1,
+    0x0, 0xfe, 0x92, 0x8a, 0x9a, 0x8a, 0x82, 0xfe,
 
     /* U+F03AD "󰎭" */
-    0x69, 0x99, 0x99, 0x81, 0xff, 0xff, 0xff, 0xf6,
-    0xff, 0x7b, 0x3f, 0xf6, 0xff, 0x77, 0x2f, 0xf6,
-    0xff, 0x94, 0x1f, 0xf6, 0xff, 0xff, 0x2f, 0xf6,
-    0xff, 0xff, 0xbf, 0xf6, 0xcf, 0xff, 0xff, 0xf3,
+    0x7e, 0xfe, 0xd6, 0xc6, 0xe6, 0xf6, 0xfe, 0xfe,
 
     /* U+F03AE "󰎮" */
-    0x12, 0x22, 0x22, 0x10, 0xda, 0xaa, 0xaa, 0xd1,
-    0xd0, 0x60, 0x70, 0xa2, 0xd0, 0xb0, 0xd0, 0xa2,
-    0xd0, 0x9c, 0xe0, 0xa2, 0xd0, 0x0, 0xd0, 0xa2,
-    0xd0, 0x0, 0x50, 0xa2, 0xcd, 0xdd, 0xdd, 0xd1,
+    0x0, 0xfe, 0x82, 0xaa, 0xba, 0x8a, 0x82, 0xfe,
 
     /* U+F03AF "󰎯" */
-    0x1, 0x55, 0x55, 0x51, 0xa, 0x55, 0x55, 0x69,
-    0xaa, 0xa, 0xa3, 0x19, 0xaa, 0x9, 0x92, 0x19,
-    0xaa, 0x6, 0xb4, 0x19, 0xaa, 0x23, 0x32, 0x39,
-    0xa4, 0x99, 0x99, 0x93, 0xca, 0xaa, 0xaa, 0x0,
+    0x0, 0x41, 0xd9, 0xd9, 0xc9, 0xc1, 0xbe, 0xfc,
 
     /* U+F03B0 "󰎰" */
-    0x12, 0x22, 0x22, 0x10, 0xda, 0xaa, 0xaa, 0xd1,
-    0xd0, 0x69, 0x80, 0xa2, 0xd0, 0xb4, 0x30, 0xa2,
-    0xd0, 0x9c, 0xb0, 0xa2, 0xd0, 0x46, 0xd0, 0xa2,
-    0xd0, 0x46, 0x30, 0xa2, 0xcd, 0xdd, 0xdd, 0xd1,
+    0x0, 0xfe, 0x9a, 0xa2, 0xba, 0x8a, 0x82, 0xfe,
 
     /* U+F03B1 "󰎱" */
-    0x36, 0x66, 0x66, 0x50, 0xff, 0xff, 0xff, 0xf5,
-    0xff, 0x93, 0x4f, 0xf6, 0xff, 0x79, 0xef, 0xf6,
-    0xff, 0x94, 0x3f, 0xf6, 0xff, 0xc8, 0x2f, 0xf6,
-    0xff, 0xca, 0xdf, 0xf6, 0xcf, 0xff, 0xff, 0xf3,
+    0x0, 0xfe, 0xe6, 0xde, 0xe6, 0xf6, 0xfe, 0xfe,
 
     /* U+F04C5 "󰓅" */
-    0x1, 0xac, 0xc4, 0x0, 0x3c, 0x20, 0x6, 0x70,
-    0xb1, 0x3, 0xce, 0x35, 0xb0, 0x1f, 0xf5, 0x39,
-    0xc0, 0xc, 0xa0, 0x48, 0x86, 0x0, 0x0, 0xb2,
-    0x5, 0x0, 0x0, 0x40,
+    0x38, 0x40, 0x8c, 0x99, 0x99, 0x82, 0x0,
 
     /* U+F0553 "󰕓" */
-    0x0, 0x9, 0x20, 0x0, 0x0, 0x5f, 0xc0, 0x0,
-    0x0, 0xb, 0x30, 0x0, 0xaf, 0x2b, 0x3e, 0xf1,
-    0xaf, 0x2b, 0x3e, 0xf1, 0x3c, 0xb, 0x36, 0x90,
-    0x1e, 0xff, 0xff, 0x60, 0x0, 0xb, 0x30, 0x0,
-    0x0, 0xd, 0x50, 0x0, 0x0, 0x4f, 0xc0, 0x0,
-    0x0, 0x8, 0x30, 0x0,
+    0x10, 0x18, 0x10, 0xd6, 0xd6, 0x52, 0x7c, 0x10,
+    0x10, 0x18, 0x10,
 
     /* U+F0632 "󰘲" */
-    0x0, 0x9, 0x50, 0x0, 0x0, 0x97, 0xa5, 0x0,
-    0x9, 0x70, 0xa, 0x50, 0x5b, 0xc0, 0xe, 0xb2,
-    0x0, 0xc0, 0xc, 0x0, 0x0, 0xcb, 0xb9, 0x0,
-    0x0, 0x77, 0x75, 0x0, 0x0, 0xd4, 0x4c, 0x0,
-    0x0, 0xcc, 0xc9, 0x0,
+    0x10, 0x28, 0x44, 0x66, 0x24, 0x3c, 0x0, 0x24,
+    0x3c,
 
     /* U+F0633 "󰘳" */
-    0x28, 0x20, 0x8, 0x70, 0xc3, 0xb0, 0x95, 0x77,
-    0xc0, 0xb0, 0xb0, 0x58, 0x4b, 0xeb, 0xeb, 0x90,
-    0x0, 0xb0, 0xb0, 0x0, 0x7b, 0xeb, 0xeb, 0xb2,
-    0xc0, 0xc0, 0xb0, 0x38, 0x8c, 0x70, 0x4c, 0xc3,
+    0x44, 0xa8, 0xa9, 0x7e, 0x28, 0x7e, 0xa9, 0xc6,
 
     /* U+F0634 "󰘴" */
-    0x0, 0x9, 0x20, 0x0, 0x0, 0xac, 0xe2, 0x0,
-    0xa, 0xa0, 0x4e, 0x20, 0xaa, 0x0, 0x4, 0xe2,
-    0x30, 0x0, 0x0, 0x30,
+    0x10, 0x38, 0x64, 0xc2, 0x0,
 
     /* U+F0635 "󰘵" */
-    0x2d, 0xd8, 0x9, 0xdd, 0x20, 0x0, 0xd0, 0x0,
-    0x0, 0x0, 0x7, 0x70, 0x0, 0x0, 0x0, 0xd,
-    0x0, 0x0, 0x0, 0x0, 0x77, 0x0, 0x0, 0x0,
-    0x0, 0xd0, 0x0, 0x0, 0x0, 0x7, 0xdd, 0x20,
+    0x77, 0x8, 0x0, 0x1, 0x0, 0x0, 0x20, 0xc,
 
     /* U+F0636 "󰘶" */
-    0x0, 0x5, 0x20, 0x0, 0x0, 0x5b, 0xc2, 0x0,
-    0x5, 0xa0, 0x1c, 0x20, 0x5f, 0x90, 0xd, 0xe2,
-    0x0, 0xc0, 0xc, 0x0, 0x0, 0xeb, 0xbc, 0x0,
-    0x0, 0x11, 0x10, 0x0,
+    0x0, 0x18, 0x24, 0x66, 0x24, 0x3c, 0x0,
 
     /* U+F093E "󰤾" */
-    0x6, 0x60, 0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0,
-    0xb0, 0x9, 0x20, 0x10, 0xb0, 0x9, 0x24, 0xa2,
-    0xb0, 0x9, 0x23, 0xc0, 0xb0, 0x9, 0x26, 0xb2,
-    0xd7, 0x7c, 0x20, 0x30, 0xef, 0xfe, 0x10, 0x0,
+    0x0, 0xf0, 0x90, 0x92, 0x92, 0x92, 0x90, 0xf0,
 
     /* U+F093F "󰤿" */
-    0x6, 0x60, 0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0,
-    0xb0, 0x9, 0x20, 0x10, 0xb0, 0x9, 0x24, 0xa2,
-    0xb0, 0x9, 0x23, 0xc0, 0xb0, 0x9, 0x27, 0xb2,
-    0xfd, 0xde, 0x20, 0x30, 0xef, 0xfe, 0x10, 0x0,
+    0x0, 0xf0, 0x90, 0x92, 0x92, 0x92, 0xf0, 0xf0,
 
     /* U+F0940 "󰥀" */
-    0x6, 0x60, 0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0,
-    0xb0, 0x9, 0x20, 0x10, 0xb0, 0x9, 0x24, 0xa2,
-    0xb0, 0x9, 0x23, 0xc0, 0xe9, 0x9d, 0x27, 0xb2,
-    0xff, 0xff, 0x20, 0x30, 0xef, 0xfe, 0x10, 0x0,
+    0x0, 0xf0, 0x90, 0x92, 0x92, 0xf2, 0xf0, 0xf0,
 
     /* U+F0941 "󰥁" */
-    0x6, 0x60, 0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0,
-    0xb0, 0x9, 0x20, 0x10, 0xb0, 0x9, 0x24, 0xa2,
-    0xb0, 0x9, 0x23, 0xc0, 0xff, 0xff, 0x26, 0xb2,
-    0xff, 0xff, 0x20, 0x30, 0xde, 0xee, 0x10, 0x0,
+    0x0, 0xf0, 0x90, 0x92, 0x92, 0xf2, 0xf0, 0xf0,
 
     /* U+F0942 "󰥂" */
-    0x6, 0x60, 0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0,
-    0xb0, 0x9, 0x20, 0x10, 0xb0, 0x9, 0x24, 0xa1,
-    0xc4, 0x4b, 0x23, 0xc0, 0xff, 0xff, 0x26, 0xb2,
-    0xff, 0xff, 0x20, 0x30, 0xef, 0xfe, 0x10, 0x0,
+    0x0, 0xf0, 0x90, 0x92, 0x92, 0xf2, 0xf0, 0xf0,
 
     /* U+F0943 "󰥃" */
-    0x6, 0x60, 0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0,
-    0xb0, 0x9, 0x20, 0x10, 0xb0, 0x9, 0x24, 0xa1,
-    0xea, 0xad, 0x23, 0xc0, 0xff, 0xff, 0x26, 0xb2,
-    0xff, 0xff, 0x20, 0x30, 0xef, 0xfe, 0x10, 0x0,
+    0x0, 0xf0, 0x90, 0x92, 0xf2, 0xf2, 0xf0, 0xf0,
 
     /* U+F0944 "󰥄" */
-    0x6, 0x60, 0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0,
-    0xb0, 0x9, 0x20, 0x0, 0xd6, 0x6c, 0x24, 0xa1,
-    0xff, 0xff, 0x23, 0xc0, 0xff, 0xff, 0x26, 0xb2,
-    0xff, 0xff, 0x20, 0x30, 0xef, 0xfe, 0x10, 0x0,
+    0x0, 0xf0, 0x90, 0x92, 0xf2, 0xf2, 0xf0, 0xf0,
 
     /* U+F0945 "󰥅" */
-    0x6, 0x60, 0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0,
-    0xb0, 0x9, 0x20, 0x0, 0xeb, 0xbe, 0x23, 0xa1,
-    0xff, 0xff, 0x23, 0xc0, 0xff, 0xff, 0x26, 0xb2,
-    0xff, 0xff, 0x20, 0x30, 0xef, 0xfe, 0x10, 0x0,
+    0x0, 0xf0, 0x90, 0xf2, 0xf2, 0xf2, 0xf0, 0xf0,
 
     /* U+F0946 "󰥆" */
-    0x4, 0x40, 0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0,
-    0xc4, 0x4b, 0x20, 0x0, 0xff, 0xff, 0x23, 0x91,
-    0xff, 0xff, 0x23, 0xc0, 0xff, 0xff, 0x26, 0xb2,
-    0xff, 0xff, 0x20, 0x30, 0xef, 0xfe, 0x10, 0x0,
+    0x0, 0xf0, 0x90, 0xf2, 0xf2, 0xf2, 0xf0, 0xf0,
 
     /* U+F0947 "󰥇" */
-    0x3, 0x30, 0x0, 0x0, 0x7f, 0xfa, 0x10, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0xfc, 0x7f, 0x43, 0x91,
-    0xfc, 0x7f, 0x43, 0xc0, 0xff, 0xdf, 0x46, 0xc2,
-    0xfe, 0xbf, 0x40, 0x30, 0xef, 0xff, 0x30, 0x0,
+    0x0, 0x70, 0xf0, 0xd2, 0xd2, 0xf2, 0xf0, 0xf0,
 
     /* U+F0948 "󰥈" */
-    0x4, 0x41, 0x0, 0x0, 0x8f, 0xfa, 0x20, 0x0,
-    0xff, 0xff, 0x50, 0x0, 0xff, 0xff, 0x53, 0x91,
-    0xff, 0xff, 0x53, 0xc0, 0xff, 0xff, 0x56, 0xb2,
-    0xff, 0xff, 0x50, 0x30, 0xef, 0xff, 0x40, 0x0,
+    0x0, 0xf0, 0xf0, 0xf2, 0xf2, 0xf2, 0xf0, 0xf0,
 
     /* U+F0949 "󰥉" */
-    0x0, 0xaf, 0xf7, 0x0, 0x1b, 0xef, 0xfd, 0xa0,
-    0x4f, 0xff, 0xff, 0xf1, 0x4f, 0xfd, 0xaf, 0xf1,
-    0x4f, 0x9a, 0x3b, 0xf1, 0x4f, 0xf5, 0x3e, 0xf1,
-    0x4f, 0xf4, 0x3e, 0xf1, 0x4f, 0x9b, 0x3c, 0xf1,
-    0x4f, 0xfd, 0xbf, 0xf1, 0x4f, 0xff, 0xff, 0xf1,
-    0x1c, 0xcc, 0xcc, 0xb0,
+    0x38, 0x7e, 0x7e, 0x7e, 0x76, 0x66, 0x66, 0x76,
+    0x7e, 0x7e, 0x7e,
 
     /* U+F094A "󰥊" */
-    0x4, 0x40, 0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0,
-    0xf5, 0x4f, 0x20, 0x0, 0xda, 0x9a, 0x24, 0x91,
-    0xff, 0x5e, 0x23, 0xc0, 0xff, 0xdf, 0x26, 0xb2,
-    0xfd, 0xcf, 0x20, 0x30, 0xef, 0xfe, 0x10, 0x0,
+    0x0, 0xf0, 0x90, 0xf2, 0xd2, 0xf2, 0xf0, 0xf0,
 
     /* U+F0A1E "󰨞" */
-    0x0, 0x0, 0x1, 0x30, 0x0, 0x0, 0x1, 0xdf,
-    0xc1, 0x7, 0x2, 0xdf, 0xef, 0x20, 0xcd, 0xee,
-    0x4a, 0xf2, 0x5, 0xff, 0x80, 0xaf, 0x21, 0xf8,
-    0xaf, 0xab, 0xf2, 0x1, 0x0, 0x9f, 0xff, 0x20,
-    0x0, 0x0, 0x8d, 0x60,
+    0x0, 0x3, 0x83, 0xcf, 0x63, 0xb3, 0xf8, 0x3c,
+    0xc,
 
     /* U+F0EB7 "󰺷" */
-    0x1a, 0x99, 0x9a, 0x70, 0xa2, 0x40, 0x5, 0x76,
-    0xa8, 0xc0, 0x54, 0x29, 0x94, 0x49, 0x71, 0x84,
-    0x7, 0x82, 0x68, 0x30,
+    0x7c, 0x80, 0xe1, 0x92, 0x24,
 
     /* U+F0F2D "󰼭" */
-    0x0, 0x11, 0x11, 0x0, 0x8, 0xb9, 0x9d, 0x0,
-    0x8, 0xdd, 0xee, 0x0, 0x7e, 0xff, 0xff, 0xb0,
-    0x39, 0x30, 0x9, 0x70, 0xbf, 0xfd, 0xef, 0xf1,
-    0xfa, 0xbe, 0x9c, 0xe5, 0xac, 0xcc, 0xcc, 0xc2,
+    0x0, 0x7c, 0x7c, 0x7e, 0x44, 0xfe, 0xfe, 0xfe,
 
     /* U+F0F85 "󰾅" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x3, 0x0,
-    0xb, 0x4c, 0x29, 0x70, 0x93, 0xf, 0x60, 0xa3,
-    0xb0, 0x4f, 0xa0, 0x38, 0xc0, 0x4f, 0xa0, 0x39,
-    0xa2, 0x2, 0x0, 0x84, 0x17, 0x0, 0x0, 0x90,
+    0x0, 0x0, 0x54, 0x92, 0x99, 0x99, 0x82, 0x2,
 
     /* U+F0F86 "󰾆" */
-    0x0, 0x9c, 0xc7, 0x0, 0xa, 0x30, 0x6, 0xa0,
-    0x85, 0xf9, 0x10, 0x75, 0xc0, 0xcf, 0xa0, 0x29,
-    0xc0, 0x2d, 0x70, 0x48, 0x85, 0x0, 0x0, 0xb2,
-    0x4, 0x0, 0x1, 0x40,
+    0x38, 0x42, 0xb0, 0xb9, 0x91, 0x82, 0x0,
 
     /* U+F11F0 "󱇰" */
-    0x4e, 0xff, 0xff, 0x90, 0x79, 0x0, 0x4, 0xd0,
-    0x79, 0x10, 0x13, 0xd0, 0x79, 0xd2, 0xb7, 0xd0,
-    0x79, 0x0, 0x3, 0xd0, 0xff, 0xee, 0xee, 0xf5,
-    0xff, 0xff, 0xff, 0xf6, 0xaf, 0xff, 0xff, 0xe2,
-    0xb, 0xff, 0xfe, 0x20, 0x0, 0xef, 0xf5, 0x0,
-    0x0, 0x55, 0x51, 0x0
+    0x7e, 0x42, 0x42, 0x6a, 0x42, 0xfe, 0xfe, 0xfe,
+    0x7c, 0x38, 0x0
 };
 
 
@@ -573,86 +314,86 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 118, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 28, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 60, .adv_w = 118, .box_w = 9, .box_h = 10, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 105, .adv_w = 118, .box_w = 8, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 125, .adv_w = 118, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 165, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 209, .adv_w = 118, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 248, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 292, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 336, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 380, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 424, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 468, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 512, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 556, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 600, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 644, .adv_w = 118, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 683, .adv_w = 118, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 722, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 754, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 786, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 818, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 850, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 882, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 914, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 946, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 990, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1022, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1066, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1110, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1142, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1186, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1230, .adv_w = 118, .box_w = 9, .box_h = 9, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 1271, .adv_w = 118, .box_w = 9, .box_h = 9, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 1312, .adv_w = 118, .box_w = 9, .box_h = 10, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 1357, .adv_w = 118, .box_w = 6, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 1390, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1422, .adv_w = 118, .box_w = 8, .box_h = 4, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 1438, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1470, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1502, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1534, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1566, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1598, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1630, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1662, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1694, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1726, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1758, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1790, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1822, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1854, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1886, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1918, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1950, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1982, .adv_w = 118, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2010, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2054, .adv_w = 118, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 2090, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2122, .adv_w = 118, .box_w = 8, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 2142, .adv_w = 118, .box_w = 9, .box_h = 7, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 2174, .adv_w = 118, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2202, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2234, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2266, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2298, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2330, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2362, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2394, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2426, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2458, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2490, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2522, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2554, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 2598, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2630, .adv_w = 118, .box_w = 9, .box_h = 8, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 2666, .adv_w = 118, .box_w = 8, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 2686, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2718, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2750, .adv_w = 118, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2778, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2}
+    {.bitmap_index = 7, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15, .adv_w = 118, .box_w = 9, .box_h = 10, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 27, .adv_w = 118, .box_w = 8, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 32, .adv_w = 118, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 42, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 53, .adv_w = 118, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 63, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 74, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 85, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 96, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 107, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 118, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 129, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 140, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 151, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 162, .adv_w = 118, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 172, .adv_w = 118, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 182, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 190, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 198, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 206, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 214, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 222, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 230, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 238, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 249, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 257, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 268, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 279, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 287, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 298, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 309, .adv_w = 118, .box_w = 9, .box_h = 9, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 320, .adv_w = 118, .box_w = 9, .box_h = 9, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 331, .adv_w = 118, .box_w = 9, .box_h = 10, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 343, .adv_w = 118, .box_w = 6, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 352, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 360, .adv_w = 118, .box_w = 8, .box_h = 4, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 364, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 372, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 380, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 388, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 396, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 404, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 412, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 420, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 428, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 436, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 444, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 452, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 460, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 468, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 476, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 484, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 492, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 500, .adv_w = 118, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 507, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 518, .adv_w = 118, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 527, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 535, .adv_w = 118, .box_w = 8, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 540, .adv_w = 118, .box_w = 9, .box_h = 7, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 548, .adv_w = 118, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 555, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 563, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 571, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 579, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 587, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 595, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 603, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 611, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 619, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 627, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 635, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 643, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 654, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 662, .adv_w = 118, .box_w = 9, .box_h = 8, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 671, .adv_w = 118, .box_w = 8, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 676, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 684, .adv_w = 118, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 692, .adv_w = 118, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 699, .adv_w = 118, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2}
 };
 
 /*---------------------
@@ -717,7 +458,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .kern_dsc = NULL,
     .kern_scale = 0,
     .cmap_num = 5,
-    .bpp = 4,
+    .bpp = 1,
     .kern_classes = 0,
     .bitmap_format = 0,
 #if LVGL_VERSION_MAJOR == 8
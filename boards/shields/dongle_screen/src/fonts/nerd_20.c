@@ -1,7 +1,8 @@
 /*******************************************************************************
  * Size: 20 px
- * Bpp: 4
+ * Bpp: 1
  * Opts: --bpp 4 --size 20 --no-compress --stride 1 --align 1 --font FiraCodeNerdFontMono-Regular.ttf --range 983215,983216-983220,985406-985418,62087,984403,987632,62711,983968-983985,57943,987014,987014,987013,984261,986807,986925,985630,61818,61820,62210,984627,984626,984628,984629,984630,983161-983185 --format lvgl -o nerd_20.c
+ * Converted: lvgl_font.py to-1bpp from the --bpp 4 output, coverage >= 50% kept, no hinting
  ******************************************************************************/
 
 #ifdef __has_include
@@ -33,1113 +34,432 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+E257 "" */
-    0x0, 0x0, 0x4b, 0xc6, 0x0, 0x0, 0x0, 0x17,
-    0xdf, 0xff, 0xff, 0x92, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x10, 0x5c, 0xff, 0xff, 0xff,
-    0xe7, 0x10, 0x66, 0x3, 0xaf, 0xfc, 0x50, 0x48,
-    0x12, 0x8d, 0x92, 0x12, 0x17, 0xda, 0x40, 0x33,
-    0x6, 0xcc, 0xbd, 0x81, 0x15, 0x4, 0xbc, 0x60,
-    0x35, 0x4, 0xad, 0x60, 0x0, 0x28, 0xd9, 0x8d,
-    0xa4, 0x0, 0x0, 0x0, 0x0, 0x68, 0x10, 0x0,
+    0x6, 0x0, 0xfe, 0x3f, 0xfc, 0x7f, 0x80, 0xf1,
+    0x38, 0x30, 0x3e, 0xc, 0xc, 0x1f, 0x80, 0x10,
     0x0,
 
     /* U+F17A "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x10, 0x0,
-    0x13, 0x28, 0xac, 0xef, 0xf5, 0xac, 0xff, 0xf7,
-    0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0x7f, 0xff,
-    0xff, 0xf5, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
-    0x5f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xf5, 0x99,
-    0x99, 0x94, 0x99, 0x99, 0x99, 0x2d, 0xdd, 0xdd,
-    0x5d, 0xdd, 0xdd, 0xd4, 0xff, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0x5f, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0xf5, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x56,
-    0x8a, 0xcf, 0x7f, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x35, 0x79, 0xce, 0x40,
+    0x0, 0x0, 0x1f, 0xbe, 0xfd, 0xf7, 0xef, 0xbf,
+    0x7d, 0xfb, 0xef, 0xdf, 0x7e, 0xfb, 0xf7, 0xdf,
+    0xbe, 0xfc, 0xf7, 0xe0, 0x7, 0x0,
 
     /* U+F17C "" */
-    0x0, 0x0, 0x1, 0xac, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xc8, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0x68, 0x9a, 0x0, 0x0, 0x0, 0x0, 0x7, 0x1,
-    0xab, 0x0, 0x0, 0x0, 0x0, 0x2a, 0x65, 0x4f,
-    0x20, 0x0, 0x0, 0x0, 0xb5, 0x0, 0xe, 0xd0,
-    0x0, 0x0, 0x6, 0xd0, 0x0, 0x7, 0xe8, 0x0,
-    0x0, 0xc, 0x70, 0x0, 0x0, 0xcf, 0x0, 0x0,
-    0x4d, 0x20, 0x0, 0x0, 0x6f, 0x30, 0x0, 0x5a,
-    0x20, 0x0, 0x2, 0xfd, 0x20, 0x3, 0x20, 0xc3,
-    0x0, 0x2, 0x41, 0x30, 0x3, 0x0, 0x48, 0x0,
-    0x2, 0x0, 0x11, 0x3, 0x0, 0x5, 0x54, 0xa0,
-    0x0, 0x31, 0x2, 0x22, 0x15, 0x65, 0x71, 0x13,
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x2, 0x20, 0x0,
+    0x3, 0x80, 0x1e, 0x0, 0x7c, 0x1, 0x70, 0x0,
+    0xc0, 0x11, 0x0, 0x86, 0x2, 0xc, 0x10, 0x30,
+    0x40, 0x41, 0x3, 0x2, 0x0, 0x4, 0x0, 0x2,
+    0x0, 0x0, 0x0, 0x0,
 
     /* U+F287 "" */
-    0x0, 0x0, 0x2, 0x6d, 0x30, 0x0, 0x0, 0x0,
-    0x3, 0xaa, 0xf4, 0x0, 0x0, 0x18, 0x30, 0xb0,
-    0x1, 0x0, 0x31, 0xa, 0xfe, 0xce, 0xbb, 0xbb,
-    0xbd, 0xe3, 0x9f, 0xb0, 0xa, 0x20, 0x0, 0x65,
-    0x0, 0x40, 0x0, 0x38, 0x3, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xaa, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4d, 0xa0, 0x0,
+    0x1, 0x0, 0x38, 0x12, 0x1, 0xff, 0xee, 0x40,
+    0x1, 0x0, 0xf, 0x0, 0x18,
 
     /* U+F302 "" */
-    0x0, 0x0, 0x0, 0x0, 0x41, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xa0,
-    0x0, 0x0, 0x2, 0xae, 0xd8, 0x6a, 0xee, 0xa1,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0xe, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x5f, 0xfb, 0x9c, 0xff,
-    0x40, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0x0, 0x60, 0x6, 0x3, 0xde,
+    0x3f, 0xfb, 0xff, 0x9f, 0xf8, 0xff, 0xc7, 0xff,
+    0x3f, 0xf8, 0xff, 0xe7, 0xff, 0x1f, 0xf0, 0x7f,
+    0x0, 0x0,
 
     /* U+F4F7 "" */
-    0x0, 0x7b, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xa, 0xcf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x3,
-    0x99, 0x99, 0x70, 0x0, 0x8f, 0x10, 0x8, 0xff,
-    0xff, 0xf1, 0xd, 0xff, 0xf6, 0x0, 0x2, 0xef,
-    0x40, 0x8, 0xaa, 0xa3, 0x0, 0x1d, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfe, 0x50, 0x0,
-    0x12, 0x0, 0x0, 0x16, 0x8e, 0xf0, 0x6, 0xff,
-    0xd1, 0x0, 0x0, 0x8, 0xf2, 0xf, 0xd7, 0xf9,
-    0x8, 0xfa, 0xaf, 0xd0, 0x5, 0x10, 0xfa, 0x3,
-    0xcf, 0xfb, 0x20, 0x0, 0xb, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0x99, 0x95, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x1, 0xc0, 0x7, 0x0, 0xc, 0x0, 0x30,
+    0xf0, 0xc7, 0xe7, 0x83, 0x1e, 0x18, 0x0, 0xf0,
+    0x0, 0xe3, 0x81, 0x9b, 0x7e, 0xc, 0xf0, 0x60,
+    0x3, 0x80, 0x1c, 0x0, 0x7c, 0x0, 0xe0, 0x0,
 
     /* U+F0079 "󰁹" */
-    0x0, 0x6, 0xff, 0xff, 0xd0, 0x0, 0x1, 0x38,
-    0xff, 0xff, 0xe3, 0x20, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x6, 0xaa,
-    0xaa, 0xaa, 0xaa, 0x91,
+    0xf, 0x81, 0xf8, 0x7f, 0xe7, 0xff, 0x7f, 0xf7,
+    0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f,
+    0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff,
+    0x7f, 0xe3, 0xfe,
 
     /* U+F007A "󰁺" */
-    0x0, 0x5, 0xcc, 0xcc, 0xc0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf1, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x1f, 0xeb, 0xbb, 0xbb, 0xbc, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5, 0x88,
-    0x88, 0x88, 0x88, 0x82,
+    0xf, 0x80, 0xf8, 0x7f, 0xe7, 0xff, 0x60, 0x36,
+    0x3, 0x60, 0x36, 0x3, 0x60, 0x36, 0x3, 0x60,
+    0x36, 0x3, 0x60, 0x36, 0x3, 0x7f, 0xf7, 0xff,
+    0x7f, 0xf3, 0xfe,
 
     /* U+F007B "󰁻" */
-    0x0, 0x5, 0xcc, 0xcc, 0xc0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf1, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x1f, 0xeb, 0xbb, 0xbb, 0xbc, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x3, 0x66,
-    0x66, 0x66, 0x66, 0x61,
+    0xf, 0x80, 0xf8, 0x7f, 0xe7, 0xff, 0x60, 0x36,
+    0x3, 0x60, 0x36, 0x3, 0x60, 0x36, 0x3, 0x60,
+    0x36, 0x3, 0x60, 0x37, 0xff, 0x7f, 0xf7, 0xff,
+    0x7f, 0xf0, 0x0,
 
     /* U+F007C "󰁼" */
-    0x0, 0x5, 0xcc, 0xcc, 0xc0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf1, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x1f, 0xeb, 0xbb, 0xbb, 0xbc, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xc4, 0x44, 0x44, 0x45, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xa, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xd5,
+    0xf, 0x80, 0xf8, 0x7f, 0xe7, 0xff, 0x60, 0x36,
+    0x3, 0x60, 0x36, 0x3, 0x60, 0x36, 0x3, 0x60,
+    0x36, 0x3, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff,
+    0x7f, 0xf7, 0xfe,
 
     /* U+F007D "󰁽" */
-    0x0, 0x5, 0xcc, 0xcc, 0xc0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf1, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x1f, 0xeb, 0xbb, 0xbb, 0xbc, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xb2, 0x22, 0x22,
-    0x23, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xa, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xd5,
+    0xf, 0x80, 0xf8, 0x7f, 0xe7, 0xff, 0x60, 0x36,
+    0x3, 0x60, 0x36, 0x3, 0x60, 0x36, 0x3, 0x60,
+    0x37, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff,
+    0x7f, 0xf7, 0xfe,
 
     /* U+F007E "󰁾" */
-    0x0, 0x5, 0xcc, 0xcc, 0xc0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf1, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x1f, 0xeb, 0xbb, 0xbb, 0xbc, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xb1,
-    0x11, 0x11, 0x12, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xa, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xd5,
+    0xf, 0x80, 0xf8, 0x7f, 0xe7, 0xff, 0x60, 0x36,
+    0x3, 0x60, 0x36, 0x3, 0x60, 0x36, 0x3, 0x7f,
+    0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff,
+    0x7f, 0xf7, 0xfe,
 
     /* U+F007F "󰁿" */
-    0x0, 0x5, 0xcc, 0xcc, 0xc0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf1, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x1f, 0xeb, 0xbb, 0xbb, 0xbc, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb,
-    0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x8, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xb4,
+    0xf, 0x80, 0xf8, 0x7f, 0xe7, 0xff, 0x60, 0x36,
+    0x3, 0x60, 0x36, 0x3, 0x60, 0x37, 0xff, 0x7f,
+    0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff,
+    0x7f, 0xf7, 0xfe,
 
     /* U+F0080 "󰂀" */
-    0x0, 0x5, 0xcc, 0xcc, 0xc0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf1, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x1f, 0xeb, 0xbb, 0xbb, 0xbc, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x6, 0xaa,
-    0xaa, 0xaa, 0xaa, 0x93,
+    0xf, 0x80, 0xf8, 0x7f, 0xe7, 0xff, 0x60, 0x36,
+    0x3, 0x60, 0x37, 0xff, 0x7f, 0xf7, 0xff, 0x7f,
+    0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff,
+    0x7f, 0xf3, 0xfe,
 
     /* U+F0081 "󰂁" */
-    0x0, 0x5, 0xcc, 0xcc, 0xc0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf1, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x1f, 0xeb, 0xbb, 0xbb, 0xbc, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x4, 0x88,
-    0x88, 0x88, 0x88, 0x71,
+    0xf, 0x80, 0xf8, 0x7f, 0xe7, 0xff, 0x60, 0x36,
+    0x3, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f,
+    0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff,
+    0x7f, 0xf3, 0xfc,
 
     /* U+F0082 "󰂂" */
-    0x0, 0x5, 0xcc, 0xcc, 0xc0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf1, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x1f, 0xeb, 0xbb, 0xbb, 0xbc, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xfe,
-    0xee, 0xee, 0xee, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x3, 0x66,
-    0x66, 0x66, 0x66, 0x61,
+    0xf, 0x80, 0xf8, 0x7f, 0xe7, 0xff, 0x60, 0x37,
+    0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f,
+    0xf7, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff,
+    0x7f, 0xf0, 0x0,
 
     /* U+F0083 "󰂃" */
-    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x1, 0x39,
-    0xff, 0xff, 0xd3, 0x30, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x1f, 0xff,
-    0xf8, 0x5f, 0xff, 0xf6, 0x1f, 0xff, 0xf4, 0xe,
-    0xff, 0xf6, 0x1f, 0xff, 0xf4, 0xe, 0xff, 0xf6,
-    0x1f, 0xff, 0xf4, 0xe, 0xff, 0xf6, 0x1f, 0xff,
-    0xf4, 0xe, 0xff, 0xf6, 0x1f, 0xff, 0xfb, 0x9f,
-    0xff, 0xf6, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x1f, 0xff, 0xf6, 0x2f, 0xff, 0xf6, 0x1f, 0xff,
-    0xf4, 0xe, 0xff, 0xf6, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x5, 0x88,
-    0x88, 0x88, 0x88, 0x70,
+    0xf, 0x81, 0xf8, 0x7f, 0xe7, 0xfe, 0x7f, 0xe7,
+    0xde, 0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x7f,
+    0xe7, 0xfe, 0x79, 0xe7, 0x9e, 0x7f, 0xe7, 0xfe,
+    0x7f, 0xe3, 0xfc,
 
     /* U+F0084 "󰂄" */
-    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x1, 0x39,
-    0xff, 0xff, 0xd3, 0x20, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x2f, 0xff, 0xff, 0xef, 0xff, 0xf7, 0x2f, 0xff,
-    0xff, 0x7f, 0xff, 0xf7, 0x2f, 0xff, 0xfe, 0xf,
-    0xff, 0xf7, 0x2f, 0xff, 0xf6, 0xf, 0xff, 0xf7,
-    0x2f, 0xff, 0xd0, 0xf, 0xff, 0xf7, 0x2f, 0xff,
-    0x50, 0x4, 0x9f, 0xf7, 0x2f, 0xfc, 0x0, 0x0,
-    0xdf, 0xf7, 0x2f, 0xff, 0xf4, 0x6, 0xff, 0xf7,
-    0x2f, 0xff, 0xf4, 0xe, 0xff, 0xf7, 0x2f, 0xff,
-    0xf4, 0x7f, 0xff, 0xf7, 0x2f, 0xff, 0xf5, 0xef,
-    0xff, 0xf7, 0x2f, 0xff, 0xfc, 0xff, 0xff, 0xf7,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7, 0xaa,
-    0xaa, 0xaa, 0xaa, 0x91,
+    0xf, 0x81, 0xf8, 0x7f, 0xe7, 0xfe, 0x7f, 0xe7,
+    0xde, 0x7d, 0xe7, 0x9e, 0x79, 0xe7, 0xe, 0x70,
+    0xe7, 0x8e, 0x79, 0xe7, 0x9e, 0x7b, 0xe7, 0xfe,
+    0x7f, 0xe3, 0xfe,
 
     /* U+F0085 "󰂅" */
-    0x3, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xa, 0xef,
-    0xff, 0xea, 0x0, 0x2, 0x0, 0xff, 0xff, 0xff,
-    0xf0, 0x2, 0x80, 0xf, 0xff, 0xff, 0xff, 0x0,
-    0xa8, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x2f, 0x80,
-    0xf, 0xff, 0xff, 0xff, 0xa, 0xfd, 0xb1, 0xff,
-    0xff, 0xff, 0xf2, 0xff, 0xfb, 0xf, 0xff, 0xff,
-    0xff, 0x0, 0xaf, 0x40, 0xff, 0xff, 0xff, 0xf0,
-    0xa, 0xd0, 0xf, 0xff, 0xff, 0xff, 0x0, 0xa5,
-    0x0, 0xff, 0xff, 0xff, 0xf0, 0x8, 0x0, 0x8,
-    0xaa, 0xaa, 0xa8, 0x0, 0x10, 0x0,
+    0x38, 0x7, 0xf0, 0x3f, 0x89, 0xfc, 0xcf, 0xe6,
+    0x7f, 0x7b, 0xfb, 0xdf, 0xcc, 0xfe, 0x67, 0xf2,
+    0x3f, 0x91, 0xfc, 0x0,
 
     /* U+F0086 "󰂆" */
-    0x0, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xc0, 0x0, 0x30, 0xf, 0x53, 0x33, 0x5f, 0x0,
-    0x28, 0x0, 0xf2, 0x0, 0x2, 0xf0, 0xa, 0x80,
-    0xf, 0x20, 0x0, 0x2f, 0x2, 0xf8, 0x0, 0xf2,
-    0x0, 0x2, 0xf0, 0x9f, 0xdb, 0x1f, 0x20, 0x0,
-    0x2f, 0x2f, 0xff, 0xc0, 0xf2, 0x0, 0x2, 0xf1,
-    0x2a, 0xf5, 0xf, 0x30, 0x0, 0x3f, 0x0, 0x9d,
-    0x0, 0xff, 0xff, 0xff, 0xf0, 0x9, 0x60, 0xf,
-    0xff, 0xff, 0xff, 0x0, 0x80, 0x0, 0xbd, 0xdd,
-    0xdd, 0xb0, 0x2, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0x4, 0x48, 0x26,
+    0x41, 0x32, 0xb, 0xd0, 0x5e, 0x82, 0x64, 0x13,
+    0x3f, 0x91, 0xfc, 0x8f, 0xe0, 0x0,
 
     /* U+F0087 "󰂇" */
-    0x0, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xc0, 0x0, 0x30, 0xf, 0x53, 0x33, 0x5f, 0x0,
-    0x28, 0x0, 0xf2, 0x0, 0x2, 0xf0, 0x9, 0x80,
-    0xf, 0x20, 0x0, 0x2f, 0x1, 0xf8, 0x0, 0xf2,
-    0x0, 0x2, 0xf0, 0x9f, 0xda, 0x1f, 0x20, 0x0,
-    0x2f, 0x1f, 0xff, 0xc0, 0xf4, 0x22, 0x24, 0xf1,
-    0x3b, 0xf5, 0xf, 0xff, 0xff, 0xff, 0x0, 0xae,
-    0x0, 0xff, 0xff, 0xff, 0xf0, 0xa, 0x70, 0xf,
-    0xff, 0xff, 0xff, 0x0, 0x90, 0x0, 0xbe, 0xee,
-    0xee, 0xc0, 0x2, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0x4, 0x48, 0x26,
+    0x41, 0x32, 0xb, 0xd0, 0x5e, 0x82, 0x67, 0xf3,
+    0x3f, 0x91, 0xfc, 0x8f, 0xe0, 0x0,
 
     /* U+F0088 "󰂈" */
-    0x0, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xd0, 0x0, 0x30, 0xf, 0x53, 0x33, 0x5f, 0x0,
-    0x38, 0x0, 0xf2, 0x0, 0x2, 0xf0, 0xb, 0x80,
-    0xf, 0x20, 0x0, 0x2f, 0x3, 0xf8, 0x0, 0xf2,
-    0x0, 0x2, 0xf0, 0xbf, 0xfe, 0x1f, 0x20, 0x0,
-    0x2f, 0x2c, 0xef, 0xa0, 0xfe, 0xee, 0xee, 0xf0,
-    0xa, 0xf3, 0xf, 0xff, 0xff, 0xff, 0x0, 0xab,
-    0x0, 0xff, 0xff, 0xff, 0xf0, 0xa, 0x40, 0xf,
-    0xff, 0xff, 0xff, 0x0, 0x70, 0x0, 0x67, 0x77,
-    0x77, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0x4, 0x48, 0x26,
+    0x41, 0x32, 0xb, 0xd0, 0x5e, 0xfe, 0x67, 0xf3,
+    0x3f, 0x91, 0xfc, 0x0, 0x0, 0x0,
 
     /* U+F0089 "󰂉" */
-    0x0, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xc0, 0x0, 0x30, 0xf, 0x53, 0x33, 0x5f, 0x0,
-    0x38, 0x0, 0xf2, 0x0, 0x2, 0xf0, 0xb, 0x80,
-    0xf, 0x20, 0x0, 0x2f, 0x3, 0xf8, 0x0, 0xff,
-    0xff, 0xff, 0xf0, 0xbf, 0xfe, 0x1f, 0xff, 0xff,
-    0xff, 0x2c, 0xef, 0xa0, 0xff, 0xff, 0xff, 0xf0,
-    0xa, 0xf2, 0xf, 0xff, 0xff, 0xff, 0x0, 0xab,
-    0x0, 0xff, 0xff, 0xff, 0xf0, 0xa, 0x40, 0xf,
-    0xff, 0xff, 0xff, 0x0, 0x70, 0x0, 0x57, 0x77,
-    0x77, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0x4, 0x48, 0x26,
+    0x41, 0x33, 0xfb, 0xdf, 0xde, 0xfe, 0x67, 0xf3,
+    0x3f, 0x91, 0xfc, 0x0, 0x0, 0x0,
 
     /* U+F008A "󰂊" */
-    0x0, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xc0, 0x0, 0x30, 0xf, 0x53, 0x33, 0x5f, 0x0,
-    0x28, 0x0, 0xf2, 0x0, 0x2, 0xf0, 0xa, 0x80,
-    0xf, 0xff, 0xff, 0xff, 0x2, 0xf8, 0x0, 0xff,
-    0xff, 0xff, 0xf0, 0xaf, 0xec, 0x1f, 0xff, 0xff,
-    0xff, 0x2f, 0xff, 0xb0, 0xff, 0xff, 0xff, 0xf0,
-    0xa, 0xf4, 0xf, 0xff, 0xff, 0xff, 0x0, 0xac,
-    0x0, 0xff, 0xff, 0xff, 0xf0, 0xa, 0x50, 0xf,
-    0xff, 0xff, 0xff, 0x0, 0x80, 0x0, 0x7a, 0xaa,
-    0xaa, 0x80, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0x4, 0x48, 0x26,
+    0x7f, 0x33, 0xfb, 0xdf, 0xde, 0xfe, 0x67, 0xf3,
+    0x3f, 0x91, 0xfc, 0x87, 0xe0, 0x0,
 
     /* U+F008B "󰂋" */
-    0x0, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xc0, 0x0, 0x30, 0xf, 0x53, 0x33, 0x5f, 0x0,
-    0x28, 0x0, 0xf6, 0x44, 0x46, 0xf0, 0x9, 0x80,
-    0xf, 0xff, 0xff, 0xff, 0x1, 0xf8, 0x0, 0xff,
-    0xff, 0xff, 0xf0, 0x9f, 0xc8, 0x1f, 0xff, 0xff,
-    0xff, 0x1f, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xf1,
-    0x3b, 0xf6, 0xf, 0xff, 0xff, 0xff, 0x0, 0xae,
-    0x0, 0xff, 0xff, 0xff, 0xf0, 0xa, 0x70, 0xf,
-    0xff, 0xff, 0xff, 0x0, 0x90, 0x0, 0xbe, 0xee,
-    0xee, 0xc0, 0x3, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0x4, 0x48, 0x26,
+    0x7f, 0x33, 0xfb, 0xdf, 0xde, 0xfe, 0x67, 0xf3,
+    0x3f, 0x91, 0xfc, 0x8f, 0xe0, 0x0,
 
     /* U+F008C "󰂌" */
-    0x0, 0x5, 0xdd, 0xdd, 0xd0, 0x0, 0x0, 0x17,
-    0xff, 0xff, 0xf2, 0x10, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xb0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xb2, 0x22, 0x22,
-    0x23, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xa, 0xde,
-    0xee, 0xee, 0xee, 0xd5,
+    0xf, 0x80, 0xf8, 0x7f, 0xe7, 0xff, 0x7f, 0xf7,
+    0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf6, 0x3, 0x60,
+    0x37, 0xff, 0x7f, 0xf7, 0xff, 0x7f, 0xf7, 0xff,
+    0x7f, 0xf7, 0xfe,
 
     /* U+F008D "󰂍" */
-    0x4, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xa, 0xef,
-    0xff, 0xe9, 0x0, 0x0, 0x0, 0xf5, 0x44, 0x46,
-    0xe0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0xf2, 0x0, 0x3, 0xe0, 0x0, 0x0,
-    0xf, 0x20, 0x0, 0x3e, 0x5, 0x55, 0x53, 0xfd,
-    0xdd, 0xdd, 0xe0, 0xbc, 0xcc, 0x6f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x1,
-    0x33, 0x33, 0x31, 0x0, 0x0, 0x0,
+    0x38, 0x7, 0xf0, 0x20, 0x81, 0x4, 0x8, 0x20,
+    0x41, 0x3, 0xfb, 0xdf, 0xc0, 0xfe, 0x7, 0xf0,
+    0x3f, 0x80, 0x0, 0x0,
 
     /* U+F008E "󰂎" */
-    0x0, 0x5, 0xcc, 0xcc, 0xc0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf1, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x1f, 0xeb, 0xbb, 0xbb, 0xbc, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb,
-    0x1f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xa0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x7, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xa3,
+    0xf, 0x80, 0xf8, 0x7f, 0xe7, 0xff, 0x60, 0x36,
+    0x3, 0x60, 0x36, 0x3, 0x60, 0x36, 0x3, 0x60,
+    0x36, 0x3, 0x60, 0x36, 0x3, 0x60, 0x36, 0x3,
+    0x7f, 0xf3, 0xfe,
 
     /* U+F008F "󰂏" */
-    0x0, 0x6, 0xdd, 0xdd, 0xd0, 0x0, 0x0, 0x18,
-    0xff, 0xff, 0xf2, 0x10, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xf8, 0x4c,
-    0xff, 0xfb, 0x1f, 0xff, 0xf5, 0xb, 0xff, 0xfb,
-    0x1f, 0xff, 0xf5, 0xa, 0xff, 0xfb, 0x1f, 0xb0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xd9, 0x93, 0x6,
-    0x9a, 0xfb, 0x1f, 0xff, 0xf5, 0xb, 0xff, 0xfb,
-    0x1f, 0xff, 0xf5, 0xb, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x3, 0x67,
-    0x77, 0x77, 0x77, 0x61,
+    0xf, 0x81, 0xf8, 0x7f, 0xe7, 0xff, 0x7f, 0xf7,
+    0xff, 0x7d, 0xf7, 0x9f, 0x79, 0xf6, 0x3, 0x78,
+    0xf7, 0x9f, 0x79, 0xf7, 0xff, 0x7f, 0xf7, 0xff,
+    0x7f, 0xf0, 0x0,
 
     /* U+F0090 "󰂐" */
-    0x4, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xa, 0xef,
-    0xff, 0xe9, 0x0, 0x0, 0x0, 0xf5, 0x44, 0x46,
-    0xe0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x3e, 0x0,
-    0x0, 0x0, 0xf2, 0x0, 0x3, 0xe0, 0x4, 0xd0,
-    0xf, 0x20, 0x0, 0x3e, 0x5, 0x8e, 0x53, 0xfd,
-    0xdd, 0xdd, 0xe0, 0xbd, 0xfc, 0x6f, 0xff, 0xff,
-    0xfe, 0x0, 0x4d, 0x0, 0xff, 0xff, 0xff, 0xe0,
-    0x1, 0x50, 0xf, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x1,
-    0x33, 0x33, 0x31, 0x0, 0x0, 0x0,
+    0x38, 0x7, 0xf0, 0x20, 0x81, 0x4, 0x8, 0x22,
+    0x41, 0x33, 0xfb, 0xdf, 0xc4, 0xfe, 0x7, 0xf0,
+    0x3f, 0x80, 0x0, 0x0,
 
     /* U+F0091 "󰂑" */
-    0x0, 0x6, 0xff, 0xff, 0xf0, 0x0, 0x1, 0x38,
-    0xff, 0xff, 0xf3, 0x30, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x1f, 0xff, 0xfa, 0x9c, 0xff, 0xfb,
-    0x1f, 0xfc, 0x10, 0x0, 0x5f, 0xfb, 0x1f, 0xf1,
-    0xa, 0xd4, 0x7, 0xfb, 0x1f, 0xc0, 0x7f, 0xfe,
-    0x2, 0xfb, 0x1f, 0xfe, 0xff, 0xfc, 0x2, 0xfb,
-    0x1f, 0xff, 0xff, 0xe2, 0x9, 0xfb, 0x1f, 0xff,
-    0xff, 0x30, 0x8f, 0xfb, 0x1f, 0xff, 0xf9, 0x4,
-    0xff, 0xfb, 0x1f, 0xff, 0xfd, 0xbe, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xf5, 0xb, 0xff, 0xfb, 0x1f, 0xff, 0xf5, 0xb,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x6, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xa3,
+    0xf, 0x81, 0xf8, 0x7f, 0xf7, 0xff, 0x70, 0x76,
+    0x63, 0x67, 0x37, 0xf3, 0x7e, 0x77, 0xcf, 0x7c,
+    0xf7, 0xff, 0x7f, 0xf7, 0x9f, 0x79, 0xf7, 0xff,
+    0x7f, 0xf3, 0xfe,
 
     /* U+F00AF "󰂯" */
-    0x0, 0x0, 0x1, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x40, 0x0, 0x1, 0x0, 0x1, 0xff,
-    0xf4, 0x0, 0x1d, 0xa0, 0x1, 0xfd, 0xff, 0x40,
-    0xc, 0xfb, 0x1, 0xfa, 0x4f, 0xf5, 0x0, 0xcf,
-    0xb1, 0xfa, 0x3f, 0xf5, 0x0, 0xc, 0xfc, 0xfd,
-    0xff, 0x50, 0x0, 0x0, 0xcf, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0xa0, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0xfa, 0x0, 0x0, 0x2e, 0xf7, 0xfb, 0xcf, 0xa0,
-    0x2, 0xef, 0x61, 0xfa, 0xe, 0xf8, 0x2e, 0xf6,
-    0x1, 0xfa, 0x8f, 0xd1, 0x9, 0x60, 0x1, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x1, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x1, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xa1, 0x0, 0x0,
+    0x2, 0x0, 0x30, 0x3, 0x86, 0x3c, 0x73, 0x63,
+    0xb6, 0x1f, 0xc0, 0xf8, 0x7, 0x0, 0x78, 0xf,
+    0xc1, 0xbe, 0x33, 0x76, 0x3e, 0x43, 0xc0, 0x38,
+    0x3, 0x0, 0x20,
 
     /* U+F00B0 "󰂰" */
-    0x0, 0x0, 0xe, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x7, 0x60,
-    0xe, 0xef, 0x40, 0x0, 0x0, 0x8, 0xf6, 0xe,
-    0x7a, 0xf4, 0x1, 0x50, 0x0, 0x8f, 0x6e, 0x8c,
-    0xe2, 0x6, 0xd0, 0x0, 0x8, 0xff, 0xfe, 0x21,
-    0x31, 0xf1, 0x0, 0x0, 0x9f, 0xe2, 0x1d, 0x80,
-    0xf3, 0x0, 0x1, 0xcf, 0xf6, 0xa, 0x70, 0xf3,
-    0x0, 0x1c, 0xef, 0xdf, 0x60, 0x12, 0xf1, 0x1,
-    0xce, 0x2e, 0x79, 0xf5, 0x6, 0xb0, 0xb, 0xe2,
-    0xe, 0x9d, 0xd1, 0x0, 0x10, 0x3, 0x20, 0xe,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0xe, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x10, 0x0,
-    0x0, 0x0,
+    0x4, 0x0, 0x18, 0x0, 0x70, 0x19, 0x60, 0x37,
+    0x88, 0x7c, 0x20, 0xe6, 0x83, 0x92, 0x1f, 0x8,
+    0xd6, 0x26, 0x78, 0x1, 0xc0, 0x6, 0x0, 0x10,
+    0x0,
 
     /* U+F00B1 "󰂱" */
-    0x0, 0x0, 0x6, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xb0, 0x0, 0x0, 0x1, 0xa1, 0x6,
-    0xff, 0xb0, 0x0, 0x0, 0x2e, 0xc1, 0x6e, 0x3f,
-    0xb0, 0x0, 0x0, 0x2e, 0xd8, 0xe6, 0xf8, 0x0,
-    0x0, 0x40, 0x2e, 0xff, 0xf8, 0x2, 0x20, 0x8f,
-    0x70, 0x2e, 0xf9, 0x1, 0xde, 0x24, 0xe3, 0x6,
-    0xff, 0xc1, 0xa, 0xb0, 0x0, 0x6, 0xfd, 0xfe,
-    0xc1, 0x0, 0x0, 0x5, 0xf8, 0x6e, 0x2f, 0xc0,
-    0x0, 0x4, 0xf8, 0x6, 0xe8, 0xf6, 0x0, 0x0,
-    0x5, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x46,
-    0x0, 0x0, 0x0,
+    0x2, 0x0, 0x18, 0x8, 0xe0, 0x65, 0x81, 0xec,
+    0x7, 0xc3, 0x1c, 0xc8, 0xe6, 0xf, 0x80, 0xd6,
+    0xc, 0xe0, 0x6, 0x0, 0x20, 0x0, 0x0,
 
     /* U+F00B2 "󰂲" */
-    0x0, 0x0, 0x9, 0x90, 0x0, 0x0, 0x1, 0x20,
-    0x0, 0x9f, 0xa0, 0x0, 0x0, 0xbe, 0x20, 0x9,
-    0xff, 0xa0, 0x0, 0x3, 0xee, 0x20, 0x9e, 0x8f,
-    0xa0, 0x0, 0x3, 0xee, 0x22, 0xc0, 0xdf, 0x40,
-    0x0, 0x3, 0xee, 0x21, 0x9f, 0x70, 0x0, 0x0,
-    0x3, 0xee, 0x22, 0x60, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0xaf, 0xef, 0xee, 0x20,
-    0x0, 0x0, 0xaf, 0x79, 0xe3, 0xfe, 0x20, 0x0,
-    0xaf, 0x70, 0x9e, 0x3e, 0xfe, 0x20, 0xa, 0x70,
-    0x9, 0xfe, 0xe5, 0xee, 0x10, 0x0, 0x0, 0x9f,
-    0xe2, 0x3, 0x80, 0x0, 0x0, 0x9, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x32, 0x0, 0x0, 0x0,
+    0x6, 0x0, 0x38, 0x31, 0xe0, 0xcf, 0x83, 0x2c,
+    0xc, 0xc0, 0x30, 0x0, 0xc0, 0xf, 0x0, 0xfc,
+    0xd, 0xb0, 0xcd, 0xc4, 0x7b, 0x3, 0x88, 0x18,
+    0x0, 0x0,
 
     /* U+F00B3 "󰂳" */
-    0x0, 0x0, 0x1e, 0x20, 0x0, 0x0, 0x0, 0x1f,
-    0xe2, 0x0, 0x8, 0x0, 0x1f, 0xfe, 0x20, 0x3f,
-    0xb0, 0x1f, 0x7e, 0xe2, 0x4, 0xfb, 0x2f, 0x59,
-    0xf7, 0x0, 0x4f, 0xcf, 0xdf, 0x80, 0x0, 0x4,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0,
-    0x0, 0x8, 0xff, 0xfc, 0x0, 0x0, 0x8f, 0xaf,
-    0xaf, 0xc0, 0x8, 0xf8, 0x1f, 0x58, 0xf9, 0x4f,
-    0x80, 0x1f, 0x9f, 0xc1, 0x4, 0x0, 0x1f, 0xfc,
-    0x10, 0x0, 0x0, 0x1f, 0xc1, 0x0, 0x0, 0x0,
-    0x1a, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf6, 0x1f, 0x52, 0xf4, 0x0, 0x83, 0x8,
-    0x21, 0x82,
+    0x4, 0x1, 0x84, 0x71, 0x96, 0x35, 0x87, 0xe0,
+    0xf0, 0x38, 0x1f, 0xf, 0xe7, 0x5d, 0x9e, 0x7,
+    0x1, 0x80, 0x40, 0x0, 0x24, 0x89, 0x20,
 
     /* U+F00B4 "󰂴" */
-    0x0, 0x1, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4e, 0x30, 0x0, 0x0, 0x0, 0x20, 0x4, 0xfe,
-    0x30, 0x1, 0xc0, 0xb, 0xc0, 0x4e, 0x9f, 0x30,
-    0xbf, 0xa0, 0x1d, 0xc5, 0xe4, 0xf7, 0x17, 0xf7,
-    0x10, 0x1d, 0xef, 0xf8, 0x0, 0x2f, 0x10, 0x0,
-    0x1d, 0xf8, 0x0, 0x0, 0x30, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x18, 0x0, 0x3, 0xfc, 0xfd, 0xc0,
-    0x2, 0xf1, 0x3, 0xf8, 0x4e, 0x2f, 0x91, 0xbf,
-    0xb1, 0xb8, 0x4, 0xfd, 0xc0, 0x7, 0xf6, 0x0,
-    0x0, 0x4f, 0xc0, 0x0, 0x7, 0x0, 0x0, 0x4,
-    0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x40, 0x3, 0x9, 0x9c, 0xe6, 0xa2,
+    0x1f, 0x10, 0x70, 0x3, 0x84, 0x3e, 0x23, 0x5b,
+    0xb3, 0x88, 0x18, 0x0, 0x80, 0x0,
 
     /* U+F03A0 "󰎠" */
-    0x4, 0x41, 0x14, 0x42, 0x2, 0x43, 0x10, 0x2f,
-    0xf5, 0x4f, 0xff, 0x18, 0xff, 0xe1, 0x0, 0xe5,
-    0x0, 0xf, 0x40, 0x0, 0xf2, 0x0, 0xe5, 0xb,
-    0xdf, 0x20, 0x4d, 0xd0, 0x0, 0xe5, 0x4f, 0x53,
-    0x0, 0x16, 0xf1, 0x0, 0xe5, 0x4f, 0x44, 0x12,
-    0x45, 0xf2, 0x0, 0xe5, 0x4f, 0xff, 0x38, 0xff,
-    0xb0,
+    0x0, 0x1, 0x9d, 0xe2, 0x10, 0x89, 0xc6, 0x24,
+    0x8, 0x90, 0x22, 0x77, 0x80,
 
     /* U+F03A1 "󰎡" */
-    0x1, 0x11, 0x11, 0x11, 0x11, 0x10, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x2f, 0xff, 0xfe, 0xaa, 0xdf,
-    0xff, 0xf3, 0xff, 0xff, 0x30, 0x21, 0xff, 0xff,
-    0x3f, 0xff, 0xf1, 0x6e, 0xe, 0xff, 0xf3, 0xff,
-    0xff, 0x16, 0xe0, 0xef, 0xff, 0x3f, 0xff, 0xf1,
-    0x6e, 0xe, 0xff, 0xf3, 0xff, 0xff, 0x16, 0xe0,
-    0xef, 0xff, 0x3f, 0xff, 0xf4, 0x0, 0x1f, 0xff,
-    0xf3, 0xff, 0xff, 0xfc, 0xbe, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x7, 0xff, 0xbf, 0xfd, 0xff, 0xef, 0xf,
+    0x79, 0x7b, 0xcb, 0xde, 0x5e, 0xf2, 0xf7, 0x87,
+    0xbf, 0xfd, 0xff, 0xef, 0xff, 0x0,
 
     /* U+F03A2 "󰎢" */
-    0x0, 0x2, 0x33, 0x33, 0x33, 0x31, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x10, 0xe2, 0x0,
-    0x0, 0x0, 0xe, 0x3f, 0x2e, 0x20, 0x1e, 0xfd,
-    0x0, 0xe3, 0xf2, 0xe2, 0x3, 0xe0, 0xf0, 0xe,
-    0x3f, 0x2e, 0x20, 0x3e, 0xf, 0x0, 0xe3, 0xf2,
-    0xe2, 0x3, 0xe0, 0xf0, 0xe, 0x3f, 0x2e, 0x20,
-    0x1f, 0xde, 0x0, 0xe3, 0xf2, 0xe2, 0x0, 0x24,
-    0x20, 0xe, 0x3f, 0x2e, 0x42, 0x22, 0x22, 0x22,
-    0xe3, 0xf2, 0x9f, 0xff, 0xff, 0xff, 0xfd, 0xf,
-    0x32, 0x22, 0x22, 0x22, 0x20, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0x88, 0x5, 0x47, 0x2a, 0x29,
+    0x51, 0x4a, 0x8a, 0x54, 0x72, 0xa0, 0x15, 0x0,
+    0xaf, 0xfd, 0x0, 0xf, 0xfc, 0x0,
 
     /* U+F03A3 "󰎣" */
-    0x14, 0x55, 0x55, 0x55, 0x55, 0x42, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xf6, 0x11, 0x11,
-    0x11, 0x11, 0x2f, 0x4f, 0x60, 0x1, 0x66, 0x30,
-    0x1, 0xf5, 0xf6, 0x0, 0xcf, 0xff, 0x10, 0x1f,
-    0x5f, 0x60, 0xe, 0x72, 0xf3, 0x1, 0xf5, 0xf6,
-    0x0, 0xe7, 0x2f, 0x30, 0x1f, 0x5f, 0x60, 0xe,
-    0x72, 0xf3, 0x1, 0xf5, 0xf6, 0x0, 0xe8, 0x4f,
-    0x30, 0x1f, 0x5f, 0x60, 0xb, 0xff, 0xe1, 0x1,
-    0xf5, 0xf6, 0x0, 0x3, 0x41, 0x0, 0x1f, 0x5f,
-    0xa6, 0x66, 0x66, 0x66, 0x67, 0xf4, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x10,
+    0x0, 0x7, 0xff, 0xa0, 0x5, 0x0, 0x28, 0xf1,
+    0x44, 0x8a, 0x24, 0x51, 0x22, 0x8d, 0x14, 0x78,
+    0xa0, 0x5, 0x80, 0x2f, 0xff, 0x0,
 
     /* U+F03A4 "󰎤" */
-    0x1, 0x11, 0x11, 0x11, 0x11, 0x10, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xfe, 0x99, 0xef,
-    0xff, 0xf1, 0xff, 0xff, 0xd3, 0xa, 0xff, 0xff,
-    0x1f, 0xff, 0xff, 0xf2, 0xaf, 0xff, 0xf1, 0xff,
-    0xff, 0xff, 0x2a, 0xff, 0xff, 0x1f, 0xff, 0xff,
-    0xf2, 0xaf, 0xff, 0xf1, 0xff, 0xff, 0xff, 0x2a,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xf2, 0xaf, 0xff,
-    0xf1, 0xff, 0xff, 0xff, 0xce, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0,
+    0x0, 0x7, 0xff, 0xbf, 0xfd, 0xff, 0xef, 0x9f,
+    0x7e, 0xfb, 0xf7, 0xdf, 0xbe, 0xfd, 0xf7, 0xef,
+    0xbf, 0xfd, 0xff, 0xef, 0xff, 0x0,
 
     /* U+F03A5 "󰎥" */
-    0x0, 0x2, 0x22, 0x22, 0x22, 0x21, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0xe2, 0x0,
-    0x0, 0x0, 0xe, 0x3f, 0x1e, 0x20, 0xf, 0xf2,
-    0x0, 0xe3, 0xf1, 0xe2, 0x0, 0xe, 0x20, 0xe,
-    0x3f, 0x1e, 0x20, 0x0, 0xe2, 0x0, 0xe3, 0xf1,
-    0xe2, 0x0, 0xe, 0x20, 0xe, 0x3f, 0x1e, 0x20,
-    0x0, 0xe2, 0x0, 0xe3, 0xf1, 0xe2, 0x0, 0x7,
-    0x10, 0xe, 0x3f, 0x1e, 0x42, 0x22, 0x22, 0x22,
-    0xe3, 0xf1, 0x9f, 0xff, 0xff, 0xff, 0xfd, 0xf,
-    0x31, 0x11, 0x11, 0x11, 0x10, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0x88, 0x5, 0x46, 0x2a, 0x11,
+    0x50, 0x8a, 0x84, 0x54, 0x22, 0xa0, 0x15, 0x0,
+    0xaf, 0xfd, 0x0, 0xf, 0xfc, 0x0,
 
     /* U+F03A6 "󰎦" */
-    0x14, 0x44, 0x44, 0x44, 0x44, 0x42, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x4f, 0x60, 0x2, 0x66, 0x30,
-    0x1, 0xf4, 0xf6, 0x0, 0x4f, 0xf7, 0x0, 0x1f,
-    0x4f, 0x60, 0x0, 0xe, 0x70, 0x1, 0xf4, 0xf6,
-    0x0, 0x0, 0xe7, 0x0, 0x1f, 0x4f, 0x60, 0x0,
-    0xe, 0x70, 0x1, 0xf4, 0xf6, 0x0, 0x0, 0xe7,
-    0x0, 0x1f, 0x4f, 0x60, 0x0, 0xe, 0x70, 0x1,
-    0xf4, 0xf6, 0x0, 0x0, 0x63, 0x0, 0x1f, 0x4f,
-    0xa6, 0x66, 0x66, 0x66, 0x67, 0xf4, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x10,
+    0x0, 0x7, 0xff, 0xa0, 0x5, 0x0, 0x28, 0x61,
+    0x41, 0xa, 0x8, 0x50, 0x42, 0x82, 0x14, 0x10,
+    0xa0, 0x5, 0x80, 0x2f, 0xff, 0x0,
 
     /* U+F03A7 "󰎧" */
-    0x1, 0x11, 0x11, 0x11, 0x11, 0x10, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x2f, 0xff, 0xfa, 0x9a, 0xdf,
-    0xff, 0xf2, 0xff, 0xff, 0x43, 0x21, 0xff, 0xff,
-    0x2f, 0xff, 0xff, 0xfd, 0xe, 0xff, 0xf2, 0xff,
-    0xff, 0xa3, 0x20, 0xff, 0xff, 0x2f, 0xff, 0xf2,
-    0x46, 0xbf, 0xff, 0xf2, 0xff, 0xff, 0x19, 0xff,
-    0xff, 0xff, 0x2f, 0xff, 0xf1, 0x0, 0xe, 0xff,
-    0xf2, 0xff, 0xff, 0xcb, 0xbb, 0xff, 0xff, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x7, 0xff, 0xbf, 0xfd, 0xff, 0xef, 0xf,
+    0x7f, 0x7b, 0xe3, 0xde, 0x3e, 0xf7, 0xf7, 0x87,
+    0xbf, 0xfd, 0xff, 0xef, 0xff, 0x0,
 
     /* U+F03A8 "󰎨" */
-    0x0, 0x2, 0x22, 0x22, 0x22, 0x21, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0xe2, 0x0,
-    0x0, 0x0, 0xe, 0x3f, 0x1e, 0x20, 0x2f, 0xfd,
-    0x0, 0xe3, 0xf1, 0xe2, 0x0, 0x0, 0xf0, 0xe,
-    0x3f, 0x1e, 0x20, 0xc, 0xed, 0x0, 0xe3, 0xf1,
-    0xe2, 0x2, 0xe2, 0x0, 0xe, 0x3f, 0x1e, 0x20,
-    0x2f, 0xcc, 0x0, 0xe3, 0xf1, 0xe2, 0x0, 0x44,
-    0x40, 0xe, 0x3f, 0x1e, 0x42, 0x22, 0x22, 0x22,
-    0xe3, 0xf1, 0x9f, 0xff, 0xff, 0xff, 0xfd, 0xf,
-    0x31, 0x11, 0x11, 0x11, 0x10, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0x88, 0x5, 0x47, 0x2a, 0x9,
+    0x51, 0xca, 0x88, 0x54, 0x72, 0xa0, 0x15, 0x0,
+    0xaf, 0xfd, 0x0, 0xf, 0xfc, 0x0,
 
     /* U+F03A9 "󰎩" */
-    0x14, 0x44, 0x44, 0x44, 0x44, 0x42, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x4f, 0x60, 0x6, 0x66, 0x30,
-    0x1, 0xf4, 0xf6, 0x0, 0xef, 0xff, 0x10, 0x1f,
-    0x4f, 0x60, 0x0, 0x2, 0xf3, 0x1, 0xf4, 0xf6,
-    0x0, 0x6d, 0xef, 0x10, 0x1f, 0x4f, 0x60, 0xe,
-    0xb7, 0x40, 0x1, 0xf4, 0xf6, 0x0, 0xe8, 0x11,
-    0x0, 0x1f, 0x4f, 0x60, 0xe, 0xff, 0xf3, 0x1,
-    0xf4, 0xf6, 0x0, 0x34, 0x44, 0x0, 0x1f, 0x4f,
-    0xa6, 0x66, 0x66, 0x66, 0x67, 0xf4, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x10,
+    0x0, 0x7, 0xff, 0xa0, 0x5, 0x0, 0x28, 0xf1,
+    0x40, 0x8a, 0x1c, 0x51, 0x82, 0x8c, 0x14, 0x78,
+    0xa0, 0x5, 0x80, 0x2f, 0xff, 0x0,
 
     /* U+F03AA "󰎪" */
-    0x1, 0x11, 0x11, 0x11, 0x11, 0x10, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x2f, 0xff, 0xfa, 0x9a, 0xdf,
-    0xff, 0xf2, 0xff, 0xff, 0x43, 0x21, 0xff, 0xff,
-    0x2f, 0xff, 0xff, 0xfd, 0xe, 0xff, 0xf2, 0xff,
-    0xff, 0xf9, 0x22, 0xff, 0xff, 0x2f, 0xff, 0xff,
-    0xb5, 0x3f, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xc0,
-    0xef, 0xff, 0x2f, 0xff, 0xf1, 0x0, 0x1f, 0xff,
-    0xf2, 0xff, 0xff, 0xcb, 0xbe, 0xff, 0xff, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x7, 0xff, 0xbf, 0xfd, 0xff, 0xef, 0xf,
+    0x7f, 0x7b, 0xf3, 0xdf, 0x9e, 0xfe, 0xf7, 0x87,
+    0xbf, 0xfd, 0xff, 0xef, 0xff, 0x0,
 
     /* U+F03AB "󰎫" */
-    0x0, 0x2, 0x22, 0x22, 0x22, 0x21, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0xe2, 0x0,
-    0x0, 0x0, 0xe, 0x3f, 0x1e, 0x20, 0x6f, 0xfb,
-    0x0, 0xe3, 0xf1, 0xe2, 0x0, 0x2, 0xf0, 0xe,
-    0x3f, 0x1e, 0x20, 0x4, 0xda, 0x0, 0xe3, 0xf1,
-    0xe2, 0x0, 0x15, 0xe0, 0xe, 0x3f, 0x1e, 0x20,
-    0x5c, 0xde, 0x0, 0xe3, 0xf1, 0xe2, 0x1, 0x44,
-    0x10, 0xe, 0x3f, 0x1e, 0x42, 0x22, 0x22, 0x22,
-    0xe3, 0xf1, 0x9f, 0xff, 0xff, 0xff, 0xfd, 0xf,
-    0x31, 0x11, 0x11, 0x11, 0x10, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0x88, 0x5, 0x47, 0x2a, 0x9,
+    0x50, 0xca, 0x82, 0x54, 0x72, 0xa0, 0x15, 0x0,
+    0xaf, 0xfd, 0x0, 0xf, 0xfc, 0x0,
 
     /* U+F03AC "󰎬" */
-    0x14, 0x44, 0x44, 0x44, 0x44, 0x42, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x4f, 0x60, 0x6, 0x66, 0x30,
-    0x1, 0xf4, 0xf6, 0x0, 0xdf, 0xff, 0x10, 0x1f,
-    0x4f, 0x60, 0x0, 0x2, 0xf3, 0x1, 0xf4, 0xf6,
-    0x0, 0x7, 0xfe, 0x10, 0x1f, 0x4f, 0x60, 0x0,
-    0x37, 0xe1, 0x1, 0xf4, 0xf6, 0x0, 0x11, 0x4f,
-    0x30, 0x1f, 0x4f, 0x60, 0xe, 0xff, 0xf1, 0x1,
-    0xf4, 0xf6, 0x0, 0x34, 0x41, 0x0, 0x1f, 0x4f,
-    0xa6, 0x66, 0x66, 0x66, 0x67, 0xf4, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x10,
+    0x0, 0x7, 0xff, 0xa0, 0x5, 0x0, 0x28, 0xf1,
+    0x40, 0x8a, 0xc, 0x50, 0x22, 0x81, 0x14, 0x78,
+    0xa0, 0x5, 0x80, 0x2f, 0xff, 0x0,
 
     /* U+F03AD "󰎭" */
-    0x1, 0x11, 0x11, 0x11, 0x11, 0x10, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x2f, 0xff, 0xfa, 0xcf, 0x9f,
-    0xff, 0xf2, 0xff, 0xff, 0x16, 0xe0, 0xef, 0xff,
-    0x2f, 0xff, 0xf1, 0x6e, 0xe, 0xff, 0xf2, 0xff,
-    0xff, 0x12, 0x50, 0xef, 0xff, 0x2f, 0xff, 0xf8,
-    0x77, 0xe, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xe0,
-    0xef, 0xff, 0x2f, 0xff, 0xff, 0xfe, 0xe, 0xff,
-    0xf2, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x7, 0xff, 0xbf, 0xfd, 0xff, 0xef, 0x2f,
+    0x79, 0x7b, 0xc3, 0xdf, 0x1e, 0xfe, 0xf7, 0xf7,
+    0xbf, 0xfd, 0xff, 0xef, 0xff, 0x0,
 
     /* U+F03AE "󰎮" */
-    0x14, 0x44, 0x44, 0x44, 0x44, 0x42, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x4f, 0x60, 0xb, 0x52, 0xc2,
-    0x1, 0xf4, 0xf6, 0x0, 0xe7, 0x2f, 0x30, 0x1f,
-    0x4f, 0x60, 0xe, 0x73, 0xf3, 0x1, 0xf4, 0xf6,
-    0x0, 0xef, 0xff, 0x30, 0x1f, 0x4f, 0x60, 0x4,
-    0x46, 0xf3, 0x1, 0xf4, 0xf6, 0x0, 0x0, 0x2f,
-    0x30, 0x1f, 0x4f, 0x60, 0x0, 0x2, 0xf3, 0x1,
-    0xf4, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x4f,
-    0xa6, 0x66, 0x66, 0x66, 0x67, 0xf4, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x10,
+    0x0, 0x7, 0xff, 0xa0, 0x5, 0x12, 0x28, 0x91,
+    0x44, 0x8a, 0x3c, 0x50, 0x22, 0x81, 0x14, 0x8,
+    0xa0, 0x5, 0x80, 0x2f, 0xff, 0x0,
 
     /* U+F03AF "󰎯" */
-    0x0, 0x2, 0x22, 0x22, 0x22, 0x21, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0xe2, 0x0,
-    0x0, 0x0, 0xe, 0x3f, 0x1e, 0x20, 0x2f, 0xff,
-    0x0, 0xe3, 0xf1, 0xe2, 0x2, 0xe0, 0x0, 0xe,
-    0x3f, 0x1e, 0x20, 0x2f, 0xea, 0x0, 0xe3, 0xf1,
-    0xe2, 0x0, 0x22, 0xf0, 0xe, 0x3f, 0x1e, 0x20,
-    0x2c, 0xde, 0x0, 0xe3, 0xf1, 0xe2, 0x0, 0x44,
-    0x20, 0xe, 0x3f, 0x1e, 0x42, 0x22, 0x22, 0x22,
-    0xe3, 0xf1, 0x9f, 0xff, 0xff, 0xff, 0xfd, 0xf,
-    0x31, 0x11, 0x11, 0x11, 0x10, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0x88, 0x5, 0x47, 0x2a, 0x21,
+    0x51, 0xca, 0x82, 0x54, 0x72, 0xa0, 0x15, 0x0,
+    0xaf, 0xfd, 0x0, 0xf, 0xfc, 0x0,
 
     /* U+F03B0 "󰎰" */
-    0x14, 0x44, 0x44, 0x44, 0x44, 0x42, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x4f, 0x60, 0x6, 0x66, 0x61,
-    0x1, 0xf4, 0xf6, 0x0, 0xef, 0xff, 0x30, 0x1f,
-    0x4f, 0x60, 0xe, 0x70, 0x0, 0x1, 0xf4, 0xf6,
-    0x0, 0xef, 0xfb, 0x0, 0x1f, 0x4f, 0x60, 0x5,
-    0x67, 0xf2, 0x1, 0xf4, 0xf6, 0x0, 0x11, 0x4f,
-    0x30, 0x1f, 0x4f, 0x60, 0xe, 0xff, 0xe0, 0x1,
-    0xf4, 0xf6, 0x0, 0x34, 0x41, 0x0, 0x1f, 0x4f,
-    0xa6, 0x66, 0x66, 0x66, 0x67, 0xf4, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x10,
+    0x0, 0x7, 0xff, 0xa0, 0x5, 0x0, 0x28, 0xf1,
+    0x44, 0xa, 0x3c, 0x50, 0x22, 0x81, 0x14, 0x78,
+    0xa0, 0x5, 0x80, 0x2f, 0xff, 0x0,
 
     /* U+F03B1 "󰎱" */
-    0x1, 0x11, 0x11, 0x11, 0x11, 0x10, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x2f, 0xff, 0xfa, 0x99, 0x9f,
-    0xff, 0xf2, 0xff, 0xff, 0x12, 0x33, 0xff, 0xff,
-    0x2f, 0xff, 0xf1, 0xaf, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0x11, 0x28, 0xff, 0xff, 0x2f, 0xff, 0xf7,
-    0x65, 0xf, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xc0,
-    0xef, 0xff, 0x2f, 0xff, 0xf1, 0x0, 0x2f, 0xff,
-    0xf2, 0xff, 0xff, 0xcb, 0xbe, 0xff, 0xff, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0,
+    0x0, 0x7, 0xff, 0xbf, 0xfd, 0xff, 0xef, 0xf,
+    0x7b, 0xfb, 0xc7, 0xde, 0x1e, 0xfe, 0xf7, 0x87,
+    0xbf, 0xfd, 0xff, 0xef, 0xff, 0x0,
 
     /* U+F04C5 "󰓅" */
-    0x0, 0x0, 0x25, 0x53, 0x0, 0x0, 0x0, 0x3,
-    0xcf, 0xfe, 0xfb, 0x0, 0x0, 0x4, 0xfa, 0x20,
-    0x1, 0x4, 0x90, 0x1, 0xf8, 0x0, 0x0, 0x2b,
-    0xf3, 0x0, 0x8c, 0x0, 0x1, 0x8f, 0xf9, 0xb,
-    0xd, 0x60, 0x2, 0xef, 0xff, 0x11, 0xf2, 0xf4,
-    0x0, 0x9f, 0xff, 0x70, 0xe, 0x4e, 0x40, 0x7,
-    0xff, 0xd0, 0x0, 0xf3, 0xb9, 0x0, 0x7, 0x81,
-    0x0, 0x3f, 0x5, 0xf2, 0x0, 0x0, 0x0, 0xc,
-    0xa0, 0xb, 0xb0, 0x0, 0x0, 0x6, 0xe1, 0x0,
-    0x2, 0x0, 0x0, 0x0, 0x12, 0x0,
+    0x0, 0x0, 0xfc, 0xc, 0x8, 0xc1, 0x8c, 0x3d,
+    0x43, 0xca, 0x3c, 0x50, 0xe2, 0xc2, 0x12, 0x1,
+    0x98, 0x8, 0x0, 0x0,
 
     /* U+F0553 "󰕓" */
-    0x0, 0x0, 0x2, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x5, 0xbf, 0x63,
-    0x0, 0x0, 0x0, 0x10, 0x8, 0xf1, 0x0, 0x0,
-    0x4, 0xff, 0x60, 0x8f, 0x14, 0xff, 0xf0, 0xaf,
-    0xfd, 0x8, 0xf1, 0x4f, 0xff, 0x7, 0xff, 0xa0,
-    0x8f, 0x14, 0xff, 0xf0, 0xb, 0xf0, 0x8, 0xf1,
-    0x1a, 0xf7, 0x0, 0xbf, 0x0, 0x8f, 0x10, 0x6f,
-    0x30, 0x9, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x18, 0xaa, 0xdf, 0xaa, 0xa5, 0x0, 0x0, 0x0,
-    0x8, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x69, 0x20, 0x0, 0x0,
+    0x2, 0x0, 0x30, 0x3, 0xc0, 0xc, 0x0, 0x60,
+    0x33, 0x3b, 0xd9, 0xce, 0xce, 0x66, 0x63, 0x31,
+    0x1f, 0xf8, 0x7f, 0x80, 0x60, 0x3, 0x0, 0x18,
+    0x1, 0xe0, 0x7, 0x0, 0x10, 0x0,
 
     /* U+F0632 "󰘲" */
-    0x0, 0x0, 0x3, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0x60, 0x0, 0x0, 0x0, 0x3, 0xe9,
-    0x5f, 0x60, 0x0, 0x0, 0x3, 0xe9, 0x0, 0x5f,
-    0x60, 0x0, 0x3, 0xea, 0x0, 0x0, 0x5f, 0x60,
-    0x3, 0xef, 0xd4, 0x0, 0xd, 0xff, 0x60, 0x46,
-    0x6f, 0x50, 0x0, 0xf8, 0x65, 0x0, 0x0, 0xf5,
-    0x0, 0xf, 0x40, 0x0, 0x0, 0xf, 0x50, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x3, 0x33, 0x33, 0x30, 0x0, 0x0,
-    0x0, 0x45, 0x55, 0x55, 0x10, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xf5, 0x0,
-    0xf, 0x40, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x34, 0x44, 0x44, 0x10, 0x0,
+    0x0, 0x0, 0x30, 0x3, 0x40, 0x31, 0x3, 0x4,
+    0x38, 0x70, 0x43, 0x2, 0x10, 0x10, 0x80, 0xfc,
+    0x0, 0x0, 0x0, 0x1, 0xf8, 0x8, 0x40, 0x7e,
+    0x0, 0x0,
 
     /* U+F0633 "󰘳" */
-    0x1, 0x41, 0x0, 0x0, 0x3, 0x20, 0x4, 0xff,
-    0xe3, 0x0, 0x1d, 0xff, 0x80, 0xd8, 0x9, 0xb0,
-    0x9, 0xb0, 0x3f, 0x2f, 0x40, 0x5e, 0x0, 0xc7,
-    0x0, 0xf4, 0xad, 0x69, 0xf6, 0x6d, 0xa6, 0xae,
-    0x0, 0x9c, 0xef, 0xdd, 0xfe, 0xda, 0x20, 0x0,
-    0x5, 0xe0, 0xc, 0x70, 0x0, 0x0, 0x0, 0x5e,
-    0x0, 0xc7, 0x0, 0x0, 0x1a, 0xee, 0xfe, 0xef,
-    0xfe, 0xb3, 0xb, 0xc5, 0x8e, 0x44, 0xd9, 0x49,
-    0xe1, 0xf4, 0x5, 0xe0, 0xb, 0x70, 0xf, 0x4c,
-    0xb4, 0xca, 0x0, 0x8d, 0x47, 0xf1, 0x2c, 0xfb,
-    0x10, 0x0, 0x9f, 0xd4, 0x0,
+    0x0, 0x3, 0x87, 0xb6, 0x65, 0x12, 0x2d, 0x9b,
+    0x3f, 0xf0, 0x24, 0x1, 0x20, 0x7f, 0xe6, 0xcd,
+    0xa2, 0x45, 0xb3, 0x27, 0xe, 0x0,
 
     /* U+F0634 "󰘴" */
-    0x0, 0x0, 0x3, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0x60, 0x0, 0x0, 0x0, 0x3, 0xee,
-    0xcf, 0x60, 0x0, 0x0, 0x3, 0xee, 0x30, 0xcf,
-    0x60, 0x0, 0x3, 0xee, 0x30, 0x0, 0xcf, 0x60,
-    0x3, 0xee, 0x30, 0x0, 0x0, 0xcf, 0x60, 0xbe,
-    0x30, 0x0, 0x0, 0x0, 0xbf, 0x11, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x30,
+    0x0, 0x0, 0x30, 0x3, 0xc0, 0x33, 0x3, 0xc,
+    0x30, 0x33, 0x0, 0xc0, 0x0,
 
     /* U+F0635 "󰘵" */
-    0x16, 0x66, 0x60, 0x0, 0x46, 0x66, 0x60, 0x3f,
-    0xff, 0xf6, 0x0, 0xaf, 0xff, 0xf1, 0x0, 0x0,
-    0xae, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x15, 0x55, 0x50,
+    0x0, 0x1, 0xe3, 0xe0, 0xc0, 0x1, 0x0, 0x6,
+    0x0, 0x8, 0x0, 0x30, 0x0, 0x60, 0x1, 0x80,
+    0x3, 0x0, 0xf, 0x80, 0x0,
 
     /* U+F0636 "󰘶" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xeb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x52, 0xeb,
-    0x0, 0x0, 0x0, 0x6f, 0x50, 0x2, 0xeb, 0x0,
-    0x0, 0x6f, 0x70, 0x0, 0x4, 0xfb, 0x0, 0x6f,
-    0xff, 0x50, 0x0, 0xff, 0xfb, 0x1, 0x11, 0xf5,
-    0x0, 0xf, 0x51, 0x10, 0x0, 0xf, 0x50, 0x0,
-    0xf4, 0x0, 0x0, 0x0, 0xf8, 0x55, 0x5f, 0x40,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x10, 0x1, 0xc0, 0x13, 0x1, 0xc,
+    0x10, 0x31, 0xc3, 0xc2, 0x10, 0x10, 0x80, 0xc4,
+    0x7, 0xe0,
 
     /* U+F093E "󰤾" */
-    0x0, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0xf, 0x53, 0x33, 0x3f, 0x40,
-    0x0, 0x0, 0xf2, 0x0, 0x0, 0xf4, 0x0, 0x50,
-    0xf, 0x20, 0x0, 0xf, 0x43, 0x1b, 0x90, 0xf2,
-    0x0, 0x0, 0xf4, 0xa, 0xcb, 0x1f, 0x20, 0x0,
-    0xf, 0x40, 0x2f, 0x30, 0xf2, 0x0, 0x0, 0xf4,
-    0xa, 0xcb, 0x1f, 0x20, 0x0, 0xf, 0x43, 0x1b,
-    0x90, 0xf8, 0x66, 0x66, 0xf4, 0x0, 0x50, 0xf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0x4, 0x8, 0x20,
+    0x41, 0x1a, 0x9, 0xd0, 0x44, 0x82, 0x74, 0x11,
+    0xb0, 0x81, 0xfc, 0xf, 0xe0, 0x0,
 
     /* U+F093F "󰤿" */
-    0x0, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0xf, 0x53, 0x33, 0x3f, 0x40,
-    0x0, 0x0, 0xf2, 0x0, 0x0, 0xf4, 0x0, 0x50,
-    0xf, 0x20, 0x0, 0xf, 0x43, 0x1b, 0x90, 0xf2,
-    0x0, 0x0, 0xf4, 0xa, 0xcb, 0x1f, 0x20, 0x0,
-    0xf, 0x40, 0x2f, 0x30, 0xf2, 0x0, 0x0, 0xf4,
-    0xa, 0xcb, 0x1f, 0x30, 0x0, 0xf, 0x43, 0x1b,
-    0x90, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x50, 0xf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0x4, 0x8, 0x20,
+    0x41, 0x1a, 0x9, 0xd0, 0x44, 0x82, 0x74, 0x11,
+    0xbf, 0x81, 0xfc, 0xf, 0xe0, 0x0,
 
     /* U+F0940 "󰥀" */
-    0x0, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0xf, 0x53, 0x33, 0x3f, 0x40,
-    0x0, 0x0, 0xf2, 0x0, 0x0, 0xf4, 0x0, 0x50,
-    0xf, 0x20, 0x0, 0xf, 0x43, 0x1b, 0x90, 0xf2,
-    0x0, 0x0, 0xf4, 0xa, 0xcb, 0x1f, 0x20, 0x0,
-    0xf, 0x40, 0x2f, 0x30, 0xf6, 0x44, 0x44, 0xf4,
-    0xa, 0xcb, 0x1f, 0xff, 0xff, 0xff, 0x43, 0x2b,
-    0x90, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x50, 0xf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0x4, 0x8, 0x20,
+    0x41, 0x1a, 0x9, 0xd0, 0x44, 0x82, 0x77, 0xf1,
+    0xbf, 0x81, 0xfc, 0xf, 0xe0, 0x0,
 
     /* U+F0941 "󰥁" */
-    0x0, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0xf, 0x53, 0x33, 0x3f, 0x40,
-    0x0, 0x0, 0xf2, 0x0, 0x0, 0xf4, 0x0, 0x50,
-    0xf, 0x20, 0x0, 0xf, 0x43, 0x2b, 0x90, 0xf2,
-    0x0, 0x0, 0xf4, 0xa, 0xca, 0x1f, 0x20, 0x0,
-    0xf, 0x40, 0x2f, 0x40, 0xff, 0xff, 0xff, 0xf4,
-    0x1a, 0xbb, 0x1f, 0xff, 0xff, 0xff, 0x43, 0x1b,
-    0x80, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x40, 0xf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xad, 0xdd,
-    0xdd, 0xc1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0x4, 0x8, 0x20,
+    0x41, 0x1a, 0x9, 0xd0, 0x44, 0xfe, 0x77, 0xf1,
+    0xbf, 0x81, 0xfc, 0xf, 0xe0, 0x0,
 
     /* U+F0942 "󰥂" */
-    0x0, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0xf, 0x53, 0x33, 0x3f, 0x40,
-    0x0, 0x0, 0xf2, 0x0, 0x0, 0xf4, 0x0, 0x50,
-    0xf, 0x20, 0x0, 0xf, 0x43, 0x1b, 0x90, 0xf2,
-    0x0, 0x0, 0xf4, 0x1a, 0xcb, 0x1f, 0x97, 0x77,
-    0x7f, 0x40, 0x2f, 0x30, 0xff, 0xff, 0xff, 0xf4,
-    0xa, 0xcb, 0x1f, 0xff, 0xff, 0xff, 0x43, 0x1b,
-    0x90, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x50, 0xf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0x4, 0x8, 0x20,
+    0x41, 0x1a, 0x9, 0xd8, 0x44, 0xfe, 0x77, 0xf1,
+    0xbf, 0x81, 0xfc, 0xf, 0xe0, 0x0,
 
     /* U+F0943 "󰥃" */
-    0x0, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0xf, 0x53, 0x33, 0x3f, 0x40,
-    0x0, 0x0, 0xf2, 0x0, 0x0, 0xf4, 0x0, 0x50,
-    0xf, 0x20, 0x0, 0xf, 0x43, 0x1b, 0x90, 0xf4,
-    0x11, 0x11, 0xf4, 0x1a, 0xcb, 0x1f, 0xff, 0xff,
-    0xff, 0x40, 0x2f, 0x30, 0xff, 0xff, 0xff, 0xf4,
-    0xa, 0xcb, 0x1f, 0xff, 0xff, 0xff, 0x43, 0x1b,
-    0x90, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x50, 0xf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0x4, 0x8, 0x20,
+    0x41, 0x1a, 0x9, 0xdf, 0xc4, 0xfe, 0x77, 0xf1,
+    0xbf, 0x81, 0xfc, 0xf, 0xe0, 0x0,
 
     /* U+F0944 "󰥄" */
-    0x0, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0xf, 0x53, 0x33, 0x3f, 0x40,
-    0x0, 0x0, 0xf2, 0x0, 0x0, 0xf4, 0x0, 0x40,
-    0xf, 0x74, 0x44, 0x4f, 0x43, 0x1b, 0x90, 0xff,
-    0xff, 0xff, 0xf4, 0x1a, 0xcb, 0x1f, 0xff, 0xff,
-    0xff, 0x40, 0x2f, 0x40, 0xff, 0xff, 0xff, 0xf4,
-    0xa, 0xcb, 0x1f, 0xff, 0xff, 0xff, 0x43, 0x1b,
-    0x90, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x50, 0xf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0x4, 0x8, 0x20,
+    0x41, 0x1b, 0xf9, 0xdf, 0xc4, 0xfe, 0x77, 0xf1,
+    0xbf, 0x81, 0xfc, 0xf, 0xe0, 0x0,
 
     /* U+F0945 "󰥅" */
-    0x0, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0xf, 0x53, 0x33, 0x3f, 0x40,
-    0x0, 0x0, 0xf2, 0x0, 0x0, 0xf4, 0x0, 0x50,
-    0xf, 0xff, 0xff, 0xff, 0x43, 0x2b, 0x90, 0xff,
-    0xff, 0xff, 0xf4, 0xa, 0xca, 0x1f, 0xff, 0xff,
-    0xff, 0x40, 0x2f, 0x40, 0xff, 0xff, 0xff, 0xf4,
-    0x1a, 0xbb, 0x1f, 0xff, 0xff, 0xff, 0x43, 0x1b,
-    0x80, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x40, 0xf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xbd, 0xdd,
-    0xdd, 0xd1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0x4, 0x8, 0x20,
+    0x7f, 0x1b, 0xf9, 0xdf, 0xc4, 0xfe, 0x77, 0xf1,
+    0xbf, 0x81, 0xfc, 0xf, 0xe0, 0x0,
 
     /* U+F0946 "󰥆" */
-    0x0, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0xf, 0x53, 0x33, 0x3f, 0x40,
-    0x0, 0x0, 0xf9, 0x77, 0x77, 0xf4, 0x0, 0x40,
-    0xf, 0xff, 0xff, 0xff, 0x43, 0x1b, 0x80, 0xff,
-    0xff, 0xff, 0xf4, 0x1a, 0xcb, 0x1f, 0xff, 0xff,
-    0xff, 0x40, 0x2f, 0x40, 0xff, 0xff, 0xff, 0xf4,
-    0xa, 0xcb, 0x1f, 0xff, 0xff, 0xff, 0x43, 0x1b,
-    0x90, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x50, 0xf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0x4, 0xc, 0x20,
+    0x7f, 0x1b, 0xf9, 0xdf, 0xc4, 0xfe, 0x77, 0xf1,
+    0xbf, 0x81, 0xfc, 0xf, 0xe0, 0x0,
 
     /* U+F0947 "󰥇" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0xbe, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xff, 0xf9, 0xff, 0xf1, 0x0, 0x30,
-    0xf, 0xff, 0xe, 0xff, 0x13, 0x1b, 0x70, 0xff,
-    0xf0, 0xef, 0xf1, 0x1a, 0xbb, 0xf, 0xff, 0xe,
-    0xff, 0x10, 0x2f, 0x30, 0xff, 0xff, 0xff, 0xf1,
-    0x1a, 0xbc, 0x1f, 0xff, 0x3e, 0xff, 0x13, 0x1b,
-    0x80, 0xff, 0xf7, 0xff, 0xf1, 0x0, 0x40, 0xf,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0xfc, 0xf, 0xe0,
+    0x77, 0x13, 0xb9, 0xdd, 0xc4, 0xfe, 0x77, 0x71,
+    0xbb, 0x81, 0xfc, 0xf, 0xe0, 0x0,
 
     /* U+F0948 "󰥈" */
-    0x0, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x40,
-    0xf, 0xff, 0xff, 0xff, 0x43, 0x1b, 0x80, 0xff,
-    0xff, 0xff, 0xf4, 0x1a, 0xcb, 0x1f, 0xff, 0xff,
-    0xff, 0x40, 0x2f, 0x40, 0xff, 0xff, 0xff, 0xf4,
-    0xa, 0xcb, 0x1f, 0xff, 0xff, 0xff, 0x43, 0x1b,
-    0x90, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x50, 0xf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0xfc, 0xf, 0xe0,
+    0x7f, 0x1b, 0xf9, 0xdf, 0xc4, 0xfe, 0x77, 0xf1,
+    0xbf, 0x81, 0xfc, 0xf, 0xe0, 0x0,
 
     /* U+F0949 "󰥉" */
-    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x1, 0x39,
-    0xff, 0xff, 0xd3, 0x20, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x2f, 0xff,
-    0xff, 0x7f, 0xff, 0xf7, 0x2f, 0xfe, 0xef, 0x5,
-    0xff, 0xf7, 0x2f, 0xfa, 0x3e, 0x16, 0x5f, 0xf7,
-    0x2f, 0xff, 0x93, 0x12, 0xbf, 0xf7, 0x2f, 0xff,
-    0xf8, 0xa, 0xff, 0xf7, 0x2f, 0xff, 0xd2, 0x3,
-    0xef, 0xf7, 0x2f, 0xfd, 0x2b, 0x17, 0x4f, 0xf7,
-    0x2f, 0xfb, 0xbf, 0x2, 0xdf, 0xf7, 0x2f, 0xff,
-    0xff, 0x2e, 0xff, 0xf7, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x5, 0x88,
-    0x88, 0x88, 0x88, 0x70,
+    0xf, 0x81, 0xf8, 0x7f, 0xe7, 0xfe, 0x7f, 0xe7,
+    0xde, 0x7c, 0xe7, 0x46, 0x78, 0xe7, 0xde, 0x78,
+    0xe7, 0x46, 0x7c, 0xe7, 0xde, 0x7f, 0xe7, 0xfe,
+    0x7f, 0xe3, 0xfc,
 
     /* U+F094A "󰥊" */
-    0x0, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0xf, 0xf8, 0x47, 0xff, 0x40,
-    0x0, 0x0, 0xf8, 0x18, 0x35, 0xf4, 0x0, 0x50,
-    0xf, 0x8b, 0xfc, 0xf, 0x43, 0x2b, 0x90, 0xff,
-    0xff, 0x73, 0xf4, 0xa, 0xca, 0x1f, 0xff, 0x91,
-    0xdf, 0x40, 0x1f, 0x30, 0xff, 0xf6, 0xbf, 0xf4,
-    0xa, 0xcb, 0x1f, 0xff, 0xff, 0xff, 0x43, 0x1b,
-    0x80, 0xff, 0xf0, 0xcf, 0xf4, 0x0, 0x40, 0xf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xad, 0xdd,
-    0xdd, 0xc1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xc0, 0x3f, 0x81, 0xcc, 0xd, 0x20,
+    0x7d, 0x1b, 0xc9, 0xde, 0xc4, 0xee, 0x77, 0xf1,
+    0xbb, 0x81, 0xfc, 0xf, 0xe0, 0x0,
 
     /* U+F0A1E "󰨞" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf9, 0x10, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf1, 0x1, 0x20, 0x0,
-    0x7f, 0xff, 0xff, 0xf2, 0x1e, 0xf5, 0x9, 0xff,
-    0xf8, 0xef, 0xf2, 0xa, 0xff, 0xdf, 0xfe, 0x40,
-    0xef, 0xf2, 0x0, 0x9f, 0xff, 0xc1, 0x0, 0xef,
-    0xf2, 0x1, 0xcf, 0xff, 0xe4, 0x0, 0xef, 0xf2,
-    0xd, 0xfe, 0x8f, 0xff, 0x80, 0xef, 0xf2, 0xb,
-    0xc1, 0x5, 0xff, 0xfc, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0x0, 0x1, 0xc0, 0xf, 0x80, 0x7e, 0x67,
+    0xf9, 0xfc, 0xe3, 0xe3, 0x8f, 0x8e, 0x7f, 0xb9,
+    0x8f, 0xe0, 0x1f, 0x80, 0x3e, 0x0, 0x60, 0x0,
+    0x0,
 
     /* U+F0EB7 "󰺷" */
-    0x4, 0xce, 0xff, 0xff, 0xfd, 0x60, 0x4, 0xf5,
-    0x10, 0x0, 0x0, 0x3c, 0x80, 0xc5, 0xd, 0x10,
-    0x0, 0x1c, 0x2f, 0x1f, 0x1d, 0xfe, 0x10, 0x22,
-    0x80, 0xc3, 0xd3, 0x1e, 0x30, 0xb, 0x90, 0xe,
-    0x26, 0xc1, 0x21, 0xac, 0x30, 0xa, 0xb0, 0x8,
-    0xed, 0xf9, 0x6e, 0xde, 0xa1, 0x0, 0x0, 0x21,
-    0x0, 0x2, 0x10, 0x0,
+    0x3f, 0xc2, 0x1, 0xa4, 0x15, 0x70, 0xa9, 0x19,
+    0x23, 0x19, 0xf7, 0x80, 0x0,
 
     /* U+F0F2D "󰼭" */
-    0x0, 0x7d, 0xdd, 0xdd, 0xda, 0x0, 0x0, 0x8,
-    0xd6, 0x66, 0x69, 0xc0, 0x0, 0x0, 0x8e, 0x99,
-    0x9d, 0xfc, 0x0, 0x0, 0x8, 0xfe, 0xee, 0xff,
-    0xc0, 0x0, 0x4b, 0xef, 0xff, 0xff, 0xff, 0xb7,
-    0x2, 0x77, 0x77, 0x77, 0x77, 0x77, 0x40, 0xe,
-    0xfc, 0x0, 0x0, 0x8f, 0xf3, 0x5, 0xff, 0xfd,
-    0xbb, 0xcf, 0xff, 0x90, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf, 0xf4, 0xf8, 0xae, 0x5f, 0x7c,
-    0xf3, 0xff, 0x7f, 0xac, 0xe7, 0xf9, 0xdf, 0x38,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xb0,
+    0x1f, 0xc1, 0x86, 0xf, 0xf0, 0x7f, 0x87, 0xfe,
+    0x0, 0x1, 0xc3, 0x8f, 0xfe, 0xff, 0xf6, 0xf5,
+    0xb7, 0xbd, 0xff, 0xe0,
 
     /* U+F0F85 "󰾅" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x5, 0x44,
-    0x81, 0x70, 0x0, 0x0, 0xb, 0xf3, 0x8d, 0xd,
-    0xe3, 0x0, 0xb, 0xc1, 0xc, 0xf1, 0x9, 0xe2,
-    0x5, 0xe1, 0x1, 0xff, 0x50, 0xc, 0xa0, 0xb8,
-    0x0, 0x5f, 0xf9, 0x0, 0x3f, 0x1e, 0x40, 0x9,
-    0xff, 0xe0, 0x0, 0xf3, 0xf4, 0x0, 0xaf, 0xfe,
-    0x0, 0xf, 0x4d, 0x60, 0x2, 0xde, 0x50, 0x1,
-    0xf2, 0x8d, 0x0, 0x0, 0x0, 0x0, 0x8d, 0x1,
-    0xe8, 0x0, 0x0, 0x0, 0x3f, 0x40, 0x3, 0x70,
-    0x0, 0x0, 0x4, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x80, 0x6d, 0x86, 0x66,
+    0x23, 0x1b, 0x1c, 0x51, 0xe2, 0x8f, 0x14, 0x30,
+    0xb0, 0xc, 0xc0, 0x40, 0x0, 0x0,
 
     /* U+F0F86 "󰾆" */
-    0x0, 0x0, 0x25, 0x53, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xee, 0xfd, 0x50, 0x0, 0x6, 0x70, 0x10,
-    0x1, 0x7f, 0x80, 0x0, 0xd, 0xd4, 0x0, 0x0,
-    0x3f, 0x50, 0x84, 0x4f, 0xfb, 0x20, 0x0, 0x8d,
-    0xd, 0x60, 0xbf, 0xff, 0x60, 0x1, 0xf2, 0xf3,
-    0x2, 0xff, 0xfe, 0x0, 0xf, 0x4e, 0x40, 0x8,
-    0xff, 0xc0, 0x0, 0xf3, 0xb8, 0x0, 0x7, 0x81,
-    0x0, 0x4f, 0x5, 0xf1, 0x0, 0x0, 0x0, 0xc,
-    0xa0, 0xb, 0xb0, 0x0, 0x0, 0x6, 0xe1, 0x0,
-    0x2, 0x0, 0x0, 0x0, 0x12, 0x0,
+    0x0, 0x0, 0x7c, 0x0, 0x18, 0x60, 0x49, 0xc3,
+    0x4f, 0xa, 0x3c, 0x51, 0xe2, 0xc2, 0x12, 0x1,
+    0x98, 0x8, 0x0, 0x0,
 
     /* U+F11F0 "󱇰" */
-    0x7, 0xef, 0xff, 0xff, 0xff, 0xa0, 0x1, 0xfe,
-    0xcc, 0xcc, 0xcc, 0xdf, 0x50, 0x2f, 0xa0, 0x0,
-    0x0, 0x5, 0xf6, 0x2, 0xfa, 0x0, 0x0, 0x0,
-    0x5f, 0x60, 0x2f, 0xa5, 0xb3, 0xb, 0x95, 0xf6,
-    0x2, 0xfa, 0x7f, 0x40, 0xfc, 0x5f, 0x60, 0x2f,
-    0xa0, 0x0, 0x0, 0x5, 0xf6, 0x2, 0xfa, 0x0,
-    0x0, 0x0, 0x5f, 0x60, 0x2f, 0xa0, 0x0, 0x0,
-    0x5, 0xf7, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x31, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x1, 0xdf, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x1, 0xdf, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x5b, 0xbb, 0xb9, 0x0, 0x0
+    0x3f, 0xe3, 0xff, 0x18, 0x8, 0xc0, 0x46, 0x9a,
+    0x34, 0xd1, 0x80, 0x8c, 0x4, 0x60, 0x27, 0xff,
+    0xbf, 0xfd, 0xff, 0xef, 0xff, 0x3f, 0xf0, 0xff,
+    0x3, 0xf0, 0xf, 0x80, 0x7c, 0x0
 };
 
 
@@ -1150,86 +470,86 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 197, .box_w = 13, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 65, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 150, .adv_w = 197, .box_w = 14, .box_h = 16, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 262, .adv_w = 197, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 314, .adv_w = 197, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 418, .adv_w = 197, .box_w = 14, .box_h = 18, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 544, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 652, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 760, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 868, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 976, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1084, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1192, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1300, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1408, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1516, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1624, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1732, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1840, .adv_w = 197, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1918, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2003, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2088, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2173, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2258, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2343, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2428, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2536, .adv_w = 197, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2614, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2722, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2830, .adv_w = 197, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2908, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3016, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3124, .adv_w = 197, .box_w = 14, .box_h = 14, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 3222, .adv_w = 197, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 3313, .adv_w = 197, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3417, .adv_w = 197, .box_w = 10, .box_h = 18, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 3507, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3592, .adv_w = 197, .box_w = 14, .box_h = 7, .ofs_x = -1, .ofs_y = 3},
-    {.bitmap_index = 3641, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3726, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3811, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3896, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3981, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4066, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4151, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4236, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4321, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4406, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4491, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4576, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4661, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4746, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4831, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4916, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5001, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5086, .adv_w = 197, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5164, .adv_w = 197, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 5281, .adv_w = 197, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5385, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5470, .adv_w = 197, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 5522, .adv_w = 197, .box_w = 14, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 5606, .adv_w = 197, .box_w = 13, .box_h = 11, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 5678, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5763, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5848, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5933, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6018, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6103, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6188, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6273, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6358, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6443, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6528, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6613, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 6721, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6806, .adv_w = 197, .box_w = 14, .box_h = 14, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 6904, .adv_w = 197, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 6956, .adv_w = 197, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7034, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7119, .adv_w = 197, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7197, .adv_w = 197, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = -3}
+    {.bitmap_index = 17, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 39, .adv_w = 197, .box_w = 14, .box_h = 16, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 67, .adv_w = 197, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 80, .adv_w = 197, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 106, .adv_w = 197, .box_w = 14, .box_h = 18, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 138, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 165, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 192, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 219, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 246, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 273, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 300, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 327, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 354, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 381, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 408, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 435, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 462, .adv_w = 197, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 482, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 504, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 526, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 548, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 570, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 592, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 614, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 641, .adv_w = 197, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 661, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 688, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 715, .adv_w = 197, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 735, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 762, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 789, .adv_w = 197, .box_w = 14, .box_h = 14, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 814, .adv_w = 197, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 837, .adv_w = 197, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 863, .adv_w = 197, .box_w = 10, .box_h = 18, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 886, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 908, .adv_w = 197, .box_w = 14, .box_h = 7, .ofs_x = -1, .ofs_y = 3},
+    {.bitmap_index = 921, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 943, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 965, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 987, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1009, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1031, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1053, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1075, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1097, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1119, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1141, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1163, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1185, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1207, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1229, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1251, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1273, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1295, .adv_w = 197, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1315, .adv_w = 197, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1345, .adv_w = 197, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1371, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1393, .adv_w = 197, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 1406, .adv_w = 197, .box_w = 14, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1427, .adv_w = 197, .box_w = 13, .box_h = 11, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 1445, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1467, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1489, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1511, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1533, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1555, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1577, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1599, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1621, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1643, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1665, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1687, .adv_w = 197, .box_w = 12, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1714, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1736, .adv_w = 197, .box_w = 14, .box_h = 14, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 1761, .adv_w = 197, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 1774, .adv_w = 197, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1794, .adv_w = 197, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1816, .adv_w = 197, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1836, .adv_w = 197, .box_w = 13, .box_h = 18, .ofs_x = 0, .ofs_y = -3}
 };
 
 /*---------------------
@@ -1294,7 +614,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .kern_dsc = NULL,
     .kern_scale = 0,
     .cmap_num = 5,
-    .bpp = 4,
+    .bpp = 1,
     .kern_classes = 0,
     .bitmap_format = 0,
 #if LVGL_VERSION_MAJOR == 8
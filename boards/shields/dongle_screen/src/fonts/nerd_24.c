@@ -1,7 +1,8 @@
 /*******************************************************************************
  * Size: 24 px
- * Bpp: 4
+ * Bpp: 1
  * Opts: --bpp 4 --size 24 --no-compress --stride 1 --align 1 --font FiraCodeNerdFontMono-Regular.ttf --range 983215,983216-983220,985406-985418,62087,984403,987632,62711,983968-983985,57943,987014,987014,987013,984261,986807,986925,985630,61818,61820,62210,984627,984626,984628,984629,984630,983161-983185 --format lvgl -o nerd_24.c
+ * Converted: lvgl_font.py to-1bpp from the --bpp 4 output, coverage >= 50% kept, no hinting
  ******************************************************************************/
 
 #ifdef __has_include
@@ -33,1456 +34,516 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+E257 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0xfb, 0x40, 0x0, 0x0, 0x0,
-    0x18, 0xef, 0xff, 0xff, 0xd6, 0x0, 0x4, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x4b, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x20, 0x2, 0x8e,
-    0xff, 0xff, 0xfd, 0x71, 0x0, 0x8c, 0x60, 0x6,
-    0xcf, 0xb4, 0x1, 0x7d, 0x50, 0x5b, 0xe8, 0x20,
-    0x0, 0x3a, 0xfa, 0x30, 0x13, 0x2, 0x9f, 0xc9,
-    0xde, 0x71, 0x3, 0x7, 0xec, 0x50, 0x6, 0xa5,
-    0x1, 0x7e, 0xd5, 0x0, 0x5c, 0xe8, 0x20, 0x3a,
-    0xfa, 0x30, 0x0, 0x0, 0x3, 0x9f, 0xfe, 0x81,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0x0, 0x7, 0x0, 0x7f, 0x83, 0xff, 0xe7,
+    0xff, 0xc3, 0xfc, 0x30, 0xe1, 0x1c, 0x1c, 0xf,
+    0xc0, 0xc2, 0x18, 0x71, 0xc0, 0x3e, 0x0, 0x0,
+    0x0,
 
     /* U+F17A "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x25, 0x79, 0x80,
-    0x1, 0x35, 0x73, 0xce, 0xff, 0xff, 0xfc, 0xce,
-    0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xf5, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0x5f, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff,
-    0xf5, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0x5f, 0xff, 0xff, 0xff, 0xc4, 0x44, 0x44, 0x41,
-    0x44, 0x44, 0x44, 0x43, 0xff, 0xff, 0xff, 0x5f,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf5, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x5f, 0xff,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xf5, 0xff, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xff,
-    0xff, 0xc0, 0x35, 0x79, 0xb4, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x24, 0x68, 0xbd,
-    0xb0,
+    0x0, 0x6, 0x3, 0xff, 0xf7, 0xff, 0xef, 0xff,
+    0xdf, 0xff, 0xbf, 0xff, 0x7f, 0x80, 0x0, 0xfd,
+    0xff, 0xfb, 0xff, 0xf7, 0xff, 0xef, 0xff, 0xdf,
+    0xe1, 0xbf, 0xc0, 0x7, 0x80,
 
     /* U+F17C "" */
-    0x0, 0x0, 0x0, 0x1, 0x43, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xab, 0x96, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa8, 0x78, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x80, 0x3, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x93, 0x31, 0xdb, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0x50, 0x0, 0x7f, 0x50, 0x0,
-    0x0, 0x0, 0x5f, 0x0, 0x0, 0x1f, 0xf2, 0x0,
-    0x0, 0x1, 0xd8, 0x0, 0x0, 0x9, 0xdc, 0x0,
-    0x0, 0x8, 0xd2, 0x0, 0x0, 0x2, 0xcf, 0x30,
-    0x0, 0xe, 0x90, 0x0, 0x0, 0x0, 0x6f, 0x70,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0x5, 0xfb, 0x60,
-    0x0, 0x50, 0x87, 0x0, 0x0, 0x4, 0xd7, 0x50,
-    0x5, 0x0, 0xe, 0x60, 0x0, 0x30, 0x0, 0x22,
-    0x3, 0x0, 0x4, 0x60, 0x0, 0x40, 0x0, 0x4,
-    0x3, 0x0, 0x0, 0x76, 0x48, 0x90, 0x0, 0x42,
-    0x3, 0x33, 0x10, 0x67, 0x67, 0x60, 0x4, 0x0,
-    0x0, 0x0, 0x23, 0x0, 0x0, 0x13, 0x30, 0x0,
+    0x0, 0x0, 0x1, 0xe0, 0x3, 0xe0, 0x3, 0xa0,
+    0x3, 0x60, 0x2, 0x20, 0x2, 0x30, 0x4, 0x10,
+    0x4, 0x18, 0xc, 0x1c, 0x18, 0xc, 0x18, 0x4,
+    0x10, 0xc, 0x8, 0x8, 0x4, 0x0, 0x0, 0x0,
+    0x0, 0x60, 0x0, 0x0, 0x0, 0x0,
 
     /* U+F287 "" */
-    0x0, 0x0, 0x0, 0x4, 0xd7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4d, 0xdf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0x11, 0x73, 0x0, 0x0, 0x7, 0xfb,
-    0x6, 0x80, 0x0, 0x0, 0x7, 0x40, 0xff, 0xfd,
-    0xfd, 0xdd, 0xdd, 0xdd, 0xff, 0x7a, 0xfe, 0x0,
-    0xd, 0x10, 0x0, 0xa, 0x70, 0x3, 0x0, 0x0,
-    0x58, 0x5, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x12, 0x0, 0x0,
+    0x0, 0x80, 0x7, 0x80, 0x10, 0x3, 0x20, 0xf,
+    0xff, 0xdc, 0x41, 0x0, 0x40, 0x0, 0xf8, 0x0,
+    0x60, 0x0, 0x0,
 
     /* U+F302 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xc3, 0x0, 0x0, 0x0, 0x5, 0xce,
-    0xc7, 0x37, 0xcf, 0xe9, 0x10, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x14, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x1, 0xdf, 0xfe, 0xbc, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x53, 0x0, 0x1, 0x52, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc0, 0x3, 0x80, 0x6, 0x0,
+    0x18, 0x3, 0x8f, 0x1f, 0xff, 0x3f, 0xfc, 0xff,
+    0xf9, 0xff, 0xe3, 0xff, 0xc7, 0xff, 0xcf, 0xff,
+    0x8f, 0xff, 0x9f, 0xff, 0x1f, 0xfe, 0x3f, 0xf8,
+    0x3f, 0xe0, 0x0, 0x0,
 
     /* U+F4F7 "" */
-    0x2, 0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x3f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0,
-    0x0, 0x1a, 0xcc, 0xcc, 0xb5, 0x1, 0xfd, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xa8, 0xcf, 0xfc, 0x50,
-    0x1, 0x23, 0xef, 0xd1, 0xdf, 0xff, 0xf9, 0x0,
-    0x0, 0xbf, 0xd1, 0x0, 0x22, 0x21, 0x0, 0x0,
-    0xaf, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xfe, 0x20, 0x3, 0x30, 0x0, 0x0, 0x14,
-    0x6c, 0xf9, 0x2e, 0xff, 0xc1, 0x0, 0x0, 0x0,
-    0x3f, 0xbd, 0xfc, 0xdf, 0x80, 0x1d, 0xa5, 0x5c,
-    0xf8, 0xba, 0x3, 0xfb, 0x1, 0xef, 0xff, 0xfd,
-    0x0, 0x0, 0x8f, 0x90, 0x0, 0x69, 0x95, 0x0,
-    0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xcf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xae, 0xee,
-    0xeb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x30, 0x0, 0xe0, 0x3, 0xc0, 0x1, 0x80, 0x3,
+    0x0, 0x6, 0x1f, 0x8c, 0x3f, 0xfc, 0xe, 0xfc,
+    0x38, 0x0, 0xf0, 0x1, 0xf0, 0x0, 0x77, 0x80,
+    0x7f, 0x99, 0xf3, 0x3f, 0xe, 0x18, 0x38, 0x0,
+    0xe0, 0x3, 0x80, 0x7, 0xe0, 0xf, 0xc0, 0x0,
 
     /* U+F0079 "󰁹" */
-    0x0, 0xc, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x80, 0x0, 0x6d, 0xef, 0xff,
-    0xff, 0xff, 0xed, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20,
+    0x1f, 0xc0, 0xfe, 0x1f, 0xfd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0,
 
     /* U+F007A "󰁺" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xf5, 0x22, 0x22, 0x22, 0x25, 0xfe, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x3f, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xef,
-    0xf2, 0x0, 0x0, 0x0, 0x3, 0xfe, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x3f, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xef, 0xf2,
-    0x0, 0x0, 0x0, 0x3, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x2,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x0,
+    0x0, 0x0, 0xfc, 0x7, 0xe1, 0xff, 0xef, 0xff,
+    0xe0, 0xf, 0x0, 0x78, 0x3, 0xc0, 0x1e, 0x0,
+    0xf0, 0x7, 0x80, 0x3c, 0x1, 0xe0, 0xf, 0x0,
+    0x78, 0x3, 0xc0, 0x1e, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
 
     /* U+F007B "󰁻" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xf5, 0x22, 0x22, 0x22, 0x25, 0xfe, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x3f, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xef,
-    0xf2, 0x0, 0x0, 0x0, 0x3, 0xfe, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x3f, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0xff, 0x31, 0x11, 0x11, 0x11, 0x4f, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x2,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x0,
+    0x0, 0x0, 0xfc, 0x7, 0xe1, 0xff, 0xef, 0xff,
+    0xe0, 0xf, 0x0, 0x78, 0x3, 0xc0, 0x1e, 0x0,
+    0xf0, 0x7, 0x80, 0x3c, 0x1, 0xe0, 0xf, 0x0,
+    0x78, 0x3, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
 
     /* U+F007C "󰁼" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xf5, 0x22, 0x22, 0x22, 0x25, 0xfe, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x3f, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xef,
-    0xf2, 0x0, 0x0, 0x0, 0x3, 0xfe, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0xff, 0x53, 0x33, 0x33, 0x33,
-    0x6f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x2,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x0,
+    0x0, 0x0, 0xfc, 0x7, 0xe1, 0xff, 0xef, 0xff,
+    0xe0, 0xf, 0x0, 0x78, 0x3, 0xc0, 0x1e, 0x0,
+    0xf0, 0x7, 0x80, 0x3c, 0x1, 0xe0, 0xf, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
 
     /* U+F007D "󰁽" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xf5, 0x22, 0x22, 0x22, 0x25, 0xfe, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x3f, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xef,
-    0xf2, 0x0, 0x0, 0x0, 0x3, 0xfe, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x3f, 0xef, 0xf5, 0x33, 0x33,
-    0x33, 0x36, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x2,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x0,
+    0x0, 0x0, 0xfc, 0x7, 0xe1, 0xff, 0xef, 0xff,
+    0xe0, 0xf, 0x0, 0x78, 0x3, 0xc0, 0x1e, 0x0,
+    0xf0, 0x7, 0x80, 0x3c, 0x1, 0xe0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
 
     /* U+F007E "󰁾" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xf5, 0x22, 0x22, 0x22, 0x25, 0xfe, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x3f, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xef,
-    0xf2, 0x0, 0x0, 0x0, 0x3, 0xfe, 0xff, 0x97,
-    0x77, 0x77, 0x77, 0x9f, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xfc, 0x7, 0xe1, 0xff, 0xef, 0xff,
+    0xe0, 0xf, 0x0, 0x78, 0x3, 0xc0, 0x1e, 0x0,
+    0xf0, 0x7, 0x80, 0x3e, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
 
     /* U+F007F "󰁿" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xf5, 0x22, 0x22, 0x22, 0x25, 0xfe, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x3f, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xef,
-    0xf9, 0x88, 0x88, 0x88, 0x8a, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xfc, 0x7, 0xe1, 0xff, 0xef, 0xff,
+    0xe0, 0xf, 0x0, 0x78, 0x3, 0xc0, 0x1e, 0x0,
+    0xf0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
 
     /* U+F0080 "󰂀" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xf5, 0x22, 0x22, 0x22, 0x25, 0xfe, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x3f, 0xef, 0xfb, 0xaa, 0xaa, 0xaa, 0xab,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xfc, 0x7, 0xe1, 0xff, 0xef, 0xff,
+    0xe0, 0xf, 0x0, 0x78, 0x3, 0xc0, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
 
     /* U+F0081 "󰂁" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xf5, 0x22, 0x22, 0x22, 0x25, 0xfe, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0xff, 0xcb, 0xbb, 0xbb,
-    0xbb, 0xcf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xfc, 0x7, 0xe1, 0xff, 0xef, 0xff,
+    0xe0, 0xf, 0x0, 0x78, 0x3, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
 
     /* U+F0082 "󰂂" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xf5, 0x22, 0x22, 0x22, 0x25, 0xfe, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xef, 0xfc, 0xbb,
-    0xbb, 0xbb, 0xbc, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xfc, 0x7, 0xe1, 0xff, 0xef, 0xff,
+    0xe0, 0xf, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
 
     /* U+F0083 "󰂃" */
-    0x0, 0xb, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xc0, 0x0, 0x6d, 0xef, 0xff,
-    0xff, 0xff, 0xee, 0x7e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef,
-    0xff, 0xf9, 0x69, 0xff, 0xff, 0xee, 0xff, 0xff,
-    0x50, 0x4f, 0xff, 0xfe, 0xef, 0xff, 0xf5, 0x4,
-    0xff, 0xff, 0xee, 0xff, 0xff, 0x50, 0x4f, 0xff,
-    0xfe, 0xef, 0xff, 0xf5, 0x4, 0xff, 0xff, 0xee,
-    0xff, 0xff, 0x50, 0x4f, 0xff, 0xfe, 0xef, 0xff,
-    0xf7, 0x16, 0xff, 0xff, 0xee, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xee, 0xff, 0xff, 0x50, 0x4f, 0xff, 0xfe,
-    0xef, 0xff, 0xf6, 0x5, 0xff, 0xff, 0xee, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20,
+    0x1f, 0xc0, 0xfe, 0x1f, 0xfd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0xff, 0x1f, 0xf8, 0xff, 0xc7,
+    0xfe, 0x3f, 0xf1, 0xff, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0x1f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0,
 
     /* U+F0084 "󰂄" */
-    0x0, 0xc, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xc0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xd6, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xf5, 0x6f, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0x6,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0x30, 0x6f, 0xff,
-    0xfe, 0xff, 0xff, 0xa0, 0x6, 0xff, 0xff, 0xef,
-    0xff, 0xf2, 0x0, 0x2, 0x9f, 0xfe, 0xff, 0xf8,
-    0x0, 0x0, 0x1e, 0xff, 0xef, 0xff, 0xee, 0x40,
-    0x9, 0xff, 0xfe, 0xff, 0xff, 0xf5, 0x2, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0x50, 0xbf, 0xff, 0xfe,
-    0xff, 0xff, 0xf5, 0x4f, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0x5d, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xc0, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfb, 0xff, 0x9f, 0xfc, 0xff, 0xc7,
+    0xfe, 0x3f, 0xe0, 0xff, 0x7, 0xfc, 0x7f, 0xe3,
+    0xff, 0x3f, 0xf9, 0xff, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0,
 
     /* U+F0085 "󰂅" */
-    0x0, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x9c,
-    0xff, 0xff, 0xdc, 0x20, 0x0, 0x20, 0xf, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x9, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x7, 0xa0, 0xf, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0xea, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x7f, 0xa0, 0xf, 0xff, 0xff, 0xff,
-    0xf6, 0xe, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff,
-    0x67, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xf6,
-    0x34, 0xdf, 0xa0, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xc, 0xf3, 0xf, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0xcc, 0x0, 0xff, 0xff, 0xff, 0xff, 0x60, 0xc,
-    0x40, 0xf, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x90,
-    0x0, 0xad, 0xdd, 0xdd, 0xdc, 0x30, 0x2, 0x0,
-    0x0,
+    0x0, 0x0, 0x78, 0x3, 0xfc, 0x7, 0xf8, 0x4f,
+    0xf0, 0x9f, 0xe3, 0x3f, 0xc6, 0x7f, 0x9e, 0xff,
+    0x3d, 0xfe, 0x3b, 0xfc, 0x67, 0xf8, 0xcf, 0xf1,
+    0x1f, 0xe2, 0x3f, 0xc0, 0x0,
 
     /* U+F0086 "󰂆" */
-    0x0, 0x56, 0x66, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x40, 0xf, 0xa6,
-    0x66, 0x66, 0xf6, 0x0, 0x2a, 0x0, 0xf6, 0x0,
-    0x0, 0xf, 0x60, 0x9, 0xa0, 0xf, 0x60, 0x0,
-    0x0, 0xf6, 0x2, 0xfa, 0x0, 0xf6, 0x0, 0x0,
-    0xf, 0x60, 0x9f, 0xb1, 0x1f, 0x60, 0x0, 0x0,
-    0xf6, 0x2f, 0xff, 0xf7, 0xf6, 0x0, 0x0, 0xf,
-    0x69, 0xff, 0xff, 0x1f, 0x60, 0x0, 0x0, 0xf6,
-    0x0, 0xbf, 0x80, 0xf6, 0x0, 0x0, 0xf, 0x60,
-    0xb, 0xf1, 0xf, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0xba, 0x0, 0xff, 0xff, 0xff, 0xff, 0x60, 0xb,
-    0x20, 0xf, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x70,
-    0x0, 0x58, 0x88, 0x88, 0x87, 0x10, 0x1, 0x0,
-    0x0,
+    0x0, 0x0, 0x78, 0x3, 0xfc, 0x6, 0x8, 0x48,
+    0x11, 0x90, 0x23, 0x20, 0x4e, 0x40, 0x9e, 0x81,
+    0x7d, 0x2, 0x3a, 0x4, 0x67, 0xf8, 0xcf, 0xf1,
+    0x1f, 0xe0, 0x1f, 0x80, 0x0,
 
     /* U+F0087 "󰂇" */
-    0x0, 0x56, 0x66, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x40, 0xf, 0xa6,
-    0x66, 0x66, 0xf6, 0x0, 0x1a, 0x0, 0xf6, 0x0,
-    0x0, 0xf, 0x60, 0x9, 0xa0, 0xf, 0x60, 0x0,
-    0x0, 0xf6, 0x1, 0xfa, 0x0, 0xf6, 0x0, 0x0,
-    0xf, 0x60, 0x8f, 0xa0, 0xf, 0x60, 0x0, 0x0,
-    0xf6, 0x1f, 0xff, 0xf8, 0xf6, 0x0, 0x0, 0xf,
-    0x68, 0xff, 0xff, 0x1f, 0x60, 0x0, 0x0, 0xf6,
-    0x33, 0xdf, 0xa0, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xc, 0xf3, 0xf, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0xcb, 0x0, 0xff, 0xff, 0xff, 0xff, 0x60, 0xc,
-    0x40, 0xf, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x90,
-    0x0, 0xad, 0xdd, 0xdd, 0xdd, 0x30, 0x2, 0x0,
-    0x0,
+    0x0, 0x0, 0x78, 0x3, 0xfc, 0x6, 0x8, 0x48,
+    0x11, 0x90, 0x23, 0x20, 0x4e, 0x40, 0x9f, 0x81,
+    0x7d, 0x2, 0x3b, 0xfc, 0x67, 0xf8, 0xcf, 0xf1,
+    0x1f, 0xe2, 0x3f, 0xc0, 0x0,
 
     /* U+F0088 "󰂈" */
-    0x0, 0x56, 0x66, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x40, 0xf, 0xa6,
-    0x66, 0x66, 0xf6, 0x0, 0x2a, 0x0, 0xf6, 0x0,
-    0x0, 0xf, 0x60, 0xa, 0xa0, 0xf, 0x60, 0x0,
-    0x0, 0xf6, 0x2, 0xfa, 0x0, 0xf6, 0x0, 0x0,
-    0xf, 0x60, 0xaf, 0xb3, 0x2f, 0x60, 0x0, 0x0,
-    0xf6, 0x3f, 0xff, 0xf6, 0xf6, 0x0, 0x0, 0xf,
-    0x68, 0xdf, 0xfe, 0xf, 0xed, 0xdd, 0xdd, 0xf6,
-    0x0, 0xcf, 0x80, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xc, 0xf1, 0xf, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0xc9, 0x0, 0xff, 0xff, 0xff, 0xff, 0x60, 0xc,
-    0x20, 0xf, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x60,
-    0x0, 0x46, 0x66, 0x66, 0x66, 0x10, 0x0, 0x0,
-    0x0,
+    0x0, 0x0, 0x78, 0x3, 0xfc, 0x6, 0x8, 0x48,
+    0x11, 0x90, 0x23, 0x20, 0x4e, 0x40, 0x9e, 0x81,
+    0x7d, 0xfe, 0x3b, 0xfc, 0x67, 0xf8, 0xcf, 0xf1,
+    0x1f, 0xe0, 0x0, 0x0, 0x0,
 
     /* U+F0089 "󰂉" */
-    0x0, 0x56, 0x66, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x40, 0xf, 0xa6,
-    0x66, 0x66, 0xf6, 0x0, 0x1a, 0x0, 0xf6, 0x0,
-    0x0, 0xf, 0x60, 0x9, 0xa0, 0xf, 0x60, 0x0,
-    0x0, 0xf6, 0x1, 0xfa, 0x0, 0xf6, 0x0, 0x0,
-    0xf, 0x60, 0x9f, 0xa0, 0xf, 0xff, 0xff, 0xff,
-    0xf6, 0x1f, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0x69, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0xcf, 0x90, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xc, 0xf2, 0xf, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0xca, 0x0, 0xff, 0xff, 0xff, 0xff, 0x60, 0xc,
-    0x30, 0xf, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x80,
-    0x0, 0x7a, 0xaa, 0xaa, 0xa9, 0x10, 0x1, 0x0,
-    0x0,
+    0x0, 0x0, 0x78, 0x3, 0xfc, 0x6, 0x8, 0x48,
+    0x11, 0x90, 0x23, 0x20, 0x4e, 0x7f, 0x9f, 0xff,
+    0x7d, 0xfe, 0x3b, 0xfc, 0x67, 0xf8, 0xcf, 0xf1,
+    0x1f, 0xe2, 0x1f, 0xc0, 0x0,
 
     /* U+F008A "󰂊" */
-    0x0, 0x56, 0x66, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x40, 0xf, 0xa6,
-    0x66, 0x66, 0xf6, 0x0, 0x1a, 0x0, 0xf6, 0x0,
-    0x0, 0xf, 0x60, 0x9, 0xa0, 0xf, 0x84, 0x44,
-    0x44, 0xf6, 0x1, 0xfa, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x8f, 0xa0, 0xf, 0xff, 0xff, 0xff,
-    0xf6, 0x1f, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff,
-    0x68, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xf6,
-    0x34, 0xdf, 0xa0, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xc, 0xf3, 0xf, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0xcc, 0x0, 0xff, 0xff, 0xff, 0xff, 0x60, 0xc,
-    0x40, 0xf, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x90,
-    0x0, 0xad, 0xdd, 0xdd, 0xdd, 0x30, 0x2, 0x0,
-    0x0,
+    0x0, 0x0, 0x78, 0x3, 0xfc, 0x6, 0x8, 0x48,
+    0x11, 0x98, 0x23, 0x3f, 0xce, 0x7f, 0x9e, 0xff,
+    0x7d, 0xfe, 0x3b, 0xfc, 0x67, 0xf8, 0xcf, 0xf1,
+    0x1f, 0xe2, 0x3f, 0xc0, 0x0,
 
     /* U+F008B "󰂋" */
-    0x0, 0x56, 0x66, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x40, 0xf, 0xa6,
-    0x66, 0x66, 0xf6, 0x0, 0x1a, 0x0, 0xf6, 0x0,
-    0x0, 0xf, 0x60, 0x9, 0xa0, 0xf, 0xff, 0xff,
-    0xff, 0xf6, 0x1, 0xfa, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x8f, 0xa0, 0xf, 0xff, 0xff, 0xff,
-    0xf6, 0x1f, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff,
-    0x68, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xf6,
-    0x22, 0xcf, 0xa0, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xc, 0xf3, 0xf, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0xcb, 0x0, 0xff, 0xff, 0xff, 0xff, 0x60, 0xc,
-    0x40, 0xf, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x90,
-    0x0, 0x8c, 0xcc, 0xcc, 0xcb, 0x20, 0x2, 0x0,
-    0x0,
+    0x0, 0x0, 0x78, 0x3, 0xfc, 0x6, 0x8, 0x48,
+    0x11, 0x9f, 0xe3, 0x3f, 0xce, 0x7f, 0x9f, 0xff,
+    0x7d, 0xfe, 0x3b, 0xfc, 0x67, 0xf8, 0xcf, 0xf1,
+    0x1f, 0xe2, 0x3f, 0xc0, 0x0,
 
     /* U+F008C "󰂌" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x70, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf7, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
-    0xf9, 0x88, 0x88, 0x88, 0x8a, 0xfe, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x3f, 0xef, 0xf5, 0x44, 0x44,
-    0x44, 0x46, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x2,
-    0x33, 0x33, 0x33, 0x33, 0x32, 0x0,
+    0x0, 0x0, 0xfc, 0x7, 0xe1, 0xff, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x1, 0xe0, 0xf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
 
     /* U+F008D "󰂍" */
-    0x0, 0x44, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xf, 0x96,
-    0x66, 0x69, 0xf0, 0x0, 0x0, 0x0, 0xf5, 0x0,
-    0x0, 0x4f, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0,
-    0x4, 0xf0, 0x0, 0x0, 0x0, 0xf5, 0x0, 0x0,
-    0x4f, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0, 0x4,
-    0xf0, 0x49, 0x99, 0x98, 0xff, 0xff, 0xff, 0xff,
-    0x5, 0xcc, 0xcc, 0xbf, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x1, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0,
-    0x0,
+    0x0, 0x0, 0x78, 0x3, 0xfc, 0x6, 0x18, 0x8,
+    0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x9f, 0xff,
+    0x3f, 0xfe, 0x3, 0xfc, 0x7, 0xf8, 0xf, 0xf0,
+    0x1f, 0xe0, 0x0, 0x0, 0x0,
 
     /* U+F008E "󰂎" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf6, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xf5, 0x22, 0x22, 0x22, 0x25, 0xfe, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x3f, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xef,
-    0xf2, 0x0, 0x0, 0x0, 0x3, 0xfe, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x3f, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xef, 0xf2,
-    0x0, 0x0, 0x0, 0x3, 0xfe, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x3f, 0xef, 0xf2, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x1,
-    0x22, 0x22, 0x22, 0x22, 0x21, 0x0,
+    0x0, 0x0, 0xfc, 0x7, 0xe1, 0xff, 0xef, 0xff,
+    0xe0, 0xf, 0x0, 0x78, 0x3, 0xc0, 0x1e, 0x0,
+    0xf0, 0x7, 0x80, 0x3c, 0x1, 0xe0, 0xf, 0x0,
+    0x78, 0x3, 0xc0, 0x1e, 0x0, 0xf0, 0x7, 0x80,
+    0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0,
 
     /* U+F008F "󰂏" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x70, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf7, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf9, 0x59,
-    0xff, 0xff, 0xef, 0xff, 0xff, 0x50, 0x6f, 0xff,
-    0xfe, 0xff, 0xff, 0xf5, 0x6, 0xff, 0xff, 0xef,
-    0xf9, 0x88, 0x20, 0x38, 0x8a, 0xfe, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x3f, 0xef, 0xf6, 0x44, 0x10,
-    0x14, 0x46, 0xfe, 0xff, 0xff, 0xf5, 0x6, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0x50, 0x6f, 0xff, 0xfe,
-    0xff, 0xff, 0xf6, 0x17, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x2,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x0,
+    0x0, 0x0, 0xfc, 0x7, 0xe1, 0xff, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xc7,
+    0xfe, 0x3f, 0xf1, 0xfc, 0x1, 0xe0, 0xf, 0xe3,
+    0xff, 0x1f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
 
     /* U+F0090 "󰂐" */
-    0x0, 0x44, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xf, 0x96,
-    0x66, 0x69, 0xf0, 0x0, 0x0, 0x0, 0xf5, 0x0,
-    0x0, 0x4f, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0,
-    0x4, 0xf0, 0x0, 0x48, 0x0, 0xf5, 0x0, 0x0,
-    0x4f, 0x0, 0x7, 0xe0, 0xf, 0x50, 0x0, 0x4,
-    0xf0, 0x49, 0xcf, 0x98, 0xff, 0xff, 0xff, 0xff,
-    0x5, 0xcd, 0xfc, 0xbf, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x7e, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x5, 0xb0, 0xf, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x1, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0,
-    0x0,
+    0x0, 0x0, 0x78, 0x3, 0xfc, 0x6, 0x18, 0x8,
+    0x10, 0x10, 0x21, 0x20, 0x42, 0x40, 0x9f, 0xff,
+    0x3f, 0xfe, 0x13, 0xfc, 0x27, 0xf8, 0xf, 0xf0,
+    0x1f, 0xe0, 0x0, 0x0, 0x0,
 
     /* U+F0091 "󰂑" */
-    0x0, 0xe, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x7e, 0xef, 0xff,
-    0xff, 0xff, 0xed, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xb6, 0x46, 0xcf, 0xff,
-    0xef, 0xff, 0x70, 0x0, 0x0, 0x8f, 0xfe, 0xff,
-    0xa0, 0x5, 0x83, 0x0, 0xcf, 0xef, 0xf4, 0x8,
-    0xff, 0xf3, 0x5, 0xfe, 0xff, 0x98, 0xef, 0xff,
-    0x80, 0x4f, 0xef, 0xff, 0xff, 0xff, 0xf3, 0x6,
-    0xfe, 0xff, 0xff, 0xff, 0xf6, 0x1, 0xef, 0xef,
-    0xff, 0xff, 0xf7, 0x0, 0xcf, 0xfe, 0xff, 0xff,
-    0xfc, 0x0, 0xbf, 0xff, 0xef, 0xff, 0xff, 0x92,
-    0x4f, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xf5, 0x6, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0x50, 0x6f, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20,
+    0x1f, 0x80, 0xfc, 0x1f, 0xfd, 0xff, 0xff, 0x8f,
+    0xf0, 0x3f, 0x88, 0xf9, 0xe3, 0xff, 0x9f, 0xf8,
+    0xff, 0x8f, 0xf8, 0xff, 0xcf, 0xfe, 0x7f, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xc7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x80, 0x0,
 
     /* U+F00AF "󰂯" */
-    0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x80, 0x0, 0x0, 0x36,
-    0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x1e, 0xf7,
-    0x0, 0xf, 0xf9, 0xff, 0x80, 0x0, 0x8f, 0xf7,
-    0x0, 0xff, 0x17, 0xff, 0x80, 0x0, 0x8f, 0xf7,
-    0xf, 0xf1, 0x6f, 0xfa, 0x0, 0x0, 0x8f, 0xf7,
-    0xff, 0x7f, 0xfa, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x5f, 0xfa, 0xff, 0xaf, 0xf6,
-    0x0, 0x0, 0x5f, 0xfa, 0xf, 0xf1, 0x9f, 0xf6,
-    0x0, 0x5f, 0xfa, 0x0, 0xff, 0x14, 0xff, 0xb0,
-    0x1f, 0xfa, 0x0, 0xf, 0xf5, 0xff, 0xb0, 0x0,
-    0x5a, 0x0, 0x0, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x20, 0x0, 0x0, 0x0,
+    0x1, 0x80, 0x3, 0x80, 0x7, 0x80, 0xf, 0x86,
+    0x1f, 0x8e, 0x33, 0x8e, 0x67, 0xe, 0xdc, 0xf,
+    0xf0, 0xf, 0xc0, 0xf, 0x0, 0x1e, 0x0, 0x7e,
+    0x1, 0xfe, 0x7, 0x6e, 0x1c, 0xce, 0x71, 0xb8,
+    0x43, 0xe0, 0x7, 0x80, 0xe, 0x0, 0x18, 0x0,
+    0x0, 0x0,
 
     /* U+F00B0 "󰂰" */
-    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0x0, 0x0, 0x0, 0x5, 0x90,
-    0x1, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xa0,
-    0x1f, 0x99, 0xfa, 0x0, 0x4, 0x0, 0xaf, 0xa1,
-    0xf9, 0x3f, 0xf2, 0x4, 0xf2, 0x0, 0xaf, 0xbf,
-    0xcf, 0xf3, 0x0, 0x1f, 0x70, 0x0, 0xaf, 0xff,
-    0xf3, 0x8, 0x50, 0xca, 0x0, 0x0, 0xbf, 0xf3,
-    0x6, 0xf7, 0xb, 0xb0, 0x0, 0x3e, 0xff, 0xa0,
-    0x2e, 0x60, 0xbb, 0x0, 0x3f, 0xff, 0xff, 0xa0,
-    0x22, 0xe, 0x80, 0x3f, 0xe4, 0xf9, 0xaf, 0xa0,
-    0x4, 0xf4, 0x3f, 0xe3, 0x1f, 0x92, 0xff, 0x20,
-    0x1a, 0xb, 0xe3, 0x1, 0xfb, 0xef, 0x40, 0x0,
-    0x0, 0x2, 0x0, 0x1f, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0x0, 0x1c, 0x2, 0x3c, 0xe,
+    0x7c, 0xe, 0xd8, 0x8f, 0xe1, 0xf, 0x93, 0xe,
+    0x26, 0x1e, 0x4c, 0x7e, 0x19, 0xbe, 0x26, 0x6c,
+    0x58, 0xf0, 0x1, 0xc0, 0x3, 0x0, 0x4, 0x0,
 
     /* U+F00B1 "󰂱" */
-    0x0, 0x0, 0x0, 0x3, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xa, 0x30, 0x8, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x2e, 0xf3, 0x8, 0xf4, 0xef, 0x40, 0x0,
-    0x0, 0x3, 0xef, 0x38, 0xf1, 0xbf, 0xa0, 0x0,
-    0x0, 0x0, 0x3e, 0xfc, 0xfb, 0xfa, 0x0, 0x0,
-    0x0, 0xa1, 0x3, 0xef, 0xff, 0xa0, 0x6, 0x60,
-    0xc, 0xfd, 0x0, 0x3f, 0xfb, 0x0, 0x4f, 0xf5,
-    0x6, 0xf6, 0x0, 0x9f, 0xff, 0x30, 0x1d, 0xd1,
-    0x0, 0x20, 0x9, 0xff, 0xff, 0xf3, 0x1, 0x10,
-    0x0, 0x0, 0x9f, 0xa8, 0xf4, 0xff, 0x30, 0x0,
-    0x0, 0x9, 0xfa, 0x8, 0xf1, 0xaf, 0xa0, 0x0,
-    0x0, 0x3f, 0xa0, 0x8, 0xfa, 0xfb, 0x0, 0x0,
-    0x0, 0x3, 0x0, 0x8, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x80, 0x1, 0xc0, 0x11, 0xe0,
+    0x19, 0xb0, 0xd, 0xb8, 0x7, 0xf0, 0x23, 0xe0,
+    0x71, 0xc6, 0x23, 0xc6, 0x7, 0xe0, 0xf, 0xb0,
+    0x1d, 0xb8, 0x19, 0xf0, 0x1, 0xe0, 0x1, 0xc0,
+    0x1, 0x80,
 
     /* U+F00B2 "󰂲" */
-    0x0, 0x0, 0x0, 0x5, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0,
-    0x2, 0x40, 0x0, 0xb, 0xff, 0x30, 0x0, 0x0,
-    0xe, 0xf4, 0x0, 0xb, 0xff, 0xf3, 0x0, 0x0,
-    0x5, 0xff, 0x40, 0xb, 0xf8, 0xff, 0x30, 0x0,
-    0x0, 0x5f, 0xf4, 0x6, 0xf1, 0x8f, 0xf2, 0x0,
-    0x0, 0x6, 0xff, 0x40, 0x62, 0xdf, 0xa0, 0x0,
-    0x0, 0x0, 0x6f, 0xf4, 0x5, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x40, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0xac, 0xf7, 0xff, 0x40, 0x0,
-    0x0, 0x1c, 0xfa, 0xb, 0xf1, 0x7f, 0xf4, 0x0,
-    0x0, 0xcf, 0xa0, 0xb, 0xf3, 0xdf, 0xff, 0x40,
-    0x0, 0xaa, 0x0, 0xb, 0xfe, 0xfa, 0x6f, 0xf3,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xa0, 0x6, 0xc1,
-    0x0, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x80, 0x1, 0xc0, 0x61, 0xe0,
+    0x31, 0xf0, 0x18, 0xb8, 0xc, 0x38, 0x6, 0x30,
+    0x3, 0x0, 0x1, 0x80, 0x3, 0xc0, 0x7, 0xe0,
+    0xf, 0xb0, 0x1d, 0x98, 0x39, 0xbc, 0x31, 0xf6,
+    0x1, 0xe2, 0x1, 0xc0, 0x1, 0x80,
 
     /* U+F00B3 "󰂳" */
-    0x0, 0x0, 0x1, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x40, 0x0, 0x1, 0x0, 0x1, 0xff,
-    0xf4, 0x0, 0x1e, 0x90, 0x1, 0xfd, 0xff, 0x40,
-    0xc, 0xfa, 0x1, 0xfa, 0x3f, 0xf4, 0x0, 0xcf,
-    0xa1, 0xfa, 0x2e, 0xf6, 0x0, 0xc, 0xfb, 0xfc,
-    0xef, 0x60, 0x0, 0x0, 0xcf, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x3e, 0xff, 0xb0, 0x0, 0x0, 0x3, 0xef, 0xff,
-    0xfb, 0x0, 0x0, 0x3e, 0xf7, 0xfb, 0xcf, 0xb0,
-    0x3, 0xef, 0x61, 0xfa, 0xe, 0xfa, 0x2e, 0xf6,
-    0x1, 0xfa, 0x8f, 0xe2, 0xb, 0x60, 0x1, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0x1, 0xff, 0xe2, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8b, 0x0, 0xb7, 0x5, 0xb3,
-    0x0, 0xbf, 0x11, 0xfa, 0x7, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x2, 0x0, 0x30, 0x3, 0x86, 0x3c, 0x73, 0x63,
+    0xb6, 0x1f, 0xc0, 0xf8, 0x7, 0x0, 0x78, 0xf,
+    0xc1, 0xbe, 0x33, 0x76, 0x3e, 0x43, 0xc0, 0x38,
+    0x3, 0x0, 0x20, 0x0, 0x3, 0x22, 0x33, 0x20,
+    0x0,
 
     /* U+F00B4 "󰂴" */
-    0x0, 0x0, 0x67, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf7, 0x0, 0x0, 0x1, 0x0, 0x13,
-    0x0, 0x8f, 0xf7, 0x0, 0x1, 0xe3, 0xb, 0xe3,
-    0x8, 0xe9, 0xf7, 0x0, 0xcf, 0xd0, 0x1d, 0xe3,
-    0x8e, 0xe, 0xf2, 0x4b, 0xfc, 0x50, 0x1d, 0xeb,
-    0xeb, 0xf5, 0x0, 0x2f, 0x50, 0x0, 0x1d, 0xff,
-    0xf5, 0x0, 0x2, 0xe4, 0x0, 0x0, 0x2f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xe2,
-    0x0, 0x1, 0xa3, 0x0, 0xb, 0xfd, 0xfd, 0xe2,
-    0x0, 0x2f, 0x50, 0xb, 0xf5, 0x8e, 0x1e, 0xe2,
-    0x38, 0xf9, 0x4a, 0xf5, 0x8, 0xe6, 0xfb, 0x1,
-    0xef, 0xf2, 0x45, 0x0, 0x8f, 0xfb, 0x0, 0x3,
-    0xf5, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0x3,
-    0x0, 0x0, 0x0, 0x8a, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    0x0, 0x0, 0x18, 0x0, 0x38, 0x26, 0x78, 0xe6,
+    0xd9, 0xc7, 0xe1, 0x7, 0x82, 0x6, 0x0, 0x1e,
+    0x8, 0x7e, 0x11, 0xb6, 0x76, 0x6c, 0xe0, 0xf0,
+    0x81, 0xc0, 0x3, 0x0, 0x0,
 
     /* U+F03A0 "󰎠" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x8, 0xff, 0xf8, 0x8, 0xff, 0xf7, 0x7b,
-    0xf0, 0x37, 0x7c, 0xe0, 0x37, 0x7c, 0xe0, 0x8f,
-    0x0, 0x1, 0x9e, 0x0, 0x1, 0x9e, 0x8, 0xf0,
-    0x3f, 0xff, 0xb0, 0x0, 0xff, 0x70, 0x8f, 0x8,
-    0xf5, 0x50, 0x0, 0x5, 0xbd, 0x8, 0xf0, 0x8e,
-    0x0, 0x0, 0x0, 0x9, 0xe0, 0x8f, 0x8, 0xff,
-    0xfe, 0x8, 0xff, 0xfc, 0x3, 0x60, 0x37, 0x77,
-    0x60, 0x37, 0x76, 0x10,
+    0x0, 0x1, 0xdf, 0x79, 0x86, 0x1b, 0xc, 0x36,
+    0x78, 0xcd, 0x80, 0xdb, 0x1, 0xb7, 0xdf, 0x0,
+    0x0,
 
     /* U+F03A1 "󰎡" */
-    0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xb5, 0x55, 0xdf, 0xff, 0xfd, 0xff, 0xff,
-    0xf0, 0x0, 0x3, 0xff, 0xff, 0xdf, 0xff, 0xfe,
-    0x7, 0xd1, 0x1f, 0xff, 0xfd, 0xff, 0xff, 0xe0,
-    0x8f, 0x11, 0xff, 0xff, 0xdf, 0xff, 0xfe, 0x8,
-    0xf1, 0x1f, 0xff, 0xfd, 0xff, 0xff, 0xe0, 0x8f,
-    0x11, 0xff, 0xff, 0xdf, 0xff, 0xfe, 0x8, 0xf1,
-    0x1f, 0xff, 0xfd, 0xff, 0xff, 0xf0, 0x0, 0x3,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xb5, 0x45, 0xdf,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x50,
+    0x7f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
+    0x83, 0xff, 0x27, 0xfe, 0xcf, 0xfd, 0x9f, 0xfb,
+    0x3f, 0xf6, 0x7f, 0xe0, 0xff, 0xe3, 0xff, 0xff,
+    0xff, 0xff, 0xdf, 0xff, 0x0,
 
     /* U+F03A2 "󰎢" */
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70,
-    0x4, 0xf6, 0x66, 0x66, 0x66, 0x66, 0xae, 0x10,
-    0x4f, 0x0, 0x0, 0x10, 0x0, 0x6, 0xef, 0x54,
-    0xf0, 0x1, 0xef, 0xf9, 0x0, 0x6e, 0xf5, 0x4f,
-    0x0, 0x4f, 0x49, 0xe0, 0x6, 0xef, 0x54, 0xf0,
-    0x4, 0xf0, 0x6e, 0x0, 0x6e, 0xf5, 0x4f, 0x0,
-    0x4f, 0x6, 0xe0, 0x6, 0xef, 0x54, 0xf0, 0x4,
-    0xf0, 0x6e, 0x0, 0x6e, 0xf5, 0x4f, 0x0, 0x2f,
-    0xff, 0xc0, 0x6, 0xef, 0x54, 0xf0, 0x0, 0x36,
-    0x61, 0x0, 0x6e, 0xf5, 0x4f, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0x52, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xf5, 0x2, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0xf, 0x95, 0x55, 0x55, 0x55, 0x55, 0x50,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0,
+    0x1f, 0xfc, 0x20, 0xc, 0x40, 0xc, 0x8f, 0x19,
+    0x16, 0x32, 0x24, 0x64, 0x48, 0xc8, 0x91, 0x91,
+    0xe3, 0x20, 0x6, 0x40, 0xc, 0xff, 0xf8, 0x0,
+    0x18, 0x0, 0x3f, 0xfc, 0x0,
 
     /* U+F03A3 "󰎣" */
-    0x3a, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb9, 0x1e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xbf, 0xa0,
-    0x0, 0x39, 0x98, 0x10, 0x0, 0xeb, 0xfa, 0x0,
-    0xe, 0xff, 0xfc, 0x0, 0xe, 0xbf, 0xa0, 0x1,
-    0xf9, 0xb, 0xe0, 0x0, 0xeb, 0xfa, 0x0, 0x1f,
-    0x90, 0xbe, 0x0, 0xe, 0xbf, 0xa0, 0x1, 0xf9,
-    0xb, 0xe0, 0x0, 0xeb, 0xfa, 0x0, 0x1f, 0x90,
-    0xbe, 0x0, 0xe, 0xbf, 0xa0, 0x1, 0xf9, 0xb,
-    0xe0, 0x0, 0xeb, 0xfa, 0x0, 0xf, 0xff, 0xfc,
-    0x0, 0xe, 0xbf, 0xa0, 0x0, 0x4a, 0xba, 0x20,
-    0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xbf, 0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xfb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x30,
+    0x7f, 0xfd, 0xff, 0xff, 0x0, 0x1e, 0x1c, 0x3c,
+    0x7c, 0x78, 0xd8, 0xf1, 0xb1, 0xe3, 0x63, 0xc6,
+    0xc7, 0x8d, 0x8f, 0x1f, 0x1e, 0x1c, 0x3c, 0x0,
+    0x7f, 0xff, 0xdf, 0xff, 0x0,
 
     /* U+F03A4 "󰎤" */
-    0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0xc4, 0x44, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xfb, 0x0, 0xf, 0xff, 0xff, 0xcf, 0xff, 0xff,
-    0xfd, 0x50, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xf6, 0xf, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
-    0x60, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf6,
-    0xf, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x60,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf6, 0xf,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x84, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x40,
+    0x7f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
+    0xc7, 0xff, 0xcf, 0xff, 0x9f, 0xff, 0x3f, 0xfe,
+    0x7f, 0xfc, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xff,
+    0xff, 0xff, 0xdf, 0xff, 0x0,
 
     /* U+F03A5 "󰎥" */
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70,
-    0x4, 0xf6, 0x66, 0x66, 0x66, 0x66, 0xae, 0x10,
-    0x4f, 0x0, 0x0, 0x11, 0x0, 0x6, 0xef, 0x54,
-    0xf0, 0x0, 0x9f, 0xf0, 0x0, 0x6e, 0xf5, 0x4f,
-    0x0, 0x2, 0x7f, 0x0, 0x6, 0xef, 0x54, 0xf0,
-    0x0, 0x4, 0xf0, 0x0, 0x6e, 0xf5, 0x4f, 0x0,
-    0x0, 0x4f, 0x0, 0x6, 0xef, 0x54, 0xf0, 0x0,
-    0x4, 0xf0, 0x0, 0x6e, 0xf5, 0x4f, 0x0, 0x0,
-    0x4f, 0x0, 0x6, 0xef, 0x54, 0xf0, 0x0, 0x2,
-    0x90, 0x0, 0x6e, 0xf5, 0x4f, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0x52, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xf5, 0x2, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0xf, 0x95, 0x55, 0x55, 0x55, 0x55, 0x50,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0,
+    0x1f, 0xfc, 0x20, 0xc, 0x40, 0xc, 0x8e, 0x19,
+    0x4, 0x32, 0x8, 0x64, 0x10, 0xc8, 0x21, 0x90,
+    0x43, 0x20, 0x86, 0x40, 0xc, 0xff, 0xf8, 0x0,
+    0x18, 0x0, 0x3f, 0xfc, 0x0,
 
     /* U+F03A6 "󰎦" */
-    0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0x1e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xbf, 0xa0,
-    0x0, 0x29, 0x99, 0x0, 0x0, 0xeb, 0xfa, 0x0,
-    0x4, 0xff, 0xf0, 0x0, 0xe, 0xbf, 0xa0, 0x0,
-    0x0, 0xaf, 0x0, 0x0, 0xeb, 0xfa, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0xe, 0xbf, 0xa0, 0x0, 0x0,
-    0x9f, 0x0, 0x0, 0xeb, 0xfa, 0x0, 0x0, 0x9,
-    0xf0, 0x0, 0xe, 0xbf, 0xa0, 0x0, 0x0, 0x9f,
-    0x0, 0x0, 0xeb, 0xfa, 0x0, 0x0, 0x9, 0xf0,
-    0x0, 0xe, 0xbf, 0xa0, 0x0, 0x0, 0x59, 0x0,
-    0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xbf, 0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xfb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x30,
+    0x7f, 0xfd, 0xff, 0xff, 0x0, 0x1e, 0x1c, 0x3c,
+    0x38, 0x78, 0x30, 0xf0, 0x61, 0xe0, 0xc3, 0xc1,
+    0x87, 0x83, 0xf, 0x6, 0x1e, 0x4, 0x3c, 0x0,
+    0x7f, 0xff, 0xdf, 0xff, 0x0,
 
     /* U+F03A7 "󰎧" */
-    0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0x44, 0x45, 0xdf, 0xff, 0xfd, 0xff, 0xff,
-    0xe0, 0x0, 0x3, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xf2, 0x1f, 0xff, 0xfd, 0xff, 0xff, 0xff,
-    0xba, 0x21, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x30,
-    0x0, 0x5f, 0xff, 0xfd, 0xff, 0xff, 0xe0, 0x39,
-    0xaf, 0xff, 0xff, 0xdf, 0xff, 0xfe, 0x5, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xe0, 0x0, 0x1,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0x44, 0x44, 0x5f,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x50,
+    0x7f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff,
+    0x83, 0xff, 0xe7, 0xff, 0xcf, 0xfc, 0x1f, 0xf9,
+    0xff, 0xf3, 0xff, 0xe0, 0xff, 0xc1, 0xff, 0xff,
+    0xff, 0xff, 0xdf, 0xff, 0x0,
 
     /* U+F03A8 "󰎨" */
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70,
-    0x4, 0xf6, 0x66, 0x66, 0x66, 0x66, 0xae, 0x10,
-    0x4f, 0x0, 0x1, 0x10, 0x0, 0x6, 0xef, 0x54,
-    0xf0, 0x4, 0xff, 0xf9, 0x0, 0x6e, 0xf5, 0x4f,
-    0x0, 0x13, 0x39, 0xe0, 0x6, 0xef, 0x54, 0xf0,
-    0x0, 0x36, 0xae, 0x0, 0x6e, 0xf5, 0x4f, 0x0,
-    0x2f, 0xfe, 0x70, 0x6, 0xef, 0x54, 0xf0, 0x4,
-    0xf0, 0x0, 0x0, 0x6e, 0xf5, 0x4f, 0x0, 0x4f,
-    0xfe, 0xd0, 0x6, 0xef, 0x54, 0xf0, 0x1, 0x66,
-    0x65, 0x0, 0x6e, 0xf5, 0x4f, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0x52, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xf5, 0x2, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0xf, 0x95, 0x55, 0x55, 0x55, 0x55, 0x50,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0,
+    0x1f, 0xfc, 0x20, 0xc, 0x40, 0xc, 0x8f, 0x19,
+    0x6, 0x32, 0xc, 0x64, 0x70, 0xc8, 0x81, 0x91,
+    0xe3, 0x20, 0x6, 0x40, 0xc, 0xff, 0xf8, 0x0,
+    0x18, 0x0, 0x3f, 0xfc, 0x0,
 
     /* U+F03A9 "󰎩" */
-    0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0x1e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xbf, 0xa0,
-    0x0, 0x99, 0x98, 0x10, 0x0, 0xeb, 0xfa, 0x0,
-    0x1f, 0xff, 0xfc, 0x0, 0xe, 0xbf, 0xa0, 0x0,
-    0x0, 0xb, 0xe0, 0x0, 0xeb, 0xfa, 0x0, 0x0,
-    0x12, 0xce, 0x0, 0xe, 0xbf, 0xa0, 0x0, 0xaf,
-    0xff, 0xb0, 0x0, 0xeb, 0xfa, 0x0, 0xf, 0xc7,
-    0x61, 0x0, 0xe, 0xbf, 0xa0, 0x1, 0xf9, 0x0,
-    0x0, 0x0, 0xeb, 0xfa, 0x0, 0x1f, 0xff, 0xfe,
-    0x0, 0xe, 0xbf, 0xa0, 0x0, 0xbb, 0xbb, 0xa0,
-    0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xbf, 0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xfb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x30,
+    0x7f, 0xfd, 0xff, 0xff, 0x0, 0x1e, 0x3c, 0x3c,
+    0x7c, 0x78, 0x18, 0xf0, 0x31, 0xe3, 0xe3, 0xc6,
+    0x7, 0x8c, 0xf, 0x1f, 0x1e, 0x3e, 0x3c, 0x0,
+    0x7f, 0xff, 0xdf, 0xff, 0x0,
 
     /* U+F03AA "󰎪" */
-    0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0x44, 0x45, 0xdf, 0xff, 0xfd, 0xff, 0xff,
-    0xe0, 0x0, 0x3, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xf2, 0x1f, 0xff, 0xfd, 0xff, 0xff, 0xff,
-    0xda, 0x22, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf9,
-    0x0, 0xaf, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xd9,
-    0x12, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xf2,
-    0x1f, 0xff, 0xfd, 0xff, 0xff, 0xe0, 0x0, 0x3,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0x44, 0x45, 0xdf,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x50,
+    0x7f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff,
+    0x83, 0xff, 0xe7, 0xff, 0xcf, 0xff, 0x3f, 0xff,
+    0x3f, 0xfe, 0x7f, 0xe0, 0xff, 0xc3, 0xff, 0xff,
+    0xff, 0xff, 0xdf, 0xff, 0x0,
 
     /* U+F03AB "󰎫" */
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70,
-    0x4, 0xf6, 0x66, 0x66, 0x66, 0x66, 0xae, 0x10,
-    0x4f, 0x0, 0x1, 0x10, 0x0, 0x6, 0xef, 0x54,
-    0xf0, 0x1, 0xff, 0xf9, 0x0, 0x6e, 0xf5, 0x4f,
-    0x0, 0x3, 0x39, 0xe0, 0x6, 0xef, 0x54, 0xf0,
-    0x0, 0x5, 0xad, 0x0, 0x6e, 0xf5, 0x4f, 0x0,
-    0x0, 0xbf, 0x80, 0x6, 0xef, 0x54, 0xf0, 0x0,
-    0x0, 0x6e, 0x0, 0x6e, 0xf5, 0x4f, 0x0, 0x1e,
-    0xef, 0xd0, 0x6, 0xef, 0x54, 0xf0, 0x0, 0x66,
-    0x61, 0x0, 0x6e, 0xf5, 0x4f, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0x52, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xf5, 0x2, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0xf, 0x95, 0x55, 0x55, 0x55, 0x55, 0x50,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0,
+    0x1f, 0xfc, 0x20, 0xc, 0x40, 0xc, 0x8f, 0x19,
+    0x6, 0x32, 0xc, 0x64, 0x38, 0xc8, 0x11, 0x91,
+    0xe3, 0x20, 0x6, 0x40, 0xc, 0xff, 0xf8, 0x0,
+    0x18, 0x0, 0x3f, 0xfc, 0x0,
 
     /* U+F03AC "󰎬" */
-    0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0x1e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xbf, 0xa0,
-    0x0, 0x99, 0x98, 0x10, 0x0, 0xeb, 0xfa, 0x0,
-    0x1f, 0xff, 0xfb, 0x0, 0xe, 0xbf, 0xa0, 0x0,
-    0x0, 0xd, 0xd0, 0x0, 0xeb, 0xfa, 0x0, 0x0,
-    0x0, 0xdc, 0x0, 0xe, 0xbf, 0xa0, 0x0, 0x6,
-    0xff, 0x40, 0x0, 0xeb, 0xfa, 0x0, 0x0, 0x39,
-    0xec, 0x0, 0xe, 0xbf, 0xa0, 0x0, 0x0, 0xc,
-    0xd0, 0x0, 0xeb, 0xfa, 0x0, 0x1f, 0xff, 0xfb,
-    0x0, 0xe, 0xbf, 0xa0, 0x0, 0xbb, 0xba, 0x20,
-    0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xbf, 0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xfb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x30,
+    0x7f, 0xfd, 0xff, 0xff, 0x0, 0x1e, 0x3c, 0x3c,
+    0x7c, 0x78, 0x18, 0xf0, 0x31, 0xe0, 0xc3, 0xc1,
+    0xc7, 0x81, 0x8f, 0x1f, 0x1e, 0x3c, 0x3c, 0x0,
+    0x7f, 0xff, 0xdf, 0xff, 0x0,
 
     /* U+F03AD "󰎭" */
-    0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0x4a, 0xf5, 0x5f, 0xff, 0xfd, 0xff, 0xff,
-    0xe0, 0x8f, 0x11, 0xff, 0xff, 0xdf, 0xff, 0xfe,
-    0x8, 0xf1, 0x1f, 0xff, 0xfd, 0xff, 0xff, 0xe0,
-    0x59, 0x1, 0xff, 0xff, 0xdf, 0xff, 0xfe, 0x0,
-    0x0, 0x1f, 0xff, 0xfd, 0xff, 0xff, 0xf9, 0x99,
-    0x1, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xf1,
-    0x1f, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x11,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xf5, 0x5f,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x50,
+    0x7f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff,
+    0xb3, 0xff, 0x67, 0xfe, 0x4f, 0xfc, 0x1f, 0xff,
+    0x3f, 0xfe, 0x7f, 0xfc, 0xff, 0xf9, 0xff, 0xff,
+    0xff, 0xff, 0xdf, 0xff, 0x0,
 
     /* U+F03AE "󰎮" */
-    0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0x1e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xbf, 0xa0,
-    0x0, 0x42, 0x3, 0x40, 0x0, 0xeb, 0xfa, 0x0,
-    0x1f, 0x90, 0xbe, 0x0, 0xe, 0xbf, 0xa0, 0x1,
-    0xf9, 0xb, 0xe0, 0x0, 0xeb, 0xfa, 0x0, 0x1f,
-    0x90, 0xbe, 0x0, 0xe, 0xbf, 0xa0, 0x1, 0xff,
-    0xff, 0xe0, 0x0, 0xeb, 0xfa, 0x0, 0xa, 0xaa,
-    0xee, 0x0, 0xe, 0xbf, 0xa0, 0x0, 0x0, 0xb,
-    0xe0, 0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0, 0xbe,
-    0x0, 0xe, 0xbf, 0xa0, 0x0, 0x0, 0xb, 0xd0,
-    0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xbf, 0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xfb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x30,
+    0x7f, 0xfd, 0xff, 0xff, 0x0, 0x1e, 0x0, 0x3c,
+    0x6c, 0x78, 0xd8, 0xf1, 0xb1, 0xe3, 0xe3, 0xc7,
+    0xc7, 0x81, 0x8f, 0x3, 0x1e, 0x6, 0x3c, 0x0,
+    0x7f, 0xff, 0xdf, 0xff, 0x0,
 
     /* U+F03AF "󰎯" */
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70,
-    0x4, 0xf6, 0x66, 0x66, 0x66, 0x66, 0xae, 0x10,
-    0x4f, 0x0, 0x1, 0x11, 0x10, 0x6, 0xef, 0x54,
-    0xf0, 0x4, 0xff, 0xfe, 0x0, 0x6e, 0xf5, 0x4f,
-    0x0, 0x4f, 0x43, 0x30, 0x6, 0xef, 0x54, 0xf0,
-    0x4, 0xf6, 0x61, 0x0, 0x6e, 0xf5, 0x4f, 0x0,
-    0x4f, 0xff, 0xc0, 0x6, 0xef, 0x54, 0xf0, 0x0,
-    0x0, 0x6e, 0x0, 0x6e, 0xf5, 0x4f, 0x0, 0x4e,
-    0xef, 0xc0, 0x6, 0xef, 0x54, 0xf0, 0x1, 0x66,
-    0x61, 0x0, 0x6e, 0xf5, 0x4f, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0x52, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xf5, 0x2, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0xf, 0x95, 0x55, 0x55, 0x55, 0x55, 0x50,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0,
+    0x1f, 0xfc, 0x20, 0xc, 0x40, 0xc, 0x8f, 0x19,
+    0x10, 0x32, 0x20, 0x64, 0x78, 0xc8, 0x11, 0x91,
+    0xe3, 0x20, 0x6, 0x40, 0xc, 0xff, 0xf8, 0x0,
+    0x18, 0x0, 0x3f, 0xfc, 0x0,
 
     /* U+F03B0 "󰎰" */
-    0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0x1e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xbf, 0xa0,
-    0x0, 0x99, 0x99, 0x80, 0x0, 0xeb, 0xfa, 0x0,
-    0x1f, 0xff, 0xfd, 0x0, 0xe, 0xbf, 0xa0, 0x1,
-    0xf9, 0x0, 0x0, 0x0, 0xeb, 0xfa, 0x0, 0x1f,
-    0x90, 0x0, 0x0, 0xe, 0xbf, 0xa0, 0x1, 0xff,
-    0xff, 0x50, 0x0, 0xeb, 0xfa, 0x0, 0x9, 0x99,
-    0xed, 0x0, 0xe, 0xbf, 0xa0, 0x0, 0x0, 0xc,
-    0xd0, 0x0, 0xeb, 0xfa, 0x0, 0x1f, 0xff, 0xfb,
-    0x0, 0xe, 0xbf, 0xa0, 0x0, 0xbb, 0xba, 0x20,
-    0x0, 0xeb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xbf, 0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xfb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x30,
+    0x7f, 0xfd, 0xff, 0xff, 0x0, 0x1e, 0x3e, 0x3c,
+    0x7c, 0x78, 0xc0, 0xf1, 0x81, 0xe3, 0xc3, 0xc7,
+    0xc7, 0x81, 0x8f, 0x1f, 0x1e, 0x3c, 0x3c, 0x0,
+    0x7f, 0xff, 0xdf, 0xff, 0x0,
 
     /* U+F03B1 "󰎱" */
-    0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0x44, 0x44, 0x5f, 0xff, 0xfd, 0xff, 0xff,
-    0xe0, 0x0, 0x1, 0xff, 0xff, 0xdf, 0xff, 0xfe,
-    0x5, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xe0,
-    0x3a, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xfe, 0x0,
-    0x0, 0x6f, 0xff, 0xfd, 0xff, 0xff, 0xf9, 0x99,
-    0x11, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xf2,
-    0x1f, 0xff, 0xfd, 0xff, 0xff, 0xe0, 0x0, 0x2,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0x44, 0x45, 0xdf,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x50,
+    0x7f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff,
+    0x83, 0xff, 0x3f, 0xfe, 0x7f, 0xfc, 0x1f, 0xff,
+    0x3f, 0xfe, 0x7f, 0xe0, 0xff, 0xc3, 0xff, 0xff,
+    0xff, 0xff, 0xdf, 0xff, 0x0,
 
     /* U+F04C5 "󰓅" */
-    0x0, 0x0, 0x39, 0xcd, 0xb8, 0x10, 0x0, 0x0,
-    0x1, 0xbf, 0xfc, 0xac, 0xe6, 0x1, 0x10, 0x1,
-    0xef, 0x60, 0x0, 0x0, 0x6, 0xb0, 0x0, 0xcf,
-    0x20, 0x0, 0x0, 0x3c, 0xf4, 0x0, 0x5f, 0x50,
-    0x0, 0x1, 0xaf, 0xfa, 0x8, 0x1a, 0xd0, 0x0,
-    0x7, 0xff, 0xff, 0x20, 0xf7, 0xe9, 0x0, 0x8,
-    0xff, 0xff, 0x80, 0xd, 0xaf, 0x70, 0x0, 0xcf,
-    0xff, 0xe0, 0x0, 0xbb, 0xe9, 0x0, 0x9, 0xff,
-    0xf5, 0x0, 0xc, 0xab, 0xd0, 0x0, 0x8, 0xb6,
-    0x0, 0x1, 0xf7, 0x5f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x20, 0xde, 0x10, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x2, 0xd4, 0x0, 0x0, 0x0, 0x7,
-    0xb0, 0x0,
+    0x7, 0xc0, 0x3f, 0x80, 0xc0, 0x23, 0x1, 0x84,
+    0xf, 0x58, 0x3c, 0xb1, 0xf9, 0xc3, 0xe3, 0xc7,
+    0x87, 0x86, 0x9, 0x0, 0x33, 0x0, 0x62, 0x0,
+    0x80,
 
     /* U+F0553 "󰕓" */
-    0x0, 0x0, 0x0, 0x8, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x0, 0x1d, 0xfe, 0x20,
-    0x3f, 0xc0, 0x3f, 0xff, 0xb8, 0xff, 0xfa, 0x3,
-    0xfc, 0x3, 0xff, 0xfb, 0x8f, 0xff, 0xa0, 0x3f,
-    0xc0, 0x3f, 0xff, 0xb1, 0xcf, 0xe2, 0x3, 0xfc,
-    0x3, 0xff, 0xfb, 0x6, 0xf9, 0x0, 0x3f, 0xc0,
-    0x4, 0xfc, 0x0, 0x6f, 0x90, 0x3, 0xfc, 0x0,
-    0x3f, 0xb0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x20, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x10, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x3, 0x0, 0xf, 0x0, 0x3e, 0x0,
+    0x18, 0x0, 0x30, 0x1c, 0x67, 0xfc, 0xcf, 0xf9,
+    0x9e, 0xe3, 0x3c, 0xc6, 0x31, 0x8c, 0x63, 0xff,
+    0xc7, 0xff, 0x0, 0x60, 0x0, 0xc0, 0x1, 0x80,
+    0x7, 0x0, 0xf, 0x0, 0x1e, 0x0, 0x38, 0x0,
+    0x0, 0x0,
 
     /* U+F0632 "󰘲" */
-    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf9, 0x2e, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x90, 0x2, 0xee, 0x20, 0x0,
-    0x0, 0x7, 0xf9, 0x0, 0x0, 0x2e, 0xe2, 0x0,
-    0x0, 0x7f, 0xd5, 0x0, 0x0, 0x27, 0xfe, 0x20,
-    0x7, 0xff, 0xff, 0x10, 0x0, 0x8f, 0xff, 0xe2,
-    0x1, 0x11, 0x7f, 0x10, 0x0, 0x8f, 0x11, 0x11,
-    0x0, 0x0, 0x6f, 0x10, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x10, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x37, 0x77, 0x77, 0x77, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x98, 0x88, 0xcf, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x10, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0x88, 0x88, 0x88, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x80, 0x1, 0xc0, 0x3, 0x60,
+    0x6, 0x30, 0xc, 0x18, 0x18, 0xc, 0x3c, 0x3e,
+    0x4, 0x30, 0x4, 0x30, 0x4, 0x30, 0x7, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xf0, 0x7, 0xf0,
+    0x4, 0x30, 0x7, 0xf0, 0x7, 0xf0,
 
     /* U+F0633 "󰘳" */
-    0x6, 0xcb, 0x50, 0x0, 0x0, 0x7c, 0xb4, 0x7,
-    0xfb, 0xcf, 0x50, 0x0, 0x9f, 0xad, 0xf3, 0xea,
-    0x0, 0xbc, 0x0, 0xf, 0x80, 0xd, 0xae, 0x80,
-    0x9, 0xe0, 0x1, 0xf5, 0x0, 0xcb, 0x9f, 0x75,
-    0xbe, 0x55, 0x6f, 0x95, 0x9f, 0x60, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x2, 0x9e,
-    0x22, 0x3f, 0x61, 0x0, 0x0, 0x0, 0x9, 0xe0,
-    0x2, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x9e, 0x0,
-    0x2f, 0x50, 0x0, 0x0, 0x7c, 0xef, 0xfe, 0xee,
-    0xfe, 0xec, 0x40, 0x7f, 0xa9, 0xcf, 0x99, 0x9f,
-    0xb9, 0xcf, 0x4e, 0x90, 0x9, 0xe0, 0x2, 0xf5,
-    0x0, 0xda, 0xe9, 0x0, 0xac, 0x0, 0xf, 0x70,
-    0xd, 0xa9, 0xf9, 0x9f, 0x60, 0x0, 0xbf, 0x8a,
-    0xf5, 0x9, 0xee, 0x70, 0x0, 0x1, 0xae, 0xd6,
-    0x0,
+    0x30, 0x18, 0xf0, 0xfb, 0x31, 0x9e, 0x62, 0x3c,
+    0xc6, 0xcf, 0xff, 0x83, 0x10, 0x6, 0x20, 0xc,
+    0x40, 0x7f, 0xf1, 0xff, 0xf6, 0x62, 0x3c, 0xc4,
+    0x7f, 0xf, 0x9c, 0xe, 0x0,
 
     /* U+F0634 "󰘴" */
-    0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfc, 0x3e, 0xf9, 0x0, 0x0, 0x0, 0xc,
-    0xfc, 0x0, 0x2e, 0xf9, 0x0, 0x0, 0x1c, 0xfc,
-    0x0, 0x0, 0x2e, 0xf9, 0x0, 0x1c, 0xfc, 0x0,
-    0x0, 0x0, 0x2e, 0xf9, 0xb, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xf7, 0x3b, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2b, 0x10,
+    0x0, 0x0, 0x7, 0x0, 0x1f, 0x0, 0x77, 0x1,
+    0xc7, 0x7, 0x7, 0x1c, 0x7, 0x70, 0x6, 0x40,
+    0x4,
 
     /* U+F0635 "󰘵" */
-    0xff, 0xff, 0xf3, 0x0, 0xe, 0xff, 0xff, 0xbb,
-    0xbb, 0xbf, 0xb0, 0x0, 0xab, 0xbb, 0xb8, 0x0,
-    0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x99, 0x97, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    0xf8, 0x7f, 0xf8, 0xfc, 0x30, 0x0, 0x30, 0x0,
+    0x60, 0x0, 0x60, 0x0, 0xc0, 0x0, 0xc0, 0x1,
+    0x80, 0x1, 0x80, 0x3, 0x0, 0x3, 0xe0, 0x7,
+    0xe0, 0x0, 0x0,
 
     /* U+F0636 "󰘶" */
-    0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xef, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf8, 0x1d, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x80, 0x1, 0xdf, 0x30, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x1d, 0xe3, 0x0,
-    0x0, 0x8f, 0xd7, 0x0, 0x0, 0x38, 0xfe, 0x30,
-    0x8, 0xff, 0xff, 0x10, 0x0, 0x8f, 0xff, 0xe3,
-    0x0, 0x0, 0x7f, 0x10, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x10, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x10, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0x88, 0x88, 0x88, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x80, 0x3, 0xc0, 0x7, 0x60,
+    0xe, 0x30, 0x1c, 0x18, 0x38, 0x1c, 0x7c, 0x3e,
+    0x4, 0x30, 0x4, 0x30, 0x4, 0x30, 0x7, 0xf0,
+    0x7, 0xf0,
 
     /* U+F093E "󰤾" */
-    0x0, 0x89, 0x99, 0x30, 0x0, 0x0, 0x0, 0x1,
-    0x3d, 0xff, 0xf8, 0x30, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xf, 0x94,
-    0x44, 0x44, 0xf8, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0xe, 0x80, 0x0, 0x20, 0xf, 0x60, 0x0,
-    0x0, 0xe8, 0x0, 0xc, 0x60, 0xf6, 0x0, 0x0,
-    0xe, 0x80, 0xa4, 0xca, 0x5f, 0x60, 0x0, 0x0,
-    0xe8, 0x0, 0xae, 0xb1, 0xf6, 0x0, 0x0, 0xe,
-    0x80, 0x3, 0xf6, 0xf, 0x60, 0x0, 0x0, 0xe8,
-    0x2, 0xcd, 0xb4, 0xf6, 0x0, 0x0, 0xe, 0x80,
-    0x81, 0xcc, 0x2f, 0x70, 0x0, 0x0, 0xe8, 0x0,
-    0xa, 0x20, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xad, 0xdd, 0xdd, 0xdd, 0x40, 0x0, 0x0,
-    0x0,
+    0x3c, 0x0, 0x7c, 0x3, 0xfc, 0x6, 0xc, 0x8,
+    0x18, 0x10, 0x31, 0x20, 0x6b, 0x40, 0xce, 0x81,
+    0x89, 0x3, 0x3a, 0x6, 0xb4, 0xc, 0x4f, 0xf8,
+    0x1f, 0xf0, 0x3f, 0xc0, 0x0,
 
     /* U+F093F "󰤿" */
-    0x0, 0x89, 0x99, 0x30, 0x0, 0x0, 0x0, 0x1,
-    0x3d, 0xff, 0xf8, 0x30, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xf, 0x94,
-    0x44, 0x44, 0xf8, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0xe, 0x80, 0x0, 0x20, 0xf, 0x60, 0x0,
-    0x0, 0xe8, 0x0, 0xc, 0x60, 0xf6, 0x0, 0x0,
-    0xe, 0x80, 0xa3, 0xca, 0x5f, 0x60, 0x0, 0x0,
-    0xe8, 0x0, 0xbe, 0xb1, 0xf6, 0x0, 0x0, 0xe,
-    0x80, 0x2, 0xf5, 0xf, 0x60, 0x0, 0x0, 0xe8,
-    0x2, 0xcd, 0xb4, 0xf6, 0x0, 0x0, 0xe, 0x80,
-    0x92, 0xcb, 0x3f, 0xca, 0xaa, 0xaa, 0xf8, 0x0,
-    0xb, 0x30, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0,
+    0x3c, 0x0, 0x7c, 0x3, 0xfc, 0x6, 0xc, 0x8,
+    0x18, 0x10, 0x31, 0x20, 0x6b, 0x40, 0xce, 0x81,
+    0x89, 0x3, 0x3a, 0x6, 0xb7, 0xfc, 0x4f, 0xf8,
+    0x1f, 0xf0, 0x3f, 0xc0, 0x0,
 
     /* U+F0940 "󰥀" */
-    0x0, 0x89, 0x99, 0x30, 0x0, 0x0, 0x0, 0x1,
-    0x3d, 0xff, 0xf8, 0x30, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xf, 0x94,
-    0x44, 0x44, 0xf8, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0xe, 0x80, 0x0, 0x20, 0xf, 0x60, 0x0,
-    0x0, 0xe8, 0x0, 0xc, 0x60, 0xf6, 0x0, 0x0,
-    0xe, 0x80, 0xa3, 0xca, 0x5f, 0x60, 0x0, 0x0,
-    0xe8, 0x0, 0xbe, 0xc2, 0xf6, 0x0, 0x0, 0xe,
-    0x80, 0x2, 0xf5, 0xf, 0x71, 0x11, 0x11, 0xe8,
-    0x2, 0xcd, 0xb4, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x92, 0xcb, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xb, 0x30, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0,
+    0x3c, 0x0, 0x7c, 0x3, 0xfc, 0x6, 0xc, 0x8,
+    0x18, 0x10, 0x31, 0x20, 0x6b, 0x40, 0xce, 0x81,
+    0x89, 0x3, 0x3b, 0xfe, 0xb7, 0xfc, 0x4f, 0xf8,
+    0x1f, 0xf0, 0x3f, 0xc0, 0x0,
 
     /* U+F0941 "󰥁" */
-    0x0, 0x89, 0x99, 0x30, 0x0, 0x0, 0x0, 0x1,
-    0x3d, 0xff, 0xf8, 0x30, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xf, 0x94,
-    0x44, 0x44, 0xf8, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0xe, 0x80, 0x0, 0x20, 0xf, 0x60, 0x0,
-    0x0, 0xe8, 0x0, 0xc, 0x60, 0xf6, 0x0, 0x0,
-    0xe, 0x80, 0xa4, 0xca, 0x6f, 0x60, 0x0, 0x0,
-    0xe8, 0x0, 0xae, 0xb1, 0xf6, 0x0, 0x0, 0xe,
-    0x80, 0x3, 0xf6, 0xf, 0xff, 0xff, 0xff, 0xf8,
-    0x2, 0xbd, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x81, 0xcc, 0x2f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xa, 0x20, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xad, 0xdd, 0xdd, 0xdd, 0x40, 0x0, 0x0,
-    0x0,
+    0x3c, 0x0, 0x7c, 0x3, 0xfc, 0x6, 0xc, 0x8,
+    0x18, 0x10, 0x31, 0x20, 0x6b, 0x40, 0xce, 0x81,
+    0x89, 0xff, 0x3b, 0xfe, 0xb7, 0xfc, 0x4f, 0xf8,
+    0x1f, 0xf0, 0x3f, 0xc0, 0x0,
 
     /* U+F0942 "󰥂" */
-    0x0, 0x89, 0x99, 0x30, 0x0, 0x0, 0x0, 0x1,
-    0x3d, 0xff, 0xf8, 0x30, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xf, 0x94,
-    0x44, 0x44, 0xf8, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0xe, 0x80, 0x0, 0x10, 0xf, 0x60, 0x0,
-    0x0, 0xe8, 0x0, 0xc, 0x50, 0xf6, 0x0, 0x0,
-    0xe, 0x80, 0xa3, 0xca, 0x5f, 0x60, 0x0, 0x0,
-    0xe8, 0x0, 0xbe, 0xc2, 0xfc, 0x99, 0x99, 0x9f,
-    0x80, 0x2, 0xf5, 0xf, 0xff, 0xff, 0xff, 0xf8,
-    0x1, 0xcd, 0xb4, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x92, 0xcb, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xb, 0x30, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0,
+    0x3c, 0x0, 0x7c, 0x3, 0xfc, 0x6, 0xc, 0x8,
+    0x18, 0x10, 0x31, 0x20, 0x6b, 0x40, 0xce, 0xff,
+    0x89, 0xff, 0x3b, 0xfe, 0xb7, 0xfc, 0x4f, 0xf8,
+    0x1f, 0xf0, 0x3f, 0xc0, 0x0,
 
     /* U+F0943 "󰥃" */
-    0x0, 0x89, 0x99, 0x30, 0x0, 0x0, 0x0, 0x1,
-    0x3d, 0xff, 0xf8, 0x30, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xf, 0x94,
-    0x44, 0x44, 0xf8, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0xe, 0x80, 0x0, 0x10, 0xf, 0x60, 0x0,
-    0x0, 0xe8, 0x0, 0xc, 0x50, 0xf6, 0x0, 0x0,
-    0xe, 0x80, 0xa3, 0xca, 0x5f, 0x94, 0x44, 0x44,
-    0xf8, 0x0, 0xbe, 0xc2, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x2, 0xf5, 0xf, 0xff, 0xff, 0xff, 0xf8,
-    0x1, 0xcd, 0xb4, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x92, 0xcb, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xb, 0x30, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0,
+    0x3c, 0x0, 0x7c, 0x3, 0xfc, 0x6, 0xc, 0x8,
+    0x18, 0x10, 0x31, 0x20, 0x6b, 0x60, 0xce, 0xff,
+    0x89, 0xff, 0x3b, 0xfe, 0xb7, 0xfc, 0x4f, 0xf8,
+    0x1f, 0xf0, 0x3f, 0xc0, 0x0,
 
     /* U+F0944 "󰥄" */
-    0x0, 0x89, 0x99, 0x30, 0x0, 0x0, 0x0, 0x1,
-    0x3d, 0xff, 0xf8, 0x30, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xf, 0x94,
-    0x44, 0x44, 0xf8, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0xe, 0x80, 0x0, 0x10, 0xf, 0x60, 0x0,
-    0x0, 0xe8, 0x0, 0xc, 0x50, 0xfd, 0xcc, 0xcc,
-    0xcf, 0x80, 0xa3, 0xca, 0x5f, 0xff, 0xff, 0xff,
-    0xf8, 0x1, 0xbe, 0xb2, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x2, 0xf5, 0xf, 0xff, 0xff, 0xff, 0xf8,
-    0x1, 0xcd, 0xb3, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x92, 0xcb, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xb, 0x30, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0,
+    0x3c, 0x0, 0x7c, 0x3, 0xfc, 0x6, 0xc, 0x8,
+    0x18, 0x10, 0x31, 0x3f, 0xeb, 0x7f, 0xce, 0xff,
+    0x89, 0xff, 0x3b, 0xfe, 0xb7, 0xfc, 0x4f, 0xf8,
+    0x1f, 0xf0, 0x3f, 0xc0, 0x0,
 
     /* U+F0945 "󰥅" */
-    0x0, 0x89, 0x99, 0x30, 0x0, 0x0, 0x0, 0x1,
-    0x3d, 0xff, 0xf8, 0x30, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xf, 0x94,
-    0x44, 0x44, 0xf8, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0xe, 0x80, 0x0, 0x10, 0xf, 0xb7, 0x77,
-    0x77, 0xf8, 0x0, 0xc, 0x50, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xa3, 0xca, 0x5f, 0xff, 0xff, 0xff,
-    0xf8, 0x1, 0xbe, 0xb2, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x2, 0xf5, 0xf, 0xff, 0xff, 0xff, 0xf8,
-    0x1, 0xcd, 0xb4, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x92, 0xcb, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xb, 0x30, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0,
+    0x3c, 0x0, 0x7c, 0x3, 0xfc, 0x6, 0xc, 0x8,
+    0x18, 0x18, 0x31, 0x3f, 0xeb, 0x7f, 0xce, 0xff,
+    0x89, 0xff, 0x3b, 0xfe, 0xb7, 0xfc, 0x4f, 0xf8,
+    0x1f, 0xf0, 0x3f, 0xc0, 0x0,
 
     /* U+F0946 "󰥆" */
-    0x0, 0x89, 0x99, 0x30, 0x0, 0x0, 0x0, 0x1,
-    0x3d, 0xff, 0xf8, 0x30, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xf, 0x94,
-    0x44, 0x44, 0xf8, 0x0, 0x0, 0x0, 0xf8, 0x33,
-    0x33, 0x3f, 0x80, 0x0, 0x10, 0xf, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0xb, 0x50, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0xa3, 0xca, 0x5f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xbe, 0xb2, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x2, 0xf5, 0xf, 0xff, 0xff, 0xff, 0xf8,
-    0x1, 0xcd, 0xb4, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x92, 0xcb, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xb, 0x30, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0,
+    0x3c, 0x0, 0x7c, 0x3, 0xfc, 0x6, 0xc, 0xc,
+    0x18, 0x1f, 0xf1, 0x3f, 0xeb, 0x7f, 0xce, 0xff,
+    0x89, 0xff, 0x3b, 0xfe, 0xb7, 0xfc, 0x4f, 0xf8,
+    0x1f, 0xf0, 0x3f, 0xc0, 0x0,
 
     /* U+F0947 "󰥇" */
-    0x0, 0x56, 0x66, 0x30, 0x0, 0x0, 0x0, 0x1,
-    0x2d, 0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0xf, 0xff, 0x90,
-    0xff, 0xf9, 0x0, 0xa, 0x30, 0xff, 0xf9, 0xf,
-    0xff, 0x90, 0x93, 0xba, 0x4f, 0xff, 0x90, 0xff,
-    0xf9, 0x0, 0xbe, 0xc2, 0xff, 0xf9, 0xf, 0xff,
-    0x90, 0x2, 0xf7, 0xf, 0xff, 0xff, 0xff, 0xf9,
-    0x2, 0xcd, 0xa5, 0xff, 0xfc, 0x7f, 0xff, 0x90,
-    0x81, 0xbc, 0x2f, 0xff, 0x90, 0xff, 0xf9, 0x0,
-    0xa, 0x20, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0xad, 0xdd, 0xdd, 0xdd, 0x50, 0x0, 0x0,
-    0x0,
+    0x0, 0x0, 0x7c, 0x3, 0xfe, 0x7, 0xfc, 0xf,
+    0xf8, 0x1e, 0xf1, 0x3d, 0xeb, 0x7b, 0xce, 0xf7,
+    0x89, 0xff, 0x3b, 0xde, 0xb7, 0xbc, 0x4f, 0xf8,
+    0x1f, 0xf0, 0x3f, 0xc0, 0x0,
 
     /* U+F0948 "󰥈" */
-    0x0, 0x68, 0x88, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x10, 0xf, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0xb, 0x50, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x93, 0xca, 0x5f, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0xbe, 0xb2, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x2, 0xf5, 0xf, 0xff, 0xff, 0xff, 0xfb,
-    0x1, 0xbd, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x82, 0xcb, 0x3f, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0xb, 0x30, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0,
+    0x1c, 0x0, 0x7c, 0x3, 0xfe, 0x7, 0xfc, 0xf,
+    0xf8, 0x1f, 0xf1, 0x3f, 0xeb, 0x7f, 0xce, 0xff,
+    0x89, 0xff, 0x3b, 0xfe, 0xb7, 0xfc, 0x4f, 0xf8,
+    0x1f, 0xf0, 0x3f, 0xc0, 0x0,
 
     /* U+F0949 "󰥉" */
-    0x0, 0xc, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x50, 0x0, 0x6d, 0xef, 0xff,
-    0xff, 0xfe, 0xec, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xff, 0x9f, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xf2, 0x4f, 0xff, 0xf8, 0xff, 0xf5, 0xaf, 0x23,
-    0x4f, 0xff, 0x8f, 0xff, 0xb1, 0xb2, 0xb0, 0xaf,
-    0xf8, 0xff, 0xff, 0xc1, 0x1, 0x8f, 0xff, 0x8f,
-    0xff, 0xff, 0xb0, 0x7f, 0xff, 0xf8, 0xff, 0xff,
-    0xe3, 0x1, 0xcf, 0xff, 0x8f, 0xff, 0xe3, 0x52,
-    0x81, 0xcf, 0xf8, 0xff, 0xf4, 0x5f, 0x27, 0x1d,
-    0xff, 0x8f, 0xff, 0xdf, 0xf2, 0x1d, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0x4d, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10,
+    0x1f, 0x80, 0xfc, 0x1f, 0xfd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x9f, 0xec, 0x7f, 0xab,
+    0xfe, 0x3f, 0xf9, 0xff, 0x8f, 0xf8, 0xbf, 0x91,
+    0xff, 0x9f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0,
 
     /* U+F094A "󰥊" */
-    0x0, 0xad, 0xdd, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xf7, 0x10, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0xf, 0xfc,
-    0x31, 0x6f, 0xf8, 0x0, 0x0, 0x0, 0xfe, 0x1,
-    0x40, 0x6f, 0x80, 0x0, 0x20, 0xf, 0x80, 0xdf,
-    0x60, 0xf8, 0x0, 0xc, 0x60, 0xfd, 0xcf, 0xf8,
-    0xf, 0x80, 0xa3, 0xca, 0x5f, 0xff, 0xfd, 0x17,
-    0xf8, 0x0, 0xbe, 0xb2, 0xff, 0xff, 0x24, 0xff,
-    0x80, 0x2, 0xf6, 0xf, 0xff, 0xc3, 0xef, 0xf8,
-    0x2, 0xcd, 0xb4, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x81, 0xcc, 0x2f, 0xff, 0xb5, 0xff, 0xf8, 0x0,
-    0xb, 0x20, 0xff, 0xfa, 0x4f, 0xff, 0x80, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0,
+    0x3c, 0x0, 0x78, 0x3, 0xfc, 0x7, 0x1c, 0xc,
+    0x18, 0x1b, 0x31, 0x3f, 0x6b, 0x7c, 0xce, 0xf3,
+    0x89, 0xef, 0x3b, 0xfe, 0xb7, 0xbc, 0x4f, 0x78,
+    0x1f, 0xf0, 0x3f, 0xc0, 0x0,
 
     /* U+F0A1E "󰨞" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0x81,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xfa,
-    0x0, 0x10, 0x0, 0x2, 0xef, 0xff, 0xff, 0xfc,
-    0x9, 0xf8, 0x0, 0x3e, 0xff, 0xfb, 0xff, 0xfc,
-    0xd, 0xff, 0xc5, 0xff, 0xff, 0x70, 0xef, 0xfc,
-    0x1, 0xcf, 0xff, 0xff, 0xe3, 0x0, 0xef, 0xfc,
-    0x0, 0xd, 0xff, 0xfe, 0x10, 0x0, 0xef, 0xfc,
-    0x0, 0x9f, 0xff, 0xff, 0xb1, 0x0, 0xef, 0xfc,
-    0xa, 0xff, 0xea, 0xff, 0xfe, 0x30, 0xef, 0xfc,
-    0xc, 0xfb, 0x10, 0x7f, 0xff, 0xf7, 0xef, 0xfc,
-    0x0, 0x50, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xc3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xb4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x10, 0x0, 0x3e, 0x0, 0x7f, 0x0, 0xff,
+    0x71, 0xff, 0x7b, 0xcf, 0x3f, 0x8f, 0x1f, 0xf,
+    0x3f, 0x8f, 0x7f, 0xcf, 0x71, 0xef, 0x0, 0xff,
+    0x0, 0x7f, 0x0, 0x3e, 0x0, 0x18, 0x0, 0x0,
 
     /* U+F0EB7 "󰺷" */
-    0x0, 0x7c, 0xee, 0xee, 0xee, 0xeb, 0x50, 0x0,
-    0xbe, 0x75, 0x55, 0x55, 0x55, 0x8f, 0x80, 0x7e,
-    0x10, 0x10, 0x0, 0x0, 0x1, 0x3f, 0x4d, 0x60,
-    0x6d, 0x0, 0x0, 0x4, 0xf3, 0xa9, 0xf4, 0x8e,
-    0xfe, 0x10, 0x3, 0x2a, 0x18, 0xbd, 0x63, 0x9e,
-    0x50, 0x2, 0xf8, 0x0, 0xaa, 0x8d, 0x13, 0x70,
-    0x37, 0x27, 0x20, 0x3f, 0x40, 0xcd, 0x65, 0x9f,
-    0xdf, 0x75, 0x7f, 0x90, 0x0, 0x7c, 0xeb, 0x40,
-    0x6c, 0xec, 0x50, 0x0,
+    0x1f, 0xf0, 0xc0, 0x39, 0x0, 0x14, 0x40, 0xbb,
+    0xc1, 0x73, 0xc, 0xf0, 0x1, 0x33, 0xc6, 0x1c,
+    0x70,
 
     /* U+F0F2D "󰼭" */
-    0x0, 0x3, 0x33, 0x33, 0x33, 0x32, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xf, 0x94, 0x44, 0x44, 0xbc, 0x0, 0x0, 0x0,
-    0xfd, 0xbb, 0xbc, 0xff, 0xc0, 0x0, 0x0, 0xf,
-    0xdb, 0xbb, 0xbf, 0xfc, 0x0, 0x1, 0x34, 0xff,
-    0xff, 0xff, 0xff, 0xd3, 0x30, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1, 0x44, 0x44, 0x33,
-    0x33, 0x34, 0x44, 0x40, 0xb, 0xff, 0x90, 0x0,
-    0x0, 0xcf, 0xf8, 0x2, 0xff, 0xff, 0xa8, 0x88,
-    0xbf, 0xff, 0xe0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x4e, 0xfd, 0xef, 0xde, 0xfd, 0xef,
-    0xde, 0xfa, 0xff, 0x57, 0xf5, 0x7f, 0x48, 0xf3,
-    0x9f, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x27, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x10,
+    0x0, 0x0, 0x3f, 0xe0, 0x60, 0xc0, 0xff, 0x81,
+    0xff, 0x3, 0xfe, 0x1f, 0xff, 0x0, 0x0, 0x78,
+    0x3c, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfc, 0x96,
+    0xff, 0xff, 0xc0, 0x0, 0x0,
 
     /* U+F0F85 "󰾅" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x84, 0x1e, 0x7, 0x70, 0x0, 0x0, 0x4,
-    0xef, 0x16, 0xf2, 0x4f, 0xd2, 0x0, 0x4, 0xfb,
-    0x10, 0xaf, 0x60, 0x4e, 0xe2, 0x0, 0xec, 0x0,
-    0xe, 0xfb, 0x0, 0x2e, 0xb0, 0x7f, 0x20, 0x3,
-    0xff, 0xf0, 0x0, 0x6f, 0x3c, 0xb0, 0x0, 0x7f,
-    0xff, 0x30, 0x0, 0xf8, 0xe8, 0x0, 0xb, 0xff,
-    0xf7, 0x0, 0xc, 0xaf, 0x80, 0x0, 0xcf, 0xff,
-    0x80, 0x0, 0xbb, 0xda, 0x0, 0x6, 0xff, 0xf2,
-    0x0, 0xe, 0xa9, 0xe0, 0x0, 0x3, 0x51, 0x0,
-    0x3, 0xf5, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xbe, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x7f,
-    0x50, 0x0, 0x82, 0x0, 0x0, 0x0, 0x4, 0x60,
-    0x0,
+    0x0, 0x0, 0x0, 0x0, 0x24, 0x0, 0xc9, 0x83,
+    0x31, 0x8c, 0x71, 0x90, 0xe1, 0x61, 0xc3, 0xc7,
+    0x87, 0x8f, 0x8f, 0xe, 0x1e, 0x0, 0x26, 0x0,
+    0xcc, 0x1, 0x8, 0x0, 0x0,
 
     /* U+F0F86 "󰾆" */
-    0x0, 0x0, 0x39, 0xbd, 0xc8, 0x20, 0x0, 0x0,
-    0x20, 0x9, 0xeb, 0xac, 0xff, 0x80, 0x0, 0x1,
-    0xc4, 0x0, 0x0, 0x1, 0x9f, 0xb0, 0x0, 0x7,
-    0xfa, 0x20, 0x0, 0x0, 0x5f, 0x70, 0x45, 0xe,
-    0xff, 0x80, 0x0, 0x0, 0x9f, 0x1a, 0xc0, 0x5f,
-    0xff, 0xe5, 0x0, 0x2, 0xf7, 0xd9, 0x0, 0xbf,
-    0xff, 0xf4, 0x0, 0xd, 0xaf, 0x70, 0x2, 0xff,
-    0xff, 0x80, 0x0, 0xbb, 0xe9, 0x0, 0x9, 0xff,
-    0xf5, 0x0, 0xc, 0xab, 0xd0, 0x0, 0x8, 0xb6,
-    0x0, 0x1, 0xf7, 0x5f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x20, 0xde, 0x10, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x2, 0xd4, 0x0, 0x0, 0x0, 0x7,
-    0xc0, 0x0,
+    0x7, 0xc0, 0x1f, 0xe0, 0x80, 0xe0, 0xc0, 0x41,
+    0xe0, 0xd9, 0xe0, 0xb3, 0xe1, 0xc3, 0xe3, 0xc7,
+    0x87, 0x86, 0x9, 0x0, 0x33, 0x0, 0x62, 0x0,
+    0x80,
 
     /* U+F11F0 "󱇰" */
-    0x3, 0xcf, 0xff, 0xff, 0xff, 0xfe, 0xb1, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xf,
-    0xf4, 0x11, 0x11, 0x11, 0x17, 0xfb, 0x0, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0xf, 0xf2,
-    0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0xff, 0x2b,
-    0xe5, 0x8, 0xe8, 0x6f, 0xb0, 0xf, 0xf2, 0xcf,
-    0x50, 0x9f, 0x86, 0xfb, 0x0, 0xff, 0x22, 0x31,
-    0x2, 0x31, 0x6f, 0xb0, 0xf, 0xf2, 0x0, 0x0,
-    0x0, 0x6, 0xfb, 0x0, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x6f, 0xb0, 0x8f, 0xf9, 0x88, 0x88, 0x88,
-    0x8b, 0xfd, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0
+    0x3f, 0xf8, 0xff, 0xf9, 0x80, 0x33, 0x0, 0x66,
+    0x0, 0xcd, 0x9d, 0x9b, 0x3b, 0x30, 0x6, 0x60,
+    0xc, 0xc0, 0x1b, 0xff, 0xf7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xbf, 0xfe, 0x3f, 0xf8,
+    0x3f, 0xe0, 0x3f, 0x80, 0x7f, 0x0, 0xfe, 0x0,
+    0x0, 0x0
 };
 
 
@@ -1493,86 +554,86 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 236, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 98, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 211, .adv_w = 236, .box_w = 16, .box_h = 19, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 363, .adv_w = 236, .box_w = 15, .box_h = 10, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 438, .adv_w = 236, .box_w = 15, .box_h = 19, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 581, .adv_w = 236, .box_w = 15, .box_h = 21, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 739, .adv_w = 236, .box_w = 13, .box_h = 22, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 882, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1032, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1182, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1332, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1482, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1632, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1782, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1932, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2082, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2232, .adv_w = 236, .box_w = 13, .box_h = 22, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2375, .adv_w = 236, .box_w = 13, .box_h = 22, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 2518, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2631, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2744, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2857, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2970, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3083, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3196, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3309, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 3459, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3572, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 3722, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 3872, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3985, .adv_w = 236, .box_w = 13, .box_h = 22, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 4128, .adv_w = 236, .box_w = 15, .box_h = 22, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 4293, .adv_w = 236, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4421, .adv_w = 236, .box_w = 16, .box_h = 17, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 4557, .adv_w = 236, .box_w = 16, .box_h = 19, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 4709, .adv_w = 236, .box_w = 12, .box_h = 22, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 4841, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4954, .adv_w = 236, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 5022, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5135, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5248, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5361, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5474, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5587, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5700, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5813, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5926, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6039, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6152, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6265, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6378, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6491, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6604, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6717, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6830, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6943, .adv_w = 236, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 7041, .adv_w = 236, .box_w = 15, .box_h = 22, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 7206, .adv_w = 236, .box_w = 16, .box_h = 19, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 7358, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7471, .adv_w = 236, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 7539, .adv_w = 236, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7644, .adv_w = 236, .box_w = 16, .box_h = 13, .ofs_x = -1, .ofs_y = 1},
-    {.bitmap_index = 7748, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7861, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7974, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8087, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8200, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8313, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8426, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8539, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8652, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8765, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8878, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8991, .adv_w = 236, .box_w = 13, .box_h = 22, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 9134, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9247, .adv_w = 236, .box_w = 16, .box_h = 16, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 9375, .adv_w = 236, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 9443, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9556, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9669, .adv_w = 236, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 9767, .adv_w = 236, .box_w = 15, .box_h = 22, .ofs_x = 0, .ofs_y = -4}
+    {.bitmap_index = 25, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 54, .adv_w = 236, .box_w = 16, .box_h = 19, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 92, .adv_w = 236, .box_w = 15, .box_h = 10, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 111, .adv_w = 236, .box_w = 15, .box_h = 19, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 147, .adv_w = 236, .box_w = 15, .box_h = 21, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 187, .adv_w = 236, .box_w = 13, .box_h = 22, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 223, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 261, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 299, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 337, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 375, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 413, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 451, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 489, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 527, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 565, .adv_w = 236, .box_w = 13, .box_h = 22, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 601, .adv_w = 236, .box_w = 13, .box_h = 22, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 637, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 666, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 695, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 724, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 753, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 782, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 811, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 840, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 878, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 907, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 945, .adv_w = 236, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 983, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1012, .adv_w = 236, .box_w = 13, .box_h = 22, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 1048, .adv_w = 236, .box_w = 15, .box_h = 22, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 1090, .adv_w = 236, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1122, .adv_w = 236, .box_w = 16, .box_h = 17, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 1156, .adv_w = 236, .box_w = 16, .box_h = 19, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 1194, .adv_w = 236, .box_w = 12, .box_h = 22, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 1227, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1256, .adv_w = 236, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 1273, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1302, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1331, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1360, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1389, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1418, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1447, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1476, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1505, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1534, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1563, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1592, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1621, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1650, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1679, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1708, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1737, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1766, .adv_w = 236, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 1791, .adv_w = 236, .box_w = 15, .box_h = 22, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 1833, .adv_w = 236, .box_w = 16, .box_h = 19, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 1871, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1900, .adv_w = 236, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 1917, .adv_w = 236, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1944, .adv_w = 236, .box_w = 16, .box_h = 13, .ofs_x = -1, .ofs_y = 1},
+    {.bitmap_index = 1970, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1999, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2028, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2057, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2086, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2115, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2144, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2173, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2202, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2231, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2260, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2289, .adv_w = 236, .box_w = 13, .box_h = 22, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 2325, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2354, .adv_w = 236, .box_w = 16, .box_h = 16, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 2386, .adv_w = 236, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 2403, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2432, .adv_w = 236, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2461, .adv_w = 236, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 2486, .adv_w = 236, .box_w = 15, .box_h = 22, .ofs_x = 0, .ofs_y = -4}
 };
 
 /*---------------------
@@ -1637,7 +698,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .kern_dsc = NULL,
     .kern_scale = 0,
     .cmap_num = 5,
-    .bpp = 4,
+    .bpp = 1,
     .kern_classes = 0,
     .bitmap_format = 0,
 #if LVGL_VERSION_MAJOR == 8
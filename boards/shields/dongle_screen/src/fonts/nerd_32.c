@@ -1,2578 +0,0 @@
-/*******************************************************************************
- * Size: 32 px
- * Bpp: 4
- * Opts: --bpp 4 --size 32 --no-compress --stride 1 --align 1 --font FiraCodeNerdFontMono-Regular.ttf --range 983215,983216-983220,985406-985418,62087,984403,987632,62711,983968-983985,57943,987014,987014,987013,984261,986807,986925,985630,61818,61820,62210,984627,984626,984628,984629,984630,983161-983185 --format lvgl -o nerd_32.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef NERD_32
-#define NERD_32 1
-#endif
-
-#if NERD_32
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+E257 "" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xfd,
-    0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xff,
-    0xff, 0xff, 0xff, 0x92, 0x0, 0x0, 0x1, 0x7e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe4, 0x6, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x40, 0x0, 0x4, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xe8, 0x20, 0x0, 0x27, 0x30,
-    0x1, 0x8e, 0xff, 0xff, 0xc6, 0x0, 0x5, 0x61,
-    0x6d, 0xfc, 0x50, 0x0, 0x5b, 0x93, 0x0, 0x18,
-    0xef, 0xb4, 0x0, 0x4b, 0xfe, 0x82, 0x0, 0x0,
-    0x4a, 0xff, 0x92, 0x0, 0x0, 0x0, 0x29, 0xff,
-    0xb7, 0x8d, 0xfd, 0x60, 0x0, 0x0, 0x9f, 0xb5,
-    0x0, 0x6, 0xdf, 0xfb, 0x40, 0x1, 0x7d, 0xe5,
-    0x5, 0xcf, 0xe7, 0x10, 0x3, 0x10, 0x3, 0x9f,
-    0xfa, 0x30, 0x0, 0x3, 0x9f, 0xfa, 0x40, 0x5,
-    0xcf, 0xe7, 0x10, 0x0, 0x0, 0x0, 0x1, 0x7e,
-    0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0x92, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F17A "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x36, 0x87, 0x0, 0x0, 0x0, 0x0, 0x4, 0x69,
-    0xbd, 0xff, 0xff, 0xfb, 0x2, 0x47, 0x9b, 0xdf,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xbb, 0xbb, 0xbb, 0xbb, 0x1b, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xb7, 0x44, 0x44, 0x44, 0x44,
-    0x4, 0x44, 0x44, 0x44, 0x44, 0x43, 0xff, 0xff,
-    0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-    0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x68, 0xac, 0xef, 0xff, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x1, 0x35,
-    0x9, 0xbd, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x46, 0x8b, 0xda,
-
-    /* U+F17C "" */
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xbd, 0xa2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5d, 0xef, 0x9c, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x55, 0xc5,
-    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x48, 0x75, 0xa6, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x60, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x21, 0x25,
-    0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0x54, 0x44, 0xa, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xf1, 0x0, 0x0, 0x4f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x0,
-    0xdf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xce, 0x50,
-    0x0, 0x0, 0x6, 0xdf, 0xc0, 0x0, 0x0, 0x0,
-    0x5d, 0xd0, 0x0, 0x0, 0x0, 0xe, 0xcf, 0x40,
-    0x0, 0x0, 0xd, 0xc7, 0x0, 0x0, 0x0, 0x0,
-    0x8b, 0xfb, 0x0, 0x0, 0x2, 0xfb, 0x20, 0x0,
-    0x0, 0x0, 0x3, 0x8f, 0xf0, 0x0, 0x0, 0x4f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xaf, 0x0,
-    0x0, 0x5, 0x9b, 0x10, 0x0, 0x0, 0x0, 0x3c,
-    0xff, 0xb0, 0x0, 0x4, 0x40, 0x4e, 0x40, 0x0,
-    0x0, 0x5, 0x5c, 0x52, 0x40, 0x6, 0x10, 0x0,
-    0xbf, 0x20, 0x0, 0x0, 0x50, 0x0, 0x5, 0x0,
-    0x50, 0x0, 0x2, 0xf6, 0x0, 0x0, 0x4, 0x0,
-    0x0, 0x13, 0x5, 0x0, 0x0, 0x4, 0x20, 0x0,
-    0x5, 0x10, 0x0, 0x0, 0x50, 0x40, 0x0, 0x0,
-    0xa, 0x96, 0x7b, 0xd0, 0x0, 0x3, 0x50, 0x4,
-    0x54, 0x20, 0x0, 0x8a, 0x88, 0xaa, 0x0, 0x5,
-    0x20, 0x0, 0x0, 0x2, 0x54, 0x52, 0x0, 0x0,
-    0x25, 0x46, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F287 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xac, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xa5, 0xdf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0x0, 0x15, 0x10, 0x0, 0x0, 0x0,
-    0x3d, 0xe7, 0x0, 0xa8, 0x0, 0x0, 0x0, 0x0,
-    0x53, 0x0, 0xdf, 0xff, 0x45, 0xf4, 0x22, 0x22,
-    0x22, 0x22, 0xaf, 0x90, 0xef, 0xff, 0xfe, 0xef,
-    0xfe, 0xee, 0xee, 0xee, 0xff, 0xf7, 0x7f, 0xfe,
-    0x10, 0x0, 0xd6, 0x0, 0x0, 0x0, 0x9d, 0x30,
-    0x3, 0x51, 0x0, 0x0, 0x4e, 0x0, 0x12, 0x20,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x80,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x20,
-    0x0, 0x0,
-
-    /* U+F302 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x4, 0xad, 0xda,
-    0x50, 0x5, 0xae, 0xfd, 0x82, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x20, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x2b, 0xd9, 0x40, 0x1, 0x6a, 0xc7, 0x0, 0x0,
-
-    /* U+F4F7 "" */
-    0x0, 0x0, 0x63, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xdf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xaa, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0, 0x3a,
-    0xaa, 0xaa, 0xaa, 0x91, 0x0, 0x7, 0xff, 0x10,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x8f, 0xf1, 0x0, 0x0, 0x5e, 0xee, 0xef, 0xff,
-    0xf4, 0xb, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x5, 0xff, 0xf5, 0x0, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x5, 0xff, 0xf4, 0x0, 0x3, 0x88,
-    0x88, 0x87, 0x0, 0x0, 0x6, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0xbf, 0xf6,
-    0x0, 0x4c, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x90, 0x5f, 0xff, 0xff, 0xe0, 0x0,
-    0x5, 0x10, 0x0, 0x3f, 0xf8, 0xe, 0xff, 0x9a,
-    0xff, 0x60, 0x9, 0xff, 0xb9, 0xaf, 0xff, 0x30,
-    0xdf, 0x50, 0xf, 0xf9, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x20, 0x2, 0xff, 0x80, 0x0,
-    0x4a, 0xef, 0xeb, 0x40, 0x0, 0x0, 0x1, 0xdf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xfc, 0xaa, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0079 "󰁹" */
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x1, 0x33, 0xbf, 0xff, 0xff, 0xff,
-    0xe3, 0x32, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x1, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x32, 0x0,
-
-    /* U+F007A "󰁺" */
-    0x0, 0x0, 0x6c, 0xcc, 0xcc, 0xcc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xbf, 0xfd, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf9,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0xef, 0xf1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F007B "󰁻" */
-    0x0, 0x0, 0x6c, 0xcc, 0xcc, 0xcc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xbf, 0xfd, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F007C "󰁼" */
-    0x0, 0x0, 0x6c, 0xcc, 0xcc, 0xcc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xbf, 0xfd, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf1, 0xbf, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F007D "󰁽" */
-    0x0, 0x0, 0x6c, 0xcc, 0xcc, 0xcc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xbf, 0xfd, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x1, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x0,
-
-    /* U+F007E "󰁾" */
-    0x0, 0x0, 0x6c, 0xcc, 0xcc, 0xcc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xbf, 0xfd, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xfb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xef, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F007F "󰁿" */
-    0x0, 0x0, 0x6c, 0xcc, 0xcc, 0xcc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xbf, 0xfd, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x21, 0x0,
-
-    /* U+F0080 "󰂀" */
-    0x0, 0x0, 0x6c, 0xcc, 0xcc, 0xcc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xbf, 0xfd, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf1, 0xbf, 0xfe, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0081 "󰂁" */
-    0x0, 0x0, 0x6c, 0xcc, 0xcc, 0xcc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xbf, 0xfd, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xbf, 0xf2, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0xcf, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x1, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x0,
-
-    /* U+F0082 "󰂂" */
-    0x0, 0x0, 0x6c, 0xcc, 0xcc, 0xcc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xbf, 0xfd, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xfb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xef,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0083 "󰂃" */
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x1, 0x33, 0xaf, 0xff, 0xff, 0xff,
-    0xf3, 0x32, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xfa, 0x88, 0xff, 0xff, 0xff,
-    0xf0, 0xcf, 0xff, 0xff, 0xf4, 0x0, 0xef, 0xff,
-    0xff, 0xf0, 0xcf, 0xff, 0xff, 0xf4, 0x0, 0xef,
-    0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xf4, 0x0,
-    0xef, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xf4,
-    0x0, 0xef, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff,
-    0xf4, 0x0, 0xef, 0xff, 0xff, 0xf0, 0xcf, 0xff,
-    0xff, 0xf4, 0x0, 0xef, 0xff, 0xff, 0xf0, 0xcf,
-    0xff, 0xff, 0xf4, 0x0, 0xef, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xf4, 0x0, 0xef, 0xff, 0xff,
-    0xf0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xfd, 0xcc,
-    0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xf4,
-    0x0, 0xef, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff,
-    0xf4, 0x0, 0xef, 0xff, 0xff, 0xf0, 0xcf, 0xff,
-    0xff, 0xfb, 0x99, 0xff, 0xff, 0xff, 0xf0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0084 "󰂄" */
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x4, 0x66, 0xcf, 0xff, 0xff, 0xff,
-    0xe6, 0x65, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xdf,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf1,
-    0xdf, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff,
-    0xf1, 0xdf, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xff,
-    0xff, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0x10, 0xff,
-    0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff, 0xf8, 0x0,
-    0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff, 0xf1,
-    0x0, 0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff,
-    0x70, 0x0, 0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff,
-    0xfe, 0x0, 0x0, 0xdd, 0xef, 0xff, 0xf1, 0xdf,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf1,
-    0xdf, 0xff, 0xe0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xf1, 0xdf, 0xff, 0xc8, 0x81, 0x0, 0x9, 0xff,
-    0xff, 0xf1, 0xdf, 0xff, 0xff, 0xf3, 0x0, 0x2f,
-    0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff, 0xf3, 0x0,
-    0xaf, 0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff, 0xf3,
-    0x3, 0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff,
-    0xf3, 0xb, 0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff,
-    0xff, 0xf3, 0x4f, 0xff, 0xff, 0xff, 0xf1, 0xdf,
-    0xff, 0xff, 0xf3, 0xdf, 0xff, 0xff, 0xff, 0xf1,
-    0xdf, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x4e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0085 "󰂅" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x5f, 0xff, 0xff,
-    0x83, 0x10, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x50, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0xc0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x7, 0xd0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0xe, 0xd0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x7f, 0xd0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xef,
-    0xd0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x7, 0xff, 0xf9, 0x95, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xe, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x7f, 0xff, 0xff, 0xb0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x23, 0x3f,
-    0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0xf, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0xf, 0xf5, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0xf, 0xd0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xf,
-    0x60, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0xe, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x8, 0x0, 0x0, 0x5a, 0xaa,
-    0xaa, 0xaa, 0xaa, 0x70, 0x0, 0x1, 0x0, 0x0,
-
-    /* U+F0086 "󰂆" */
-    0x0, 0x2f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x4f, 0xff, 0xff, 0x62, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x50, 0x0, 0xff, 0xcc,
-    0xcc, 0xcc, 0xcf, 0xf1, 0x0, 0x2, 0xa0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0xa,
-    0xb0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0x2f, 0xb0, 0x0, 0xfd, 0x0, 0x0, 0x0,
-    0xc, 0xf1, 0x0, 0xaf, 0xb0, 0x0, 0xfd, 0x0,
-    0x0, 0x0, 0xc, 0xf1, 0x2, 0xff, 0xb0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1, 0xa, 0xff,
-    0xe9, 0x93, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x2f, 0xff, 0xff, 0xf1, 0xfd, 0x0, 0x0, 0x0,
-    0xc, 0xf1, 0xaf, 0xff, 0xff, 0x80, 0xfd, 0x0,
-    0x0, 0x0, 0xc, 0xf1, 0x33, 0x5f, 0xff, 0x10,
-    0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x2f,
-    0xfa, 0x0, 0xfe, 0x0, 0x0, 0x0, 0xd, 0xf1,
-    0x0, 0x2f, 0xf2, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x2f, 0xb0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x2f, 0x40, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x2c,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x25, 0x0, 0x0, 0x59, 0x99, 0x99, 0x99,
-    0x99, 0x50, 0x0, 0x10, 0x0, 0x0,
-
-    /* U+F0087 "󰂇" */
-    0x0, 0x2f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x4f, 0xff, 0xff, 0x62, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x50, 0x0, 0xff, 0xcc,
-    0xcc, 0xcc, 0xcf, 0xf1, 0x0, 0x2, 0xb0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0xa,
-    0xb0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0x2f, 0xb0, 0x0, 0xfd, 0x0, 0x0, 0x0,
-    0xc, 0xf1, 0x0, 0xaf, 0xb0, 0x0, 0xfd, 0x0,
-    0x0, 0x0, 0xc, 0xf1, 0x2, 0xff, 0xb0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1, 0xa, 0xff,
-    0xea, 0xa3, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x3f, 0xff, 0xff, 0xe0, 0xfd, 0x0, 0x0, 0x0,
-    0xc, 0xf1, 0xbf, 0xff, 0xff, 0x80, 0xfd, 0x0,
-    0x0, 0x0, 0xd, 0xf1, 0x11, 0x4f, 0xff, 0x10,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x2f,
-    0xf9, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x2f, 0xf2, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x2f, 0xa0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x2f, 0x30, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x2b,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x24, 0x0, 0x0, 0x37, 0x77, 0x77, 0x77,
-    0x77, 0x40, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0088 "󰂈" */
-    0x0, 0x2f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x4f, 0xff, 0xff, 0x62, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x50, 0x0, 0xff, 0xcc,
-    0xcc, 0xcc, 0xcf, 0xf1, 0x0, 0x2, 0xb0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0xa,
-    0xb0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0x3f, 0xb0, 0x0, 0xfd, 0x0, 0x0, 0x0,
-    0xc, 0xf1, 0x0, 0xbf, 0xb0, 0x0, 0xfd, 0x0,
-    0x0, 0x0, 0xc, 0xf1, 0x3, 0xff, 0xb0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1, 0xc, 0xff,
-    0xfc, 0xc4, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x4f, 0xff, 0xff, 0xe0, 0xfd, 0x0, 0x0, 0x0,
-    0xc, 0xf1, 0xad, 0xef, 0xff, 0x70, 0xff, 0xbb,
-    0xbb, 0xbb, 0xbf, 0xf1, 0x0, 0x2f, 0xfe, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x2f,
-    0xf8, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x2f, 0xf1, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x2f, 0x90, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x2f, 0x20, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x2a,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x22, 0x0, 0x0, 0x24, 0x44, 0x44, 0x44,
-    0x44, 0x20, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0089 "󰂉" */
-    0x0, 0x2f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x4f, 0xff, 0xff, 0x62, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x50, 0x0, 0xff, 0xcc,
-    0xcc, 0xcc, 0xcf, 0xf1, 0x0, 0x2, 0xb0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0xa,
-    0xb0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0x3f, 0xb0, 0x0, 0xfd, 0x0, 0x0, 0x0,
-    0xc, 0xf1, 0x0, 0xbf, 0xb0, 0x0, 0xfd, 0x0,
-    0x0, 0x0, 0xc, 0xf1, 0x3, 0xff, 0xb0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xc, 0xff,
-    0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xad, 0xef, 0xff, 0x60, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x2f, 0xfe, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x2f,
-    0xf7, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x2f, 0xf1, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x2f, 0x80, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x2f, 0x10, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x2a,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x22, 0x0, 0x0, 0x14, 0x44, 0x44, 0x44,
-    0x44, 0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F008A "󰂊" */
-    0x0, 0x2f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x4f, 0xff, 0xff, 0x62, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x50, 0x0, 0xff, 0xcc,
-    0xcc, 0xcc, 0xcf, 0xf1, 0x0, 0x2, 0xb0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0xa,
-    0xb0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0x3f, 0xb0, 0x0, 0xff, 0xee, 0xee, 0xee,
-    0xef, 0xf1, 0x0, 0xbf, 0xb0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x4, 0xff, 0xb0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xc, 0xff,
-    0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xad, 0xdf, 0xff, 0x50, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x2f, 0xfe, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x2f,
-    0xf7, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x2f, 0xf0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x2f, 0x80, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x2f, 0x10, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x2a,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x22, 0x0, 0x0, 0x14, 0x44, 0x44, 0x44,
-    0x44, 0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F008B "󰂋" */
-    0x0, 0x2f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x4f, 0xff, 0xff, 0x62, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x50, 0x0, 0xff, 0xcc,
-    0xcc, 0xcc, 0xcf, 0xf1, 0x0, 0x2, 0xb0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0xa,
-    0xb0, 0x0, 0xff, 0xcc, 0xcc, 0xcc, 0xcf, 0xf1,
-    0x0, 0x3f, 0xb0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0xbf, 0xb0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x4, 0xff, 0xb0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xc, 0xff,
-    0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x4f, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xad, 0xdf, 0xff, 0x50, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x2f, 0xfe, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x2f,
-    0xf7, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x2f, 0xf0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x2f, 0x80, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x2f, 0x10, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x2a,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x22, 0x0, 0x0, 0x14, 0x44, 0x44, 0x44,
-    0x44, 0x10, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F008C "󰂌" */
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x23, 0x9f, 0xff, 0xff, 0xff,
-    0xf3, 0x32, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xf3,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0xdf, 0xf1, 0xcf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xcf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x1, 0x34, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x43, 0x0,
-
-    /* U+F008D "󰂍" */
-    0x0, 0x3c, 0xcc, 0xcc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xff, 0xcc,
-    0xcc, 0xcc, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0,
-    0xf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x0,
-    0x0, 0x0, 0xf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x3d, 0xdd, 0xdd, 0xdc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x3f, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x11, 0x11, 0x11,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F008E "󰂎" */
-    0x0, 0x0, 0x6c, 0xcc, 0xcc, 0xcc, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xbf, 0xfd, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0xbf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xbf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf1, 0xbf, 0xfc, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F008F "󰂏" */
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x1, 0x23, 0x9f, 0xff, 0xff, 0xff,
-    0xf3, 0x32, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xcf, 0xff, 0xff, 0xfe, 0xee, 0xff, 0xff,
-    0xff, 0xf1, 0xcf, 0xff, 0xff, 0xf5, 0x0, 0xff,
-    0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xf5, 0x0,
-    0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xf5,
-    0x0, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff,
-    0xf5, 0x0, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xf3,
-    0x22, 0x20, 0x0, 0x22, 0x22, 0xdf, 0xf1, 0xcf,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0xcf, 0xf4, 0x33, 0x30, 0x0, 0x33, 0x33, 0xdf,
-    0xf1, 0xcf, 0xff, 0xff, 0xf5, 0x0, 0xff, 0xff,
-    0xff, 0xf1, 0xcf, 0xff, 0xff, 0xf5, 0x0, 0xff,
-    0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xf5, 0x0,
-    0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff, 0xf5,
-    0x0, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x1, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x0,
-
-    /* U+F0090 "󰂐" */
-    0x0, 0x3c, 0xcc, 0xcc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xff, 0xcc,
-    0xcc, 0xcc, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0,
-    0xf, 0xb0, 0x0, 0x5, 0x81, 0x0, 0xfd, 0x0,
-    0x0, 0x0, 0xf, 0xb0, 0x0, 0x9, 0xf3, 0x0,
-    0xfd, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x9,
-    0xf3, 0x0, 0xfd, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x3d, 0xde, 0xfe, 0xdc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x3f, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x9, 0xf3, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x9,
-    0xf3, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x6, 0xa2, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x11, 0x11, 0x11,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0091 "󰂑" */
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x1, 0x33, 0x9f, 0xff, 0xff, 0xff,
-    0xf3, 0x32, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff,
-    0xfc, 0xab, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff,
-    0xfa, 0x10, 0x0, 0x7, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf1,
-    0xbf, 0xfd, 0x0, 0x5, 0x97, 0x10, 0x8, 0xff,
-    0xf1, 0xbf, 0xf6, 0x0, 0x7f, 0xff, 0xd0, 0x1,
-    0xff, 0xf1, 0xbf, 0xf2, 0x0, 0xff, 0xff, 0xf6,
-    0x0, 0xdf, 0xf1, 0xbf, 0xfb, 0xbb, 0xff, 0xff,
-    0xf6, 0x0, 0xdf, 0xf1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0xff, 0xf1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x7, 0xff, 0xf1, 0xbf, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x4f, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xff, 0x70, 0x4, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xfd, 0x0, 0x2f, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xf8, 0x0, 0x9f, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xfe, 0xcc, 0xff,
-    0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff,
-    0xf5, 0x0, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff,
-    0xff, 0xf4, 0x0, 0xff, 0xff, 0xff, 0xf1, 0xbf,
-    0xff, 0xff, 0xf4, 0x0, 0xff, 0xff, 0xff, 0xf1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x1, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x0,
-
-    /* U+F00AF "󰂯" */
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x62,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x6f, 0xe2, 0x0, 0x0, 0xbf, 0xfd, 0xff, 0xf3,
-    0x0, 0xd, 0xff, 0xe2, 0x0, 0xb, 0xff, 0x2c,
-    0xff, 0xf4, 0x0, 0x1d, 0xff, 0xe2, 0x0, 0xbf,
-    0xf1, 0xc, 0xff, 0xf4, 0x0, 0x1d, 0xff, 0xe2,
-    0xb, 0xff, 0x10, 0xbf, 0xff, 0x50, 0x0, 0x1d,
-    0xff, 0xe2, 0xbf, 0xf1, 0xbf, 0xff, 0x50, 0x0,
-    0x0, 0x1d, 0xff, 0xed, 0xff, 0xcf, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xef, 0xfe,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x5b,
-    0xff, 0x2d, 0xff, 0xe2, 0x0, 0x0, 0xaf, 0xff,
-    0x50, 0xbf, 0xf1, 0x1d, 0xff, 0xe2, 0x0, 0xaf,
-    0xff, 0x50, 0xb, 0xff, 0x10, 0x9f, 0xff, 0x60,
-    0xaf, 0xff, 0x50, 0x0, 0xbf, 0xf1, 0x9f, 0xff,
-    0x70, 0xa, 0xff, 0x50, 0x0, 0xb, 0xff, 0xaf,
-    0xff, 0x70, 0x0, 0xa, 0x50, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x30,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F00B0 "󰂰" */
-    0x0, 0x0, 0x0, 0x3c, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0,
-    0x0, 0x4f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x0, 0x4f, 0xfd, 0xfe, 0x30, 0x0,
-    0x0, 0x0, 0x5f, 0xfb, 0x0, 0x4f, 0xe1, 0xdf,
-    0xe3, 0x0, 0x1, 0x40, 0x5, 0xff, 0xb0, 0x4f,
-    0xe0, 0x4f, 0xfc, 0x0, 0xd, 0xd0, 0x0, 0x5f,
-    0xfb, 0x5f, 0xe3, 0xef, 0xd1, 0x0, 0xc, 0xf3,
-    0x0, 0x5, 0xff, 0xef, 0xfe, 0xfd, 0x10, 0x10,
-    0x7, 0xf8, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xd1,
-    0x1, 0xd3, 0x3, 0xfb, 0x0, 0x0, 0x5, 0xff,
-    0xfd, 0x10, 0x1d, 0xf6, 0x1, 0xfc, 0x0, 0x0,
-    0x2, 0xff, 0xfb, 0x0, 0x3f, 0xf6, 0x1, 0xfc,
-    0x0, 0x0, 0x3e, 0xff, 0xff, 0xa0, 0x3, 0xf4,
-    0x3, 0xfb, 0x0, 0x3, 0xef, 0xff, 0xff, 0xfb,
-    0x0, 0x30, 0x6, 0xf8, 0x0, 0x3e, 0xfd, 0x6f,
-    0xe5, 0xff, 0xb0, 0x0, 0xb, 0xf3, 0x3, 0xef,
-    0xd1, 0x4f, 0xe0, 0x5f, 0xfb, 0x0, 0xe, 0xd0,
-    0x3e, 0xfd, 0x10, 0x4f, 0xe0, 0xbf, 0xf5, 0x0,
-    0x3, 0x40, 0x8f, 0xd1, 0x0, 0x4f, 0xeb, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x7, 0x10, 0x0, 0x4f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F00B1 "󰂱" */
-    0x0, 0x0, 0x0, 0x0, 0x2c, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x0, 0x0, 0x3f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xb0, 0x0, 0x3f, 0xfd, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x4f, 0xfc, 0x0, 0x3f, 0xe1,
-    0xdf, 0xf4, 0x0, 0x0, 0x0, 0x5, 0xff, 0xc0,
-    0x3f, 0xe0, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xfc, 0x4f, 0xe3, 0xef, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xef, 0xfe, 0xfe, 0x20,
-    0x0, 0x0, 0x5, 0xb0, 0x0, 0x5f, 0xff, 0xff,
-    0xe2, 0x0, 0x2d, 0x20, 0x5f, 0xfb, 0x0, 0x5,
-    0xff, 0xfe, 0x20, 0x2, 0xef, 0xe2, 0x9f, 0xfe,
-    0x10, 0x2, 0xef, 0xfb, 0x0, 0x4, 0xff, 0xf5,
-    0x9, 0xe2, 0x0, 0x2e, 0xff, 0xff, 0xb0, 0x0,
-    0x5f, 0x50, 0x0, 0x10, 0x2, 0xef, 0xff, 0xff,
-    0xfb, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2e, 0xfe,
-    0x5f, 0xe5, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xe2, 0x3f, 0xe0, 0x5f, 0xfb, 0x0, 0x0,
-    0x0, 0x2e, 0xfe, 0x20, 0x3f, 0xe0, 0xaf, 0xf6,
-    0x0, 0x0, 0x0, 0x7f, 0xe2, 0x0, 0x3f, 0xea,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x6, 0x20, 0x0,
-    0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F00B2 "󰂲" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x5, 0x10,
-    0x0, 0x0, 0x5f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x6f, 0xc1, 0x0, 0x0, 0x5f, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x9f, 0xfc, 0x10, 0x0, 0x5f, 0xfe,
-    0xff, 0x70, 0x0, 0x0, 0x9, 0xff, 0xc1, 0x0,
-    0x5f, 0xf3, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x9f,
-    0xfc, 0x0, 0x1e, 0xf0, 0x2e, 0xff, 0x70, 0x0,
-    0x0, 0x9, 0xff, 0xc0, 0x2, 0xe0, 0x3f, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x9f, 0xfc, 0x0, 0x24,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xc0, 0x2, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfc, 0x0, 0x24, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xaf, 0xfa, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf4, 0x5f, 0xf1,
-    0x9f, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x40,
-    0x5f, 0xf0, 0xd, 0xff, 0xc0, 0x0, 0x3, 0xef,
-    0xf4, 0x0, 0x5f, 0xf1, 0x9f, 0xff, 0xfc, 0x0,
-    0x5, 0xff, 0x40, 0x0, 0x5f, 0xfa, 0xff, 0xc9,
-    0xff, 0xc0, 0x0, 0x55, 0x0, 0x0, 0x5f, 0xff,
-    0xfc, 0x10, 0x9f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xc1, 0x0, 0x9, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xfc, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F00B3 "󰂳" */
-    0x0, 0x0, 0x0, 0x6, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf4, 0x0, 0x0,
-    0x1, 0x10, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0,
-    0x1d, 0xd1, 0x0, 0x6, 0xff, 0xef, 0xf4, 0x0,
-    0x4f, 0xfd, 0x20, 0x6, 0xfe, 0x2e, 0xff, 0x40,
-    0x5, 0xff, 0xe2, 0x6, 0xfe, 0x1, 0xef, 0xf3,
-    0x0, 0x4f, 0xfe, 0x26, 0xfe, 0x7, 0xff, 0xb0,
-    0x0, 0x4, 0xff, 0xe9, 0xfe, 0x8f, 0xfb, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0xaf, 0xfe, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0xa, 0xff, 0xa6, 0xfe, 0x4f, 0xff, 0x50,
-    0x0, 0xbf, 0xfa, 0x6, 0xfe, 0x4, 0xff, 0xf5,
-    0xb, 0xff, 0xa0, 0x6, 0xfe, 0x8, 0xff, 0xd2,
-    0x5f, 0xf9, 0x0, 0x6, 0xfe, 0x8f, 0xfd, 0x10,
-    0x7, 0x90, 0x0, 0x6, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x10, 0x0, 0x11, 0x0, 0x1, 0x10,
-    0x0, 0x4f, 0xf0, 0x6, 0xfe, 0x0, 0x7f, 0xd0,
-    0x0, 0x4f, 0xf0, 0x6, 0xfe, 0x0, 0x7f, 0xd0,
-    0x0, 0x13, 0x30, 0x1, 0x33, 0x0, 0x13, 0x30,
-
-    /* U+F00B4 "󰂴" */
-    0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xe2, 0x0, 0x0, 0x0, 0x42, 0x0, 0x7, 0x0,
-    0x1, 0xff, 0xfe, 0x30, 0x0, 0x1, 0xec, 0x0,
-    0xbf, 0x90, 0x1, 0xfe, 0xaf, 0xe3, 0x0, 0xc,
-    0xff, 0x90, 0x3e, 0xf9, 0x1, 0xfe, 0xa, 0xfe,
-    0x30, 0x8f, 0xff, 0xf5, 0x3, 0xef, 0x91, 0xfe,
-    0xc, 0xfd, 0x10, 0x34, 0xfe, 0x32, 0x0, 0x3e,
-    0xfa, 0xfe, 0xcf, 0xd1, 0x0, 0x1, 0xfe, 0x0,
-    0x0, 0x3, 0xef, 0xff, 0xfd, 0x10, 0x0, 0x1,
-    0xfe, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x32, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfa, 0x0, 0x0, 0x1, 0xec, 0x0,
-    0x0, 0xc, 0xfe, 0xff, 0xff, 0xa0, 0x0, 0x1,
-    0xfe, 0x0, 0x0, 0xcf, 0xd2, 0xfe, 0x3f, 0xfa,
-    0x0, 0x1, 0xfe, 0x0, 0xc, 0xfd, 0x11, 0xfe,
-    0x8, 0xff, 0x50, 0xae, 0xff, 0xe7, 0xbf, 0xd1,
-    0x1, 0xfe, 0x5f, 0xf8, 0x0, 0x1e, 0xff, 0xc0,
-    0x3c, 0x10, 0x1, 0xff, 0xff, 0x70, 0x0, 0x4,
-    0xfe, 0x10, 0x0, 0x0, 0x1, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x84, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F03A0 "󰎠" */
-    0xff, 0xfe, 0x1, 0xff, 0xff, 0xc3, 0x0, 0xff,
-    0xff, 0xc2, 0xff, 0xff, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0xfc, 0x1, 0xff, 0x0, 0x0,
-    0x1, 0xfe, 0x0, 0x0, 0x1, 0xfd, 0x0, 0xff,
-    0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x1, 0xfd,
-    0x0, 0xff, 0x0, 0x3b, 0xcd, 0xfd, 0x0, 0x0,
-    0xcd, 0xf7, 0x0, 0xff, 0x0, 0xef, 0xff, 0xf5,
-    0x0, 0x1, 0xff, 0xf6, 0x0, 0xff, 0x1, 0xfe,
-    0x22, 0x0, 0x0, 0x0, 0x23, 0xfd, 0x0, 0xff,
-    0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x0, 0xff, 0x1, 0xff, 0xff, 0xfd, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0xff, 0x1, 0xff, 0xff, 0xfe,
-    0x0, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F03A1 "󰎡" */
-    0x2b, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0x90, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xfd, 0x77, 0x79, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0x90, 0x3f, 0xe0, 0xe, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0x90, 0x3f, 0xe0, 0xe, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0x90, 0x3f, 0xe0,
-    0xe, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x90,
-    0x3f, 0xe0, 0xe, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0x90, 0x3f, 0xe0, 0xe, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0x90, 0x3f, 0xe0, 0xe, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0x90, 0x18, 0x70,
-    0xf, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xfc, 0x65, 0x57, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-
-    /* U+F03A2 "󰎢" */
-    0x0, 0x0, 0x8b, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcb, 0x91, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x9,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0xfd, 0x9, 0xf2, 0x0, 0x7, 0xff, 0xf8, 0x0,
-    0x1, 0xfb, 0xfd, 0x9, 0xf2, 0x0, 0xf, 0xeb,
-    0xef, 0x10, 0x1, 0xfb, 0xfd, 0x9, 0xf2, 0x0,
-    0xf, 0xb0, 0xbf, 0x20, 0x1, 0xfb, 0xfd, 0x9,
-    0xf2, 0x0, 0xf, 0xb0, 0xbf, 0x20, 0x1, 0xfb,
-    0xfd, 0x9, 0xf2, 0x0, 0xf, 0xb0, 0xbf, 0x20,
-    0x1, 0xfb, 0xfd, 0x9, 0xf2, 0x0, 0xf, 0xb0,
-    0xbf, 0x20, 0x1, 0xfb, 0xfd, 0x9, 0xf2, 0x0,
-    0xf, 0xb0, 0xbf, 0x20, 0x1, 0xfb, 0xfd, 0x9,
-    0xf2, 0x0, 0xf, 0xff, 0xff, 0x0, 0x1, 0xfb,
-    0xfd, 0x9, 0xf2, 0x0, 0x4, 0xcd, 0xc5, 0x0,
-    0x1, 0xfb, 0xfd, 0x9, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0xfd, 0x9, 0xf3, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x23, 0xfb, 0xfd, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xfd, 0x0, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x70, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0x10, 0x0, 0x6e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-
-    /* U+F03A3 "󰎣" */
-    0x2b, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xb1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0x74, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x47, 0xfe, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x0, 0x34, 0x42, 0x0, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0xa, 0xff, 0xff,
-    0x80, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x3f,
-    0xff, 0xff, 0xf0, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x4f, 0xe0, 0x1f, 0xf2, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x4f, 0xe0, 0x1f, 0xf2, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f, 0xe0, 0x1f,
-    0xf2, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f,
-    0xe0, 0x1f, 0xf2, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x4f, 0xe0, 0x1f, 0xf2, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x4f, 0xe0, 0x1f, 0xf2, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f, 0xf5, 0x6f,
-    0xf1, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x4, 0xcd, 0xdb, 0x30, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfe, 0xff, 0x63, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x37, 0xfe, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2,
-
-    /* U+F03A4 "󰎤" */
-    0x2b, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0x90, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xfc, 0x66, 0x66, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfa,
-    0x11, 0x0, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x55, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-
-    /* U+F03A5 "󰎥" */
-    0x0, 0x0, 0x9b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0x91, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x9,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0xfc, 0x9, 0xf1, 0x0, 0x0, 0xef, 0xf9, 0x0,
-    0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0, 0x0, 0xab,
-    0xf9, 0x0, 0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x1, 0xfb, 0xfc, 0x9,
-    0xf1, 0x0, 0x0, 0x1, 0xf9, 0x0, 0x1, 0xfb,
-    0xfc, 0x9, 0xf1, 0x0, 0x0, 0x1, 0xf9, 0x0,
-    0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0, 0x0, 0x1,
-    0xf9, 0x0, 0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x1, 0xfb, 0xfc, 0x9,
-    0xf1, 0x0, 0x0, 0x1, 0xf9, 0x0, 0x1, 0xfb,
-    0xfc, 0x9, 0xf1, 0x0, 0x0, 0x1, 0xd8, 0x0,
-    0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0xfc, 0x9, 0xf3, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x23, 0xfb, 0xfc, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xfc, 0x0, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x70, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0x10, 0x0, 0x6e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-
-    /* U+F03A6 "󰎦" */
-    0x2b, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xb1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0x74, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x47, 0xfe, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x1, 0x44, 0x44, 0x0, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x5, 0xff, 0xff,
-    0x0, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x5,
-    0xff, 0xff, 0x0, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x0,
-    0x2, 0xff, 0x0, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x0,
-    0x2, 0xff, 0x0, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x0, 0x1, 0xbb, 0x0, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfe, 0xff, 0x63, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x37, 0xfe, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2,
-
-    /* U+F03A7 "󰎧" */
-    0x2b, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0x90, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xc6, 0x66, 0x79, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x91,
-    0x11, 0x10, 0xf, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0xe, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xf8, 0x21, 0x10,
-    0x1f, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x1, 0xbf, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0x90, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0x80, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0x80, 0x13, 0x33,
-    0x3f, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xb5, 0x55, 0x55, 0x5f, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-
-    /* U+F03A8 "󰎨" */
-    0x0, 0x0, 0x9b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0x91, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x9,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0xfc, 0x9, 0xf1, 0x0, 0xf, 0xff, 0xf8, 0x0,
-    0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0, 0xb, 0xbb,
-    0xef, 0x10, 0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0,
-    0x0, 0x0, 0xaf, 0x10, 0x1, 0xfb, 0xfc, 0x9,
-    0xf1, 0x0, 0x2, 0x9a, 0xef, 0x10, 0x1, 0xfb,
-    0xfc, 0x9, 0xf1, 0x0, 0xd, 0xff, 0xfa, 0x0,
-    0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0, 0xf, 0xc2,
-    0x10, 0x0, 0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0,
-    0xf, 0xb0, 0x0, 0x0, 0x1, 0xfb, 0xfc, 0x9,
-    0xf1, 0x0, 0xf, 0xff, 0xff, 0x10, 0x1, 0xfb,
-    0xfc, 0x9, 0xf1, 0x0, 0xd, 0xdd, 0xdd, 0x10,
-    0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0xfc, 0x9, 0xf3, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x23, 0xfb, 0xfc, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xfc, 0x0, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x70, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0x10, 0x0, 0x6e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-
-    /* U+F03A9 "󰎩" */
-    0x2b, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xb1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0x74, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x47, 0xfe, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x14, 0x44, 0x42, 0x0, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f, 0xff, 0xff,
-    0x80, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f,
-    0xff, 0xff, 0xf0, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x5, 0xde, 0xef,
-    0xf0, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x1f,
-    0xff, 0xff, 0x80, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x4f, 0xf3, 0x32, 0x0, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f, 0xf5, 0x55,
-    0x50, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f,
-    0xff, 0xff, 0xf1, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x3d, 0xdd, 0xdd, 0xd1, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfe, 0xff, 0x63, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x37, 0xfe, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2,
-
-    /* U+F03AA "󰎪" */
-    0x2b, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0x90, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xc6, 0x66, 0x79, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x91,
-    0x11, 0x10, 0xf, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0xe, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x10,
-    0x8f, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0xf, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xa3, 0x33, 0x30,
-    0xf, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xb5, 0x55, 0x57, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-
-    /* U+F03AB "󰎫" */
-    0x0, 0x0, 0x9b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0x91, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x9,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0xfc, 0x9, 0xf1, 0x0, 0x4f, 0xff, 0xf8, 0x0,
-    0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0, 0x2b, 0xbb,
-    0xef, 0x10, 0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0,
-    0x0, 0x0, 0xaf, 0x10, 0x1, 0xfb, 0xfc, 0x9,
-    0xf1, 0x0, 0x0, 0x5b, 0xef, 0x0, 0x1, 0xfb,
-    0xfc, 0x9, 0xf1, 0x0, 0x0, 0x7f, 0xf7, 0x0,
-    0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0, 0x0, 0x0,
-    0xbf, 0x10, 0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0,
-    0x0, 0x0, 0xaf, 0x10, 0x1, 0xfb, 0xfc, 0x9,
-    0xf1, 0x0, 0x4f, 0xff, 0xff, 0x0, 0x1, 0xfb,
-    0xfc, 0x9, 0xf1, 0x0, 0x3d, 0xdd, 0xc5, 0x0,
-    0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0xfc, 0x9, 0xf3, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x23, 0xfb, 0xfc, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xfc, 0x0, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x70, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0x10, 0x0, 0x6e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-
-    /* U+F03AC "󰎬" */
-    0x2b, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xb1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0x74, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x47, 0xfe, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x14, 0x44, 0x42, 0x0, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x6f, 0xff, 0xff,
-    0x80, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x6f,
-    0xff, 0xff, 0xf0, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x0, 0x3f, 0xff,
-    0xc0, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x0,
-    0x3f, 0xff, 0x50, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x0, 0x3, 0x4f, 0xf0, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x25, 0x55, 0x6f,
-    0xf1, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x6f,
-    0xff, 0xff, 0xe0, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x6d, 0xdd, 0xdb, 0x30, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfe, 0xff, 0x63, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x37, 0xfe, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2,
-
-    /* U+F03AD "󰎭" */
-    0x2b, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0x90, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xc6, 0x8f, 0xf6, 0x6f, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xe0,
-    0xe, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x80,
-    0x3f, 0xe0, 0xe, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0x80, 0x3f, 0xe0, 0xe, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0x80, 0x3d, 0xc0, 0xe, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xec, 0xcc, 0xb0, 0xe, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xe, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xe, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x5f, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-
-    /* U+F03AE "󰎮" */
-    0x2b, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xb1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0x74, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x47, 0xfe, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x1, 0x10, 0x1, 0x10, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f, 0xe0, 0x1f,
-    0xf1, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f,
-    0xe0, 0x1f, 0xf1, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x4f, 0xe0, 0x1f, 0xf1, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x4f, 0xe0, 0x1f, 0xf1, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f, 0xfb, 0xbf,
-    0xf1, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f,
-    0xff, 0xff, 0xf1, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x27, 0x77, 0x8f, 0xf1, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x0, 0x0, 0x1f,
-    0xf1, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x1f, 0xf1, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x1d, 0xd1, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfe, 0xff, 0x63, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x37, 0xfe, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2,
-
-    /* U+F03AF "󰎯" */
-    0x0, 0x0, 0x9b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0x91, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x9,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0xfc, 0x9, 0xf1, 0x0, 0xf, 0xff, 0xff, 0x10,
-    0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0, 0xf, 0xeb,
-    0xbb, 0x10, 0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0,
-    0xf, 0xb0, 0x0, 0x0, 0x1, 0xfb, 0xfc, 0x9,
-    0xf1, 0x0, 0xf, 0xeb, 0xb4, 0x0, 0x1, 0xfb,
-    0xfc, 0x9, 0xf1, 0x0, 0xf, 0xff, 0xff, 0x0,
-    0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0, 0x0, 0x0,
-    0xbf, 0x10, 0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0,
-    0x0, 0x0, 0xaf, 0x10, 0x1, 0xfb, 0xfc, 0x9,
-    0xf1, 0x0, 0xf, 0xff, 0xff, 0x0, 0x1, 0xfb,
-    0xfc, 0x9, 0xf1, 0x0, 0xd, 0xdd, 0xc5, 0x0,
-    0x1, 0xfb, 0xfc, 0x9, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0xfc, 0x9, 0xf3, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x23, 0xfb, 0xfc, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xfc, 0x0, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x70, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0x10, 0x0, 0x6e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-
-    /* U+F03B0 "󰎰" */
-    0x2b, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xb1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0x74, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x47, 0xfe, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x14, 0x44, 0x44, 0x40, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f, 0xff, 0xff,
-    0xf1, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f,
-    0xff, 0xff, 0xf1, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f, 0xff, 0xfd,
-    0x40, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f,
-    0xff, 0xff, 0xe0, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x3, 0x33, 0x4f, 0xf1, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x4, 0xfe, 0xff, 0x30, 0x0, 0x15, 0x55, 0x6f,
-    0xf1, 0x0, 0x4, 0xfe, 0xff, 0x30, 0x0, 0x4f,
-    0xff, 0xff, 0xe0, 0x0, 0x4, 0xfe, 0xff, 0x30,
-    0x0, 0x3d, 0xdd, 0xdb, 0x30, 0x0, 0x4, 0xfe,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfe, 0xff, 0x63, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x37, 0xfe, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2,
-
-    /* U+F03B1 "󰎱" */
-    0x2b, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0x90, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xc6, 0x66, 0x66, 0x6f, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x80,
-    0x1, 0x11, 0x1e, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0x80, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0x80, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0x80, 0x1, 0x13,
-    0xcf, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0xe, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xa3, 0x33, 0x30,
-    0xf, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xb5, 0x55, 0x57, 0xef, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-
-    /* U+F04C5 "󰓅" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x9d, 0xff, 0xff,
-    0xc7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xfd, 0xdf, 0xfd, 0x40, 0x1, 0x0, 0x0, 0x1c,
-    0xff, 0x92, 0x0, 0x0, 0x30, 0x1, 0x96, 0x0,
-    0x0, 0xcf, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0xd0, 0x0, 0x8, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x4d, 0xff, 0x40, 0x0, 0x1f, 0xf3, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xfb, 0x1, 0xb0, 0x7f, 0xa0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf2, 0x9, 0xf2,
-    0xbf, 0x40, 0x0, 0x2, 0xef, 0xff, 0xff, 0x80,
-    0x9, 0xf7, 0xef, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xfe, 0x0, 0x5, 0xfa, 0xff, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf5, 0x0, 0x4, 0xfb, 0xef, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xc0, 0x0, 0x5, 0xfa,
-    0xcf, 0x30, 0x0, 0x6, 0xff, 0xff, 0x20, 0x0,
-    0x7, 0xf8, 0x8f, 0x80, 0x0, 0x0, 0x38, 0x82,
-    0x0, 0x0, 0xc, 0xf4, 0x3f, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0xb, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x60,
-    0x2, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfc, 0x0, 0x0, 0x3e, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xc1, 0x0,
-
-    /* U+F0553 "󰕓" */
-    0x0, 0x0, 0x0, 0x0, 0x7, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x56, 0xbf, 0xf7,
-    0x64, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12,
-    0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xe3, 0x0, 0x8f, 0xf1, 0x0, 0xff,
-    0xff, 0xf3, 0x4f, 0xff, 0xfe, 0x0, 0x8f, 0xf1,
-    0x0, 0xff, 0xff, 0xf3, 0x8f, 0xff, 0xff, 0x20,
-    0x8f, 0xf1, 0x0, 0xff, 0xff, 0xf3, 0x7f, 0xff,
-    0xff, 0x10, 0x8f, 0xf1, 0x0, 0xff, 0xff, 0xf3,
-    0xd, 0xff, 0xf8, 0x0, 0x8f, 0xf1, 0x0, 0xff,
-    0xff, 0xf3, 0x0, 0xff, 0xb0, 0x0, 0x8f, 0xf1,
-    0x0, 0x5d, 0xff, 0x51, 0x0, 0xff, 0xa0, 0x0,
-    0x8f, 0xf1, 0x0, 0xb, 0xfe, 0x0, 0x0, 0xff,
-    0xb0, 0x0, 0x8f, 0xf1, 0x0, 0xb, 0xfe, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x5, 0x9a, 0xaa,
-    0xdf, 0xfa, 0xaa, 0xa9, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xdf, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x10, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+F0632 "󰘲" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf6, 0x8f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x60, 0x8, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x6, 0xff, 0x60,
-    0x0, 0x0, 0x8, 0xff, 0x40, 0x0, 0x0, 0x6f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0,
-    0x6, 0xff, 0xfe, 0xd0, 0x0, 0x0, 0x1e, 0xef,
-    0xff, 0x40, 0x6f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0xdd, 0xdd, 0xdf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-
-    /* U+F0633 "󰘳" */
-    0x0, 0x7c, 0xb7, 0x0, 0x0, 0x0, 0x1, 0x9c,
-    0xb5, 0x0, 0x1d, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x2e, 0xff, 0xff, 0x90, 0x9f, 0xc3, 0x4d, 0xf7,
-    0x0, 0x0, 0xcf, 0xa3, 0x5e, 0xf5, 0xef, 0x10,
-    0x3, 0xfc, 0x0, 0x1, 0xfe, 0x0, 0x6, 0xfa,
-    0xff, 0x0, 0x1, 0xfd, 0x0, 0x2, 0xfc, 0x0,
-    0x4, 0xfa, 0xcf, 0x80, 0x1, 0xfd, 0x0, 0x2,
-    0xfc, 0x0, 0xc, 0xf7, 0x3f, 0xfe, 0xdd, 0xff,
-    0xdd, 0xdd, 0xff, 0xdd, 0xff, 0xd0, 0x4, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10,
-    0x0, 0x1, 0x23, 0xfe, 0x22, 0x24, 0xfc, 0x22,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x2,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfd, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0,
-    0x1, 0x8c, 0xdd, 0xff, 0xdd, 0xdd, 0xff, 0xdd,
-    0xc6, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0xaf, 0xb2, 0x12, 0xfd,
-    0x11, 0x13, 0xfc, 0x11, 0x4e, 0xf5, 0xff, 0x10,
-    0x1, 0xfd, 0x0, 0x2, 0xfc, 0x0, 0x5, 0xfa,
-    0xff, 0x0, 0x2, 0xfd, 0x0, 0x2, 0xfd, 0x0,
-    0x5, 0xfa, 0xbf, 0x90, 0x1b, 0xf9, 0x0, 0x0,
-    0xef, 0x70, 0x1c, 0xf6, 0x2f, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xc0, 0x2, 0xbf,
-    0xfa, 0x10, 0x0, 0x0, 0x4, 0xcf, 0xe9, 0x0,
-
-    /* U+F0634 "󰘴" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xf5, 0x9f, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x40, 0x9,
-    0xff, 0xd1, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf4,
-    0x0, 0x0, 0x9f, 0xfd, 0x10, 0x0, 0x0, 0x5f,
-    0xff, 0x40, 0x0, 0x0, 0x9, 0xff, 0xd1, 0x0,
-    0x5, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfd, 0x10, 0x5f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xd1, 0xaf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0xa, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x60,
-
-    /* U+F0635 "󰘵" */
-    0xdd, 0xdd, 0xdd, 0xb0, 0x0, 0x0, 0xcd, 0xdd,
-    0xdd, 0xd9, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xfb, 0x66, 0x66, 0x6b, 0xfc,
-    0x0, 0x0, 0x56, 0x66, 0x66, 0x64, 0x0, 0x0,
-    0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x64, 0x44, 0x42,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xfa,
-
-    /* U+F0636 "󰘶" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf6, 0x8f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x60, 0x8, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x0, 0x0,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x6, 0xff, 0x50,
-    0x0, 0x0, 0x8, 0xff, 0x40, 0x0, 0x0, 0x6f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0,
-    0x6, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x40, 0x6f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+F093E "󰤾" */
-    0x0, 0xb, 0xbb, 0xbb, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0xdf, 0xff, 0xff,
-    0xfd, 0xc2, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x11, 0x11, 0x11, 0x17, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0xa2, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x1, 0x10, 0xce, 0x20,
-    0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x5, 0xd1,
-    0xc7, 0xe2, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x6c, 0xda, 0xc0, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x7, 0xfc, 0x10, 0xfe, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x6, 0xfc, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x6d,
-    0xdb, 0xc0, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x4, 0xd1, 0xc7, 0xe2, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x1, 0x20, 0xce, 0x30, 0xfe, 0x0,
-    0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0xb3, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7c, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xb2, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F093F "󰤿" */
-    0x0, 0xb, 0xbb, 0xbb, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0xdf, 0xff, 0xff,
-    0xfd, 0xc2, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x11, 0x11, 0x11, 0x17, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0xa2, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x10, 0xce, 0x20,
-    0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x5, 0xd1,
-    0xc8, 0xe2, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x7c, 0xda, 0xc1, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x7, 0xfd, 0x10, 0xfe, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x6, 0xfc, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x6d,
-    0xeb, 0xc0, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x4, 0xd1, 0xc7, 0xe2, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x1, 0x20, 0xce, 0x30, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xb3, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7c, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xb2, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0940 "󰥀" */
-    0x0, 0xb, 0xbb, 0xbb, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0xdf, 0xff, 0xff,
-    0xfd, 0xc2, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x11, 0x11, 0x11, 0x17, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0xa2, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x10, 0xce, 0x20,
-    0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x5, 0xc1,
-    0xc8, 0xe2, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x7c, 0xda, 0xd1, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x8, 0xfd, 0x10, 0xfe, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x6, 0xfc, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x5d,
-    0xeb, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x4, 0xd1, 0xc7, 0xe2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x1, 0x20, 0xce, 0x30, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xb3, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7c, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xb2, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0941 "󰥁" */
-    0x0, 0xb, 0xbb, 0xbb, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0xdf, 0xff, 0xff,
-    0xfd, 0xc2, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x11, 0x11, 0x11, 0x17, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0xa2, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x10, 0xce, 0x20,
-    0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x5, 0xd1,
-    0xc8, 0xe2, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x7c, 0xda, 0xc1, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x7, 0xfd, 0x10, 0xfe, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x6, 0xfc, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x6d,
-    0xeb, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x5, 0xd1, 0xc7, 0xe2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x1, 0x10, 0xce, 0x20, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xb2, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x6b, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xa1, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0942 "󰥂" */
-    0x0, 0xb, 0xbb, 0xbb, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0xdf, 0xff, 0xff,
-    0xfd, 0xc2, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x11, 0x11, 0x11, 0x17, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0xa2, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x10, 0xce, 0x20,
-    0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x5, 0xc1,
-    0xc8, 0xe2, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x7c, 0xda, 0xc1, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x7, 0xfd, 0x10, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x6, 0xfc, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x6d,
-    0xdb, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x5, 0xd1, 0xc8, 0xe2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x1, 0x10, 0xce, 0x20, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xa2, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x6b, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xa1, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0943 "󰥃" */
-    0x0, 0xb, 0xbb, 0xbb, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0xdf, 0xff, 0xff,
-    0xfd, 0xc2, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x11, 0x11, 0x11, 0x17, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0xa2, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x1, 0x10, 0xce, 0x20,
-    0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x5, 0xd1,
-    0xc7, 0xe2, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x6c, 0xda, 0xc0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x7, 0xfc, 0x10, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xfc, 0x10,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x6c,
-    0xda, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x5, 0xd1, 0xc8, 0xe2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x10, 0xce, 0x20, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xa2, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xaa,
-    0xaa, 0xaa, 0xaa, 0x91, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0944 "󰥄" */
-    0x0, 0xb, 0xbb, 0xbb, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0xdf, 0xff, 0xff,
-    0xfd, 0xc2, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x11, 0x11, 0x11, 0x17, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0xa2, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x10, 0xce, 0x20,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x5, 0xd1,
-    0xc7, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x6c, 0xdb, 0xc0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x6, 0xfc, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x7, 0xfd, 0x10,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x7c,
-    0xda, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x5, 0xc1, 0xc9, 0xd1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x10, 0xcd, 0x10, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x91, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xaa,
-    0xaa, 0xaa, 0xaa, 0x91, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0945 "󰥅" */
-    0x0, 0xb, 0xbb, 0xbb, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0xdf, 0xff, 0xff,
-    0xfd, 0xc2, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x11, 0x11, 0x11, 0x17, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-    0x5, 0xf8, 0x0, 0x0, 0x80, 0x0, 0xff, 0x99,
-    0x99, 0x99, 0x9c, 0xf8, 0x0, 0x0, 0xcc, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x5, 0x90,
-    0xcb, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xb9, 0xd7, 0xe2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0xb, 0xfe, 0x30, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x4, 0xfa, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3e,
-    0xed, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x3, 0xe3, 0xc6, 0xf3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x2, 0x30, 0xcf, 0x50, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xc4, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0946 "󰥆" */
-    0x0, 0xb, 0xbb, 0xbb, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0xdf, 0xff, 0xff,
-    0xfd, 0xc2, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x11, 0x11, 0x11, 0x17, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x88, 0x88, 0x88,
-    0x8b, 0xf8, 0x0, 0x0, 0x60, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xcb, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x5, 0x90,
-    0xcb, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0xa9, 0xd7, 0xe2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0xb, 0xfe, 0x30, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x4, 0xfa, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3e,
-    0xed, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x3, 0xe3, 0xc6, 0xf3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x2, 0x30, 0xcf, 0x50, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xc4, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0947 "󰥇" */
-    0x0, 0x1b, 0xbb, 0xbb, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0xdf, 0xff, 0xff,
-    0xfc, 0xc3, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd1, 0x2f,
-    0xff, 0xfa, 0x0, 0x0, 0xb2, 0x0, 0xff, 0xff,
-    0xc0, 0x1f, 0xff, 0xfa, 0x0, 0x10, 0xdd, 0x10,
-    0xff, 0xff, 0xc0, 0x1f, 0xff, 0xfa, 0x4, 0xd1,
-    0xd7, 0xd1, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xfa,
-    0x0, 0x7c, 0xda, 0xc1, 0xff, 0xff, 0xc0, 0x1f,
-    0xff, 0xfa, 0x0, 0x8, 0xfd, 0x10, 0xff, 0xff,
-    0xc0, 0x1f, 0xff, 0xfa, 0x0, 0x6, 0xfb, 0x0,
-    0xff, 0xff, 0xfe, 0xef, 0xff, 0xfa, 0x0, 0x5d,
-    0xeb, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x3, 0xe2, 0xd7, 0xe2, 0xff, 0xff, 0xc0, 0x1f,
-    0xff, 0xfa, 0x0, 0x20, 0xde, 0x20, 0xff, 0xff,
-    0xc0, 0x1f, 0xff, 0xfa, 0x0, 0x0, 0xb2, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x7c, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xc3, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0948 "󰥈" */
-    0x0, 0x5, 0x55, 0x55, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x27, 0x8f, 0xff, 0xff,
-    0xd7, 0x60, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x60, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0xcb, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x5, 0xa0,
-    0xcb, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0xa9, 0xd7, 0xe2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0xa, 0xfe, 0x30, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x4, 0xfa, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x3e,
-    0xed, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x2, 0xe3, 0xc6, 0xf3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x2, 0x30, 0xcf, 0x50, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0xc4, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0949 "󰥉" */
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x1, 0x33, 0xbf, 0xff, 0xff, 0xff,
-    0xe3, 0x32, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xdf, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff,
-    0xf1, 0xdf, 0xff, 0xff, 0xff, 0x51, 0xdf, 0xff,
-    0xff, 0xf1, 0xdf, 0xff, 0xfd, 0xff, 0x50, 0x1c,
-    0xff, 0xff, 0xf1, 0xdf, 0xff, 0x61, 0xdf, 0x52,
-    0x30, 0xcf, 0xff, 0xf1, 0xdf, 0xff, 0xe2, 0x1d,
-    0x52, 0xe0, 0x2f, 0xff, 0xf1, 0xdf, 0xff, 0xfe,
-    0x31, 0x32, 0x31, 0xdf, 0xff, 0xf1, 0xdf, 0xff,
-    0xff, 0xe3, 0x0, 0x1d, 0xff, 0xff, 0xf1, 0xdf,
-    0xff, 0xff, 0xfd, 0x0, 0xaf, 0xff, 0xff, 0xf1,
-    0xdf, 0xff, 0xff, 0xe2, 0x0, 0xc, 0xff, 0xff,
-    0xf1, 0xdf, 0xff, 0xfd, 0x12, 0x32, 0x30, 0xcf,
-    0xff, 0xf1, 0xdf, 0xff, 0xd1, 0x2e, 0x52, 0xd0,
-    0x2f, 0xff, 0xf1, 0xdf, 0xff, 0x62, 0xef, 0x51,
-    0x21, 0xdf, 0xff, 0xf1, 0xdf, 0xff, 0xfe, 0xff,
-    0x50, 0x1d, 0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff,
-    0xff, 0x51, 0xdf, 0xff, 0xff, 0xf1, 0xdf, 0xff,
-    0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xf1, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x4e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F094A "󰥊" */
-    0x0, 0xb, 0xbb, 0xbb, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xaf, 0xff, 0xff,
-    0xe9, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xfd, 0x52, 0x39, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xd1, 0x0, 0x0, 0x5f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x4b, 0x91,
-    0xb, 0xf8, 0x0, 0x0, 0x91, 0x0, 0xff, 0x0,
-    0xef, 0xf8, 0x6, 0xf8, 0x0, 0x0, 0xcd, 0x10,
-    0xff, 0xcc, 0xff, 0xfa, 0x7, 0xf8, 0x6, 0xb0,
-    0xc9, 0xd1, 0xff, 0xff, 0xff, 0xf3, 0xb, 0xf8,
-    0x0, 0x9b, 0xd8, 0xd1, 0xff, 0xff, 0xff, 0x30,
-    0x7f, 0xf8, 0x0, 0x9, 0xfe, 0x10, 0xff, 0xff,
-    0xf6, 0x5, 0xff, 0xf8, 0x0, 0x5, 0xfb, 0x0,
-    0xff, 0xff, 0xf0, 0xe, 0xff, 0xf8, 0x0, 0x5d,
-    0xeb, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x4, 0xd2, 0xc7, 0xe2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x1, 0x20, 0xce, 0x30, 0xff, 0xff,
-    0xc0, 0x3f, 0xff, 0xf8, 0x0, 0x0, 0xb3, 0x0,
-    0xff, 0xff, 0xc0, 0x4f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7d, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xc2, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0A1E "󰨞" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x95,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xa, 0xb1, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xef, 0xff, 0xfd, 0xaf, 0xfe, 0x40, 0x9,
-    0xff, 0xff, 0xfc, 0x2f, 0xff, 0xfd, 0x8f, 0xff,
-    0xf8, 0xaf, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xfd,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x1f,
-    0xff, 0xfd, 0x0, 0x6f, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0x1f, 0xff, 0xfd, 0x0, 0x2e, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x1f, 0xff, 0xfd, 0x3, 0xef,
-    0xff, 0xff, 0xff, 0xb1, 0x0, 0x1f, 0xff, 0xfd,
-    0x4f, 0xff, 0xfc, 0xef, 0xff, 0xfe, 0x30, 0x1f,
-    0xff, 0xfd, 0xcf, 0xff, 0x90, 0x2d, 0xff, 0xff,
-    0xf7, 0x1f, 0xff, 0xfd, 0x3e, 0xf5, 0x0, 0x1,
-    0xdf, 0xff, 0xff, 0xcf, 0xff, 0xfd, 0x1, 0x10,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xfa, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xea, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+F0EB7 "󰺷" */
-    0x0, 0x1, 0x68, 0x99, 0x99, 0x99, 0x99, 0x85,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe4, 0x0, 0x9, 0xfb, 0x41, 0x0,
-    0x0, 0x0, 0x0, 0x15, 0xef, 0x50, 0x5f, 0xa0,
-    0x2, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1e, 0xf0,
-    0xbf, 0x10, 0x3f, 0x70, 0x0, 0x0, 0x0, 0xcf,
-    0x35, 0xf6, 0xeb, 0x6, 0x9f, 0xb7, 0x0, 0x0,
-    0x0, 0xef, 0x40, 0xf9, 0xfb, 0xd, 0xff, 0xff,
-    0x10, 0x1, 0x95, 0x13, 0x0, 0xfa, 0xde, 0x1,
-    0x4f, 0x82, 0x0, 0x7, 0xfe, 0x0, 0x3, 0xf7,
-    0x7f, 0x60, 0x2c, 0x50, 0x3, 0x22, 0xb6, 0x0,
-    0xb, 0xf2, 0xd, 0xf6, 0x0, 0x2, 0xcf, 0xf7,
-    0x0, 0x1, 0xaf, 0x80, 0x2, 0xdf, 0xec, 0xdf,
-    0xf7, 0xcf, 0xfc, 0xcf, 0xf9, 0x0, 0x0, 0x6,
-    0xbd, 0xc9, 0x20, 0x5, 0xbd, 0xca, 0x30, 0x0,
-
-    /* U+F0F2D "󰼭" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xee,
-    0xee, 0xee, 0xef, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xee, 0xee, 0xee, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x3,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1, 0x12,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x11, 0x10,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0xd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xa0, 0x0, 0x22, 0x22, 0x0,
-    0x0, 0x0, 0x0, 0x22, 0x21, 0x0, 0x4, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x5, 0xff, 0xff, 0x10,
-    0xb, 0xff, 0xff, 0xc3, 0x22, 0x22, 0x5e, 0xff,
-    0xff, 0x60, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xef, 0xfe,
-    0xef, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xf9,
-    0xff, 0xf1, 0x3f, 0xf0, 0x3f, 0xe0, 0x5f, 0xd0,
-    0x5f, 0xfb, 0xff, 0xf6, 0x8f, 0xf5, 0x8f, 0xf5,
-    0x9f, 0xf4, 0x9f, 0xfb, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x29, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x80,
-
-    /* U+F0F85 "󰾅" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0x40, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xe1, 0xe, 0x90, 0x5d, 0x60, 0x0, 0x0,
-    0x0, 0x3, 0xdf, 0xd0, 0x2f, 0xd0, 0x1f, 0xfb,
-    0x10, 0x0, 0x0, 0x3f, 0xfa, 0x20, 0x6f, 0xf1,
-    0x4, 0xdf, 0xd1, 0x0, 0x1, 0xff, 0x70, 0x0,
-    0xaf, 0xf5, 0x0, 0xb, 0xfd, 0x0, 0xb, 0xf8,
-    0x0, 0x0, 0xef, 0xfa, 0x0, 0x0, 0xdf, 0x70,
-    0x3f, 0xd0, 0x0, 0x3, 0xff, 0xfe, 0x0, 0x0,
-    0x3f, 0xe0, 0x8f, 0x60, 0x0, 0x7, 0xff, 0xff,
-    0x20, 0x0, 0xc, 0xf4, 0xcf, 0x20, 0x0, 0xb,
-    0xff, 0xff, 0x70, 0x0, 0x7, 0xf8, 0xef, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xb0, 0x0, 0x4, 0xfa,
-    0xff, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0,
-    0x4, 0xfa, 0xef, 0x10, 0x0, 0xd, 0xff, 0xff,
-    0x70, 0x0, 0x5, 0xf9, 0xbf, 0x40, 0x0, 0x2,
-    0xdf, 0xfa, 0x0, 0x0, 0x9, 0xf7, 0x6f, 0xa0,
-    0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0xe, 0xf2,
-    0x1f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xb0, 0x7, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x30, 0x0, 0xbf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf7, 0x0, 0x0, 0x7,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0x60, 0x0,
-
-    /* U+F0F86 "󰾆" */
-    0x0, 0x0, 0x0, 0x0, 0x12, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x9e, 0xff, 0xff,
-    0xc7, 0x0, 0x0, 0x0, 0x0, 0x10, 0x7, 0xef,
-    0xfd, 0xdf, 0xff, 0xe4, 0x0, 0x0, 0x0, 0xa6,
-    0x0, 0x12, 0x0, 0x0, 0x4b, 0xff, 0x80, 0x0,
-    0x0, 0x2f, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf6, 0x0, 0x0, 0x8, 0xff, 0xa1, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x30, 0x1b, 0x0, 0xef, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x7f, 0x40,
-    0x6f, 0xff, 0xfe, 0x50, 0x0, 0x0, 0xe, 0xf2,
-    0xbf, 0x40, 0xc, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x8, 0xf7, 0xef, 0x10, 0x3, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x5, 0xfa, 0xff, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xc0, 0x0, 0x4, 0xfb, 0xef, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xa0, 0x0, 0x5, 0xfa,
-    0xcf, 0x30, 0x0, 0x6, 0xff, 0xff, 0x20, 0x0,
-    0x7, 0xf8, 0x8f, 0x70, 0x0, 0x0, 0x48, 0x71,
-    0x0, 0x0, 0xc, 0xf4, 0x3f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0xb, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x60,
-    0x2, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfc, 0x0, 0x0, 0x4e, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xc1, 0x0,
-
-    /* U+F11F0 "󱇰" */
-    0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xb2, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x9, 0xff, 0xdc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xce, 0xff, 0x30, 0x9, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x40,
-    0x9, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x40, 0x9, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x40, 0x9, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x40, 0x9, 0xff,
-    0x35, 0xff, 0x70, 0xb, 0xff, 0x18, 0xff, 0x40,
-    0x9, 0xff, 0x36, 0xff, 0x70, 0xc, 0xff, 0x18,
-    0xff, 0x40, 0x9, 0xff, 0x35, 0xee, 0x60, 0xb,
-    0xee, 0x18, 0xff, 0x40, 0x9, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x40, 0x9, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x40,
-    0x9, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x40, 0x9, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x10, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x11, 0x11, 0x11, 0x11, 0x0,
-    0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 315, .box_w = 20, .box_h = 16, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 160, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 360, .adv_w = 315, .box_w = 21, .box_h = 25, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 623, .adv_w = 315, .box_w = 20, .box_h = 13, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 753, .adv_w = 315, .box_w = 20, .box_h = 24, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 993, .adv_w = 315, .box_w = 21, .box_h = 28, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 1287, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 1548, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 1809, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 2070, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 2331, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 2592, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 2853, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 3114, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 3375, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 3636, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 3897, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 4158, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 4419, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4619, .adv_w = 315, .box_w = 20, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4809, .adv_w = 315, .box_w = 20, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4999, .adv_w = 315, .box_w = 20, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5189, .adv_w = 315, .box_w = 20, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5379, .adv_w = 315, .box_w = 20, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5569, .adv_w = 315, .box_w = 20, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5759, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 6020, .adv_w = 315, .box_w = 20, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6210, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 6471, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 6732, .adv_w = 315, .box_w = 20, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6922, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 7183, .adv_w = 315, .box_w = 19, .box_h = 29, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 7459, .adv_w = 315, .box_w = 20, .box_h = 23, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7689, .adv_w = 315, .box_w = 20, .box_h = 23, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7919, .adv_w = 315, .box_w = 20, .box_h = 26, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 8179, .adv_w = 315, .box_w = 16, .box_h = 29, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 8411, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8611, .adv_w = 315, .box_w = 20, .box_h = 11, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 8721, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8921, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9121, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9321, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9521, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9721, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9921, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10121, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10321, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10521, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10721, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10921, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11121, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11321, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11521, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11721, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11921, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12121, .adv_w = 315, .box_w = 20, .box_h = 18, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 12301, .adv_w = 315, .box_w = 20, .box_h = 29, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 12591, .adv_w = 315, .box_w = 20, .box_h = 24, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 12831, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13031, .adv_w = 315, .box_w = 20, .box_h = 12, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 13151, .adv_w = 315, .box_w = 20, .box_h = 18, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 13331, .adv_w = 315, .box_w = 20, .box_h = 17, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 13501, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13701, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13901, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14101, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14301, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14501, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14701, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14901, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15101, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15301, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15501, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15701, .adv_w = 315, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 15962, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16162, .adv_w = 315, .box_w = 20, .box_h = 21, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 16372, .adv_w = 315, .box_w = 20, .box_h = 12, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 16492, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16692, .adv_w = 315, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16892, .adv_w = 315, .box_w = 20, .box_h = 18, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 17072, .adv_w = 315, .box_w = 20, .box_h = 29, .ofs_x = 0, .ofs_y = -5}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_0[] = {
-    0x0, 0xf23, 0xf25, 0x1030, 0x10ab, 0x12a0
-};
-
-static const uint16_t unicode_list_4[] = {
-    0x0, 0x8e, 0x16d, 0x16e, 0x16f, 0x170, 0x171, 0x479,
-    0x47a, 0x47b, 0x47c, 0x47d, 0x47e, 0x47f, 0x480, 0x481,
-    0x482, 0x483, 0x484, 0x485, 0x559, 0x9f2, 0xa68, 0xac0,
-    0xac1, 0xd2b
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 57943, .range_length = 4769, .glyph_id_start = 1,
-        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 6, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 983161, .range_length = 25, .glyph_id_start = 7,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 983215, .range_length = 6, .glyph_id_start = 32,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 983968, .range_length = 18, .glyph_id_start = 38,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 984261, .range_length = 3372, .glyph_id_start = 56,
-        .unicode_list = unicode_list_4, .glyph_id_ofs_list = NULL, .list_length = 26, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 5,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-extern const lv_font_t lv_font_montserrat_32;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t nerd_32 = {
-#else
-lv_font_t nerd_32 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 29,          /*The maximum line height required by the font*/
-    .base_line = 5,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_32,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if NERD_32*/
@@ -1,3813 +0,0 @@
-/*******************************************************************************
- * Size: 40 px
- * Bpp: 4
- * Opts: --bpp 4 --size 40 --no-compress --stride 1 --align 1 --font FiraCodeNerdFontMono-Regular.ttf --range 983215,983216-983220,985406-985418,62087,984403,987632,62711,983968-983985,57943,987014,987014,987013,984261,986807,986925,985630,61818,61820,62210,984627,984626,984628,984629,984630,983161-983185 --format lvgl -o nerd_40.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef NERD_40
-#define NERD_40 1
-#endif
-
-#if NERD_40
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+E257 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xc7, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xcf, 0xff, 0xff, 0x93, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x8e, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8,
-    0x10, 0x0, 0x6, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe4, 0x1, 0x8e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0,
-    0x0, 0x5, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x93, 0x0, 0x0, 0x1, 0x10, 0x0, 0x3a,
-    0xff, 0xff, 0xff, 0xff, 0xe7, 0x10, 0x0, 0x20,
-    0x9, 0xff, 0x93, 0x0, 0x1, 0x7d, 0xff, 0xfb,
-    0x40, 0x0, 0x5, 0xcf, 0xe4, 0x7, 0xdf, 0xfc,
-    0x50, 0x0, 0x4, 0x72, 0x0, 0x1, 0x8e, 0xff,
-    0xb4, 0x0, 0x0, 0x4b, 0xff, 0xe8, 0x10, 0x0,
-    0x0, 0x4a, 0xff, 0xe8, 0x20, 0x0, 0x0, 0x0,
-    0x2, 0x8e, 0xff, 0xb6, 0x57, 0xdf, 0xfc, 0x60,
-    0x0, 0x0, 0x4, 0xba, 0x40, 0x0, 0x6, 0xdf,
-    0xff, 0xff, 0xa3, 0x0, 0x0, 0x6c, 0x81, 0x6c,
-    0xff, 0xd6, 0x0, 0x0, 0x3a, 0xd7, 0x10, 0x0,
-    0x29, 0xff, 0xfa, 0x20, 0x3, 0xaf, 0xff, 0x92,
-    0x0, 0x0, 0x0, 0x5, 0xcf, 0xfe, 0x71, 0x0,
-    0x0, 0x0, 0x17, 0xef, 0xfc, 0x51, 0x2, 0x8e,
-    0xff, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5b, 0xff, 0xff, 0xff, 0xf9, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9f, 0xfd,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+F17A "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x57, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x13, 0x58, 0xac, 0xef, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x13, 0x68, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x68, 0xbd,
-    0xff, 0xff, 0xf1, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x1, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x9, 0x99, 0x99, 0x99, 0x99, 0x90,
-    0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xdf,
-    0xff, 0xff, 0xff, 0xf1, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x2, 0x46, 0x8a, 0xdf,
-    0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x7a, 0xce,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x25, 0x79, 0xbd,
-    0x70,
-
-    /* U+F17C "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3c, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x5a, 0xf7,
-    0x8, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0x53, 0xf2, 0xd2, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0x87, 0x57, 0xe3, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0x50, 0x0, 0x17,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0x30, 0x0, 0x24, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x53,
-    0x22, 0x32, 0xdf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x2, 0x33, 0x0, 0x8f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfb, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe0, 0x0, 0x0, 0x0, 0x4, 0xed,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xcc, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xb, 0xcf, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x2f,
-    0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xaf,
-    0xf1, 0x0, 0x0, 0x0, 0x6f, 0xa6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0x8f, 0xf4, 0x0, 0x0,
-    0x0, 0xaf, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0x5d, 0xf6, 0x0, 0x0, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfc, 0xc5,
-    0x0, 0x0, 0x1, 0x63, 0xc7, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x7f, 0xff, 0xc4, 0x0, 0x0, 0x36,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x6, 0x9,
-    0xb4, 0x6, 0x0, 0x5, 0x20, 0x0, 0x8, 0xfb,
-    0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x1, 0x40,
-    0x4, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0,
-    0x6, 0x0, 0x0, 0x0, 0x70, 0x4, 0x0, 0x0,
-    0x0, 0x4a, 0x0, 0x0, 0x0, 0x6, 0x0, 0x0,
-    0x0, 0x15, 0x4, 0x0, 0x0, 0x0, 0x6, 0x20,
-    0x0, 0x1, 0x92, 0x0, 0x0, 0x0, 0x43, 0x4,
-    0x0, 0x0, 0x0, 0x0, 0xeb, 0x87, 0xaf, 0xe0,
-    0x0, 0x0, 0x37, 0x20, 0x4, 0x66, 0x30, 0x0,
-    0x0, 0xed, 0xb9, 0xbc, 0xc0, 0x0, 0x5, 0x40,
-    0x0, 0x0, 0x0, 0x26, 0x63, 0x38, 0x20, 0x0,
-    0x0, 0x34, 0x0, 0x63, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x30, 0x0, 0x0, 0x0, 0x3, 0x66,
-    0x10, 0x0, 0x0,
-
-    /* U+F287 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xc7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x7b, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xf7, 0x3, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xad, 0x0,
-    0x1, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xe6, 0x0, 0x2f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x50, 0x0, 0xaf, 0xff, 0xf2, 0xb, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc2, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0xdf, 0xff, 0xf8, 0x66,
-    0x67, 0xfb, 0x66, 0x66, 0x66, 0x66, 0xaf, 0xf8,
-    0x3, 0xff, 0xfb, 0x0, 0x0, 0x9, 0xe0, 0x0,
-    0x0, 0x0, 0x7, 0xb2, 0x0, 0x1, 0x53, 0x0,
-    0x0, 0x0, 0x1f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae,
-    0x0, 0xdf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xec, 0x9f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xbc, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x22, 0x22, 0x0, 0x0, 0x0,
-
-    /* U+F302 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6c, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xdf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xae, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x8c, 0xdc, 0x72, 0x0, 0x3, 0x8c,
-    0xee, 0xc7, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xfd, 0xad, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xfe, 0x94, 0x22, 0x5b, 0xff, 0xfd,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x43, 0x0,
-    0x0, 0x0, 0x0, 0x32, 0x0, 0x0, 0x0,
-
-    /* U+F4F7 "" */
-    0x0, 0x2, 0x96, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x96,
-    0xcf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x0, 0x0, 0xcf, 0xf6, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xc, 0xff,
-    0x60, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xcf, 0xf6, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x4c, 0xdf,
-    0xff, 0xed, 0xa1, 0x0, 0x0, 0x12, 0x22, 0x6f,
-    0xff, 0xf5, 0xe, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf5, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf5, 0x0, 0x0, 0x55, 0x55, 0x55, 0x53,
-    0x0, 0x0, 0x0, 0x3e, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xbc, 0xef, 0xff, 0xff, 0x10, 0x0, 0x1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0xff, 0xf6, 0x0, 0x7d, 0xff, 0xd5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x80, 0xbf,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf8, 0x8f, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x8, 0xea, 0x30, 0x1, 0x8f, 0xff, 0x5e,
-    0xff, 0xb3, 0x3e, 0xff, 0x70, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0xbf, 0xd1, 0x0, 0x9f,
-    0xf9, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xe3,
-    0x0, 0x41, 0x0, 0xc, 0xff, 0x80, 0x0, 0x6,
-    0xcf, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x13, 0x42, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xfb, 0x44, 0x44,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6e, 0xff, 0xff, 0xff, 0xe8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0079 "󰁹" */
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x68, 0x88, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd8, 0x88, 0x40, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x10,
-
-    /* U+F007A "󰁺" */
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x1, 0x78, 0x89, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc8, 0x87, 0x20, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0xfe, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x0,
-
-    /* U+F007B "󰁻" */
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x1, 0x78, 0x89, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc8, 0x87, 0x20, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x0,
-
-    /* U+F007C "󰁼" */
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x1, 0x78, 0x89, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc8, 0x87, 0x20, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x0,
-
-    /* U+F007D "󰁽" */
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x1, 0x78, 0x89, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc8, 0x87, 0x20, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x0,
-
-    /* U+F007E "󰁾" */
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x1, 0x78, 0x89, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc8, 0x87, 0x20, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0xdc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x0,
-
-    /* U+F007F "󰁿" */
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x1, 0x78, 0x89, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc8, 0x87, 0x20, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x98, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x0,
-
-    /* U+F0080 "󰂀" */
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x1, 0x78, 0x89, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc8, 0x87, 0x20, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x0,
-
-    /* U+F0081 "󰂁" */
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x1, 0x78, 0x89, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc8, 0x87, 0x20, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x0,
-
-    /* U+F0082 "󰂂" */
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x1, 0x78, 0x89, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc8, 0x87, 0x20, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x0,
-
-    /* U+F0083 "󰂃" */
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x58, 0x88, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xe8, 0x88, 0x50, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff,
-    0xff, 0xff, 0xfe, 0x99, 0x9e, 0xff, 0xff, 0xff,
-    0xfe, 0x1f, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0xc, 0xff, 0xff, 0xff, 0xfe, 0x1f,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0xc, 0xff, 0xff, 0xff, 0xfe,
-    0x1f, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xfe, 0x1f, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0xc, 0xff, 0xff, 0xff, 0xfe, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x1f, 0xff, 0xff, 0xff, 0xfd, 0x88, 0x8e, 0xff,
-    0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xfe, 0x1f, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xee, 0xef, 0xff, 0xff, 0xff, 0xfe, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x4, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd2, 0x0, 0x1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x0,
-
-    /* U+F0084 "󰂄" */
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x5, 0x88, 0x8e, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x88, 0x85, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xcf, 0xff,
-    0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x5c, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0xcf, 0xff, 0xff,
-    0xff, 0xf1, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xf1, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x30, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xf1,
-    0x1f, 0xff, 0xff, 0xff, 0xf2, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xf1, 0x1f,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x7, 0x88, 0xbf,
-    0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf1, 0x1f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x11, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0x11, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0x11,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x1f, 0xff, 0xff, 0xff, 0xfb, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff,
-    0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x1f, 0xff, 0xff, 0xff, 0xfb, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x1, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x41, 0x0,
-
-    /* U+F0085 "󰂅" */
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4a, 0xbd, 0xff, 0xff, 0xff, 0xdb, 0xa4,
-    0x0, 0x0, 0x0, 0x10, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x8,
-    0x10, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x1, 0xf1, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0xe, 0xf1, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x7, 0xff, 0x10, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0xef, 0xf1, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x7f, 0xff, 0x10, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0xe, 0xff, 0xf8,
-    0x77, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x7, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xef, 0xff,
-    0xff, 0xfb, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x7f, 0xff, 0xff, 0xff, 0x40, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x11,
-    0x5f, 0xff, 0xc0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x4, 0xff, 0xf5, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x4f, 0xfd, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x4, 0xff, 0x60,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x4f, 0xe0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x4, 0xf8,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x4f, 0x10, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x4,
-    0x90, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x42, 0x0, 0x0, 0x1,
-    0x56, 0x66, 0x66, 0x66, 0x66, 0x65, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0086 "󰂆" */
-    0x0, 0x0, 0x33, 0x33, 0x33, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xee, 0xff,
-    0xff, 0xff, 0xff, 0xee, 0x90, 0x0, 0x0, 0x2,
-    0x10, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x91, 0x0, 0xf, 0xfa,
-    0x77, 0x77, 0x77, 0x77, 0x8f, 0xf3, 0x0, 0x0,
-    0x1f, 0x10, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x30, 0x0, 0x9, 0xf1, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0,
-    0x1, 0xff, 0x10, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x30, 0x0, 0x8f, 0xf1, 0x0,
-    0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x0, 0x1f, 0xff, 0x10, 0x0, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x30, 0x8, 0xff, 0xf1,
-    0x0, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf3, 0x1, 0xff, 0xff, 0xba, 0xa4, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x8f, 0xff,
-    0xff, 0xff, 0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf3, 0xe, 0xff, 0xff, 0xff, 0x90, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x1, 0xff, 0x36, 0xdd,
-    0xef, 0xff, 0xf2, 0xf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x0, 0x3, 0xff, 0xfb, 0x0,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30,
-    0x0, 0x3f, 0xff, 0x40, 0xf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf3, 0x0, 0x3, 0xff, 0xd0,
-    0x0, 0xff, 0xca, 0xaa, 0xaa, 0xaa, 0xab, 0xff,
-    0x30, 0x0, 0x3f, 0xf5, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x3f, 0x70, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x3,
-    0xf0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x38, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x2, 0x10, 0x0, 0x0, 0x2, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F0087 "󰂇" */
-    0x0, 0x0, 0x33, 0x33, 0x33, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xee, 0xff,
-    0xff, 0xff, 0xff, 0xee, 0x90, 0x0, 0x0, 0x2,
-    0x10, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x91, 0x0, 0xf, 0xf9,
-    0x77, 0x77, 0x77, 0x77, 0x8f, 0xf3, 0x0, 0x0,
-    0x1f, 0x10, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x30, 0x0, 0x9, 0xf1, 0x0, 0xf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0,
-    0x1, 0xff, 0x10, 0x0, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x30, 0x0, 0x8f, 0xf1, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x0, 0x1f, 0xff, 0x10, 0x0, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x30, 0x8, 0xff, 0xf1,
-    0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf3, 0x1, 0xff, 0xff, 0xba, 0xa4, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x7f, 0xff,
-    0xff, 0xff, 0x1f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf3, 0xe, 0xff, 0xff, 0xff, 0xa0, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x1, 0xff, 0x36, 0xee,
-    0xef, 0xff, 0xf2, 0xf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf3, 0x0, 0x3, 0xff, 0xfb, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x3f, 0xff, 0x40, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x3, 0xff, 0xd0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x3f, 0xf5, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x3f, 0x70, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x3,
-    0xf0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x38, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x3, 0x10, 0x0, 0x0, 0x3, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F0088 "󰂈" */
-    0x0, 0x0, 0x33, 0x33, 0x33, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xee, 0xff,
-    0xff, 0xff, 0xff, 0xee, 0xc0, 0x0, 0x0, 0x2,
-    0x10, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x91, 0x0, 0xf, 0xf9,
-    0x77, 0x77, 0x77, 0x77, 0x8f, 0xf3, 0x0, 0x0,
-    0x1f, 0x10, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x30, 0x0, 0x9, 0xf1, 0x0, 0xf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0,
-    0x1, 0xff, 0x10, 0x0, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x30, 0x0, 0x8f, 0xf1, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x0, 0x1f, 0xff, 0x10, 0x0, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x30, 0x8, 0xff, 0xf1,
-    0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf3, 0x1, 0xff, 0xff, 0xba, 0xa4, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x30, 0x8f, 0xff,
-    0xff, 0xff, 0x1f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf3, 0xe, 0xff, 0xff, 0xff, 0x90, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x1, 0xff, 0x36, 0xdd,
-    0xef, 0xff, 0xf2, 0xf, 0xfb, 0x99, 0x99, 0x99,
-    0x99, 0xaf, 0xf3, 0x0, 0x3, 0xff, 0xfb, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x3f, 0xff, 0x40, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x3f, 0xf5, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x3f, 0x70, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x3,
-    0xf0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x38, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x3, 0x10, 0x0, 0x0, 0x2, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F0089 "󰂉" */
-    0x0, 0x0, 0x33, 0x33, 0x33, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xee, 0xff,
-    0xff, 0xff, 0xff, 0xee, 0x90, 0x0, 0x0, 0x2,
-    0x10, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x91, 0x0, 0xf, 0xf9,
-    0x77, 0x77, 0x77, 0x77, 0x8f, 0xf3, 0x0, 0x0,
-    0x1f, 0x10, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x30, 0x0, 0x9, 0xf1, 0x0, 0xf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0,
-    0x1, 0xff, 0x10, 0x0, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x30, 0x0, 0x8f, 0xf1, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x0, 0x1f, 0xff, 0x10, 0x0, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x30, 0x8, 0xff, 0xf1,
-    0x0, 0xf, 0xfc, 0xaa, 0xaa, 0xaa, 0xaa, 0xbf,
-    0xf3, 0x1, 0xff, 0xff, 0xba, 0xa4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x8f, 0xff,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xe, 0xff, 0xff, 0xff, 0x90, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0xdd,
-    0xef, 0xff, 0xf2, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x3, 0xff, 0xfb, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x3f, 0xff, 0x40, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x3, 0xff, 0xc0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x3f, 0xf5, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x3f, 0x70, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x3,
-    0xf0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x38, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x3, 0x10, 0x0, 0x0, 0x2, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F008A "󰂊" */
-    0x0, 0x0, 0x33, 0x33, 0x33, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xee, 0xff,
-    0xff, 0xff, 0xff, 0xee, 0x90, 0x0, 0x0, 0x2,
-    0x10, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x91, 0x0, 0xf, 0xf9,
-    0x77, 0x77, 0x77, 0x77, 0x8f, 0xf3, 0x0, 0x0,
-    0x1f, 0x10, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x30, 0x0, 0x9, 0xf1, 0x0, 0xf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0,
-    0x1, 0xff, 0x10, 0x0, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x30, 0x0, 0x8f, 0xf1, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x1f, 0xff, 0x10, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x8, 0xff, 0xf1,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0xef, 0xff, 0x99, 0x94, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x7f, 0xff,
-    0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xe, 0xff, 0xff, 0xff, 0xa0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0xff,
-    0xff, 0xff, 0xf3, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x3, 0xff, 0xfc, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x3f, 0xff, 0x40, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x3, 0xff, 0xd0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x3f, 0xf6, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x3, 0xfe,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x3f, 0x70, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x3,
-    0xf1, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x39, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x3, 0x20, 0x0, 0x0, 0x3, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F008B "󰂋" */
-    0x0, 0x0, 0x33, 0x33, 0x33, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xee, 0xff,
-    0xff, 0xff, 0xff, 0xee, 0x90, 0x0, 0x0, 0x2,
-    0x10, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x91, 0x0, 0xf, 0xf9,
-    0x77, 0x77, 0x77, 0x77, 0x8f, 0xf3, 0x0, 0x0,
-    0x1f, 0x10, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x30, 0x0, 0x8, 0xf1, 0x0, 0xf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0,
-    0x1, 0xff, 0x10, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x8f, 0xf1, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0xe, 0xff, 0x10, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x7, 0xff, 0xf1,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0xef, 0xff, 0x87, 0x73, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x6f, 0xff,
-    0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xe, 0xff, 0xff, 0xff, 0xb0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0xff,
-    0xff, 0xff, 0xf4, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x1, 0x14, 0xff, 0xfc, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x3f, 0xff, 0x50, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x3, 0xff, 0xe0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x3f, 0xf7, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x3f, 0x80, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x3,
-    0xf1, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x3a, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0,
-    0x3, 0x20, 0x0, 0x0, 0x15, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F008C "󰂌" */
-    0x0, 0x0, 0x0, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x24, 0x45, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa4, 0x43, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xff, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x2, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x21, 0x0,
-
-    /* U+F008D "󰂍" */
-    0x0, 0x4, 0x77, 0x77, 0x77, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x4b, 0xff, 0xff, 0xff, 0x44, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x40, 0x3, 0x33, 0x33, 0x33, 0x32, 0xff, 0x51,
-    0x11, 0x11, 0x11, 0x1e, 0xf4, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x1f, 0xff, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F008E "󰂎" */
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x1, 0x78, 0x89, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc8, 0x87, 0x20, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x42,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xef, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x0,
-
-    /* U+F008F "󰂏" */
-    0x0, 0x0, 0x0, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x24, 0x45, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa4, 0x43, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xfb, 0x99, 0xaf, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xee, 0xee, 0xe5,
-    0x0, 0x3e, 0xee, 0xee, 0xff, 0xfa, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfa, 0x7f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xfc, 0xbb, 0xcf, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0x0,
-
-    /* U+F0090 "󰂐" */
-    0x0, 0x4, 0x77, 0x77, 0x77, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x4b, 0xff, 0xff, 0xff, 0x44, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x7, 0xa4, 0x0,
-    0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0xcf, 0x70, 0x0, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0xc, 0xf7,
-    0x0, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x40, 0x3, 0x33, 0xdf, 0x93, 0x32, 0xff, 0x51,
-    0x11, 0x11, 0x11, 0x1e, 0xf4, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x1f, 0xff, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xc, 0xf7, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xcf, 0x70, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0xc, 0xf7, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x46, 0x20,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0091 "󰂑" */
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x1, 0x67, 0x78, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb7, 0x77, 0x20, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0x94, 0x11, 0x38, 0xef, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfa, 0x7f, 0xff,
-    0xf2, 0x0, 0x0, 0x45, 0x10, 0x0, 0xe, 0xff,
-    0xfa, 0x7f, 0xff, 0x90, 0x0, 0x3e, 0xff, 0xf6,
-    0x0, 0x7, 0xff, 0xfa, 0x7f, 0xff, 0x40, 0x0,
-    0xef, 0xff, 0xff, 0x40, 0x2, 0xff, 0xfa, 0x7f,
-    0xff, 0x20, 0x5, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0xff, 0xfa, 0x7f, 0xff, 0xed, 0xde, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x1, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x7, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x2e, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xdf, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
-    0x1d, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0xcf, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff,
-    0xff, 0xff, 0xfb, 0x88, 0xaf, 0xff, 0xff, 0xff,
-    0xfa, 0x7f, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xfa, 0x7f,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x0,
-
-    /* U+F00AF "󰂯" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x9, 0xfb, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xd1, 0x0,
-    0x8, 0xff, 0xfb, 0x0, 0x0, 0x5, 0xff, 0xf5,
-    0xef, 0xff, 0xd1, 0x0, 0x3f, 0xff, 0xfb, 0x0,
-    0x0, 0x5f, 0xff, 0x22, 0xef, 0xff, 0xd1, 0x0,
-    0x3f, 0xff, 0xfc, 0x0, 0x5, 0xff, 0xf2, 0x2,
-    0xef, 0xff, 0xd1, 0x0, 0x4f, 0xff, 0xfc, 0x0,
-    0x5f, 0xff, 0x20, 0x1e, 0xff, 0xfe, 0x20, 0x0,
-    0x4f, 0xff, 0xfc, 0x5, 0xff, 0xf2, 0x1d, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0x4f, 0xff, 0xfc, 0x6f,
-    0xff, 0x4d, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0xfe, 0x7f, 0xff, 0x6f, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xfe, 0x25, 0xff, 0xf2,
-    0x4f, 0xff, 0xfb, 0x0, 0x0, 0x1c, 0xff, 0xfe,
-    0x20, 0x5f, 0xff, 0x20, 0x4f, 0xff, 0xfb, 0x0,
-    0x1c, 0xff, 0xfe, 0x20, 0x5, 0xff, 0xf2, 0x0,
-    0xcf, 0xff, 0xf3, 0x1c, 0xff, 0xfe, 0x20, 0x0,
-    0x5f, 0xff, 0x20, 0xbf, 0xff, 0xf4, 0xa, 0xff,
-    0xfe, 0x20, 0x0, 0x5, 0xff, 0xf3, 0xbf, 0xff,
-    0xf4, 0x0, 0x1d, 0xfe, 0x20, 0x0, 0x0, 0x5f,
-    0xff, 0xdf, 0xff, 0xf4, 0x0, 0x0, 0x1b, 0x20,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x42, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F00B0 "󰂰" */
-    0x0, 0x0, 0x0, 0x0, 0xcd, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0x40, 0x0, 0x0, 0xcf, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x40, 0x0, 0xc, 0xff, 0xbf, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x50, 0x0, 0xcf,
-    0xf0, 0xbf, 0xfe, 0x20, 0x0, 0x0, 0x30, 0x0,
-    0x9f, 0xff, 0x50, 0xc, 0xff, 0x0, 0xcf, 0xfe,
-    0x10, 0x0, 0x6f, 0x20, 0x0, 0x9f, 0xff, 0x50,
-    0xcf, 0xf0, 0x3f, 0xff, 0xa0, 0x0, 0xe, 0xf9,
-    0x0, 0x0, 0x9f, 0xff, 0x5c, 0xff, 0x3f, 0xff,
-    0xa0, 0x0, 0x0, 0x8f, 0xf0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x20, 0x3,
-    0xff, 0x30, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x7c, 0x0, 0xf, 0xf6, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xa0, 0x0, 0x7f, 0xf0,
-    0x0, 0xdf, 0x80, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xb0, 0x0, 0x5f, 0xff, 0x10, 0xc, 0xf9, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x40, 0x0, 0xcf,
-    0xf0, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0xce, 0x0, 0xe, 0xf7,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x1, 0x60, 0x2, 0xff, 0x40, 0x0, 0x3f, 0xff,
-    0x9d, 0xff, 0x7f, 0xff, 0x40, 0x0, 0x0, 0x6f,
-    0xf0, 0x0, 0x3f, 0xff, 0x90, 0xcf, 0xf0, 0x8f,
-    0xff, 0x50, 0x0, 0xd, 0xfa, 0x0, 0x3f, 0xff,
-    0x90, 0xc, 0xff, 0x0, 0xbf, 0xff, 0x20, 0x0,
-    0xbf, 0x30, 0x3f, 0xff, 0xa0, 0x0, 0xcf, 0xf0,
-    0x6f, 0xff, 0x60, 0x0, 0x0, 0x70, 0xb, 0xff,
-    0xa0, 0x0, 0xc, 0xff, 0x6f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xa0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F00B1 "󰂱" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x92, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xe2, 0x0, 0x0, 0xff, 0xce, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xe2, 0x0,
-    0xf, 0xfa, 0x2e, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xe2, 0x0, 0xff, 0xa0, 0x2f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xe2, 0xf, 0xfa, 0x8, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xe3, 0xff, 0xa8,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x50, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0xb6, 0x0, 0xc, 0xff,
-    0x40, 0x0, 0xc, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0xaf, 0xf6, 0xb, 0xff, 0xff, 0x30, 0x0, 0xd,
-    0xff, 0xf8, 0x0, 0x0, 0x8f, 0xff, 0xf5, 0x3f,
-    0xff, 0xa0, 0x0, 0x6, 0xff, 0xff, 0xe2, 0x0,
-    0x2, 0xef, 0xfc, 0x0, 0x3f, 0xa0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0x2, 0xec, 0x0,
-    0x0, 0x30, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf7, 0xff, 0xbc, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf6, 0xf, 0xfa,
-    0xc, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf6, 0x0, 0xff, 0xa0, 0x1f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf6, 0x0, 0xf,
-    0xfa, 0xb, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xf6, 0x0, 0x0, 0xff, 0xab, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xe6, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x52,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F00B2 "󰂲" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xf6, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf6, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xf6, 0x0, 0x0,
-    0x1f, 0xff, 0xbf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xf6, 0x0, 0x1, 0xff, 0xe0, 0xbf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xf6,
-    0x0, 0xa, 0xfe, 0x0, 0xbf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xf6, 0x0, 0xa, 0xe0,
-    0xa, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0xf6, 0x0, 0x9, 0x9, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xf6, 0x0,
-    0x6, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xff, 0xf6, 0x0, 0xb, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xf6, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfb, 0x2f,
-    0xfe, 0x1d, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xfb, 0x1, 0xff, 0xe0, 0x1d, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfb, 0x0,
-    0x1f, 0xfe, 0x0, 0x7f, 0xff, 0xf6, 0x0, 0x0,
-    0x8, 0xff, 0xfb, 0x0, 0x1, 0xff, 0xe0, 0x6f,
-    0xff, 0xff, 0xf6, 0x0, 0x1, 0xef, 0xfb, 0x0,
-    0x0, 0x1f, 0xfe, 0x6f, 0xff, 0xdd, 0xff, 0xf6,
-    0x0, 0x2, 0xeb, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xd1, 0x1d, 0xff, 0xf5, 0x0, 0x2, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xd1, 0x0, 0x1d,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xd1, 0x0, 0x0, 0x1b, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F00B3 "󰂳" */
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1, 0x30,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x1,
-    0xdf, 0x30, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0xbf, 0xff, 0x30, 0x0, 0x1f, 0xfd, 0x5f,
-    0xff, 0xc1, 0x1, 0xdf, 0xff, 0x30, 0x1, 0xff,
-    0xd0, 0x4f, 0xff, 0xc1, 0x1, 0xdf, 0xff, 0x30,
-    0x1f, 0xfd, 0x0, 0x8f, 0xff, 0x80, 0x1, 0xdf,
-    0xff, 0x31, 0xff, 0xd0, 0x6f, 0xff, 0xb0, 0x0,
-    0x1, 0xdf, 0xff, 0x5f, 0xfd, 0x7f, 0xff, 0xa0,
-    0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xbf,
-    0xfe, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x7f, 0xff,
-    0xa1, 0xff, 0xd1, 0xdf, 0xff, 0x50, 0x0, 0x7f,
-    0xff, 0xa0, 0x1f, 0xfd, 0x1, 0xdf, 0xff, 0x50,
-    0x7f, 0xff, 0xa0, 0x1, 0xff, 0xd0, 0x1d, 0xff,
-    0xf6, 0x7f, 0xff, 0xa0, 0x0, 0x1f, 0xfd, 0x1c,
-    0xff, 0xf6, 0x6, 0xff, 0xa0, 0x0, 0x1, 0xff,
-    0xec, 0xff, 0xf6, 0x0, 0x6, 0xa0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x64, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xdc, 0x0, 0x1d, 0xdb, 0x0, 0x1d,
-    0xdc, 0x0, 0x1, 0xff, 0xe0, 0x1, 0xff, 0xd0,
-    0x1, 0xff, 0xd0, 0x0, 0x1f, 0xfe, 0x0, 0x1f,
-    0xfd, 0x0, 0x1f, 0xfd, 0x0, 0x0, 0x11, 0x10,
-    0x0, 0x11, 0x10, 0x0, 0x11, 0x10,
-
-    /* U+F00B4 "󰂴" */
-    0x0, 0x0, 0x0, 0x5, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x8,
-    0x80, 0x0, 0x8, 0x40, 0x0, 0x8, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x4, 0xff, 0x40, 0x8, 0xff,
-    0x40, 0x0, 0x8f, 0xea, 0xff, 0xc0, 0x0, 0x1,
-    0xef, 0xfe, 0x10, 0x4f, 0xff, 0x40, 0x8, 0xfe,
-    0xa, 0xff, 0xc1, 0x0, 0xbf, 0xff, 0xfb, 0x0,
-    0x4f, 0xff, 0x40, 0x8f, 0xe0, 0x1f, 0xff, 0x70,
-    0x4c, 0xdf, 0xfd, 0xc5, 0x0, 0x4f, 0xff, 0x48,
-    0xfe, 0xc, 0xff, 0xa0, 0x0, 0x3, 0xff, 0x40,
-    0x0, 0x0, 0x4f, 0xff, 0xbf, 0xfc, 0xff, 0xa0,
-    0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x3, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x17, 0x72, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x3, 0xff, 0x40, 0x0, 0x0, 0xc, 0xff, 0xef,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x3f, 0xf4, 0x0,
-    0x0, 0xc, 0xff, 0x98, 0xfe, 0x4f, 0xff, 0x40,
-    0x0, 0x3, 0xff, 0x40, 0x0, 0xc, 0xff, 0xa0,
-    0x8f, 0xe0, 0x4f, 0xff, 0x40, 0x36, 0x8f, 0xf9,
-    0x63, 0xc, 0xff, 0xa0, 0x8, 0xfe, 0x4, 0xff,
-    0xf4, 0x1, 0xef, 0xff, 0xfe, 0x1a, 0xff, 0xa0,
-    0x0, 0x8f, 0xe4, 0xff, 0xf4, 0x0, 0x4, 0xff,
-    0xff, 0x40, 0x1d, 0xa0, 0x0, 0x8, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x8, 0xff, 0x80, 0x0, 0x10,
-    0x0, 0x0, 0x8f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0xc, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x21, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F03A0 "󰎠" */
-    0x88, 0x88, 0x70, 0x4, 0x88, 0x88, 0x73, 0x0,
-    0x6, 0x88, 0x88, 0x61, 0xf, 0xff, 0xfe, 0x0,
-    0x8f, 0xff, 0xff, 0xf5, 0x0, 0xdf, 0xff, 0xff,
-    0xd1, 0xff, 0xff, 0xe0, 0x8, 0xff, 0xff, 0xff,
-    0xd0, 0xd, 0xff, 0xff, 0xff, 0x60, 0x9, 0xfe,
-    0x0, 0x0, 0x0, 0x9, 0xfe, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x9f, 0xe0, 0x0, 0x0, 0x0,
-    0x9f, 0xe0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x9,
-    0xfe, 0x0, 0x1, 0x68, 0x8c, 0xfe, 0x0, 0x0,
-    0x38, 0x8f, 0xf5, 0x0, 0x9f, 0xe0, 0x1, 0xef,
-    0xff, 0xff, 0xa0, 0x0, 0x6, 0xff, 0xf8, 0x0,
-    0x9, 0xfe, 0x0, 0x6f, 0xfe, 0xee, 0xa1, 0x0,
-    0x0, 0x5e, 0xef, 0xf2, 0x0, 0x9f, 0xe0, 0x8,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x70, 0x9, 0xfe, 0x0, 0x8f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf8, 0x0, 0x9f, 0xe0,
-    0x8, 0xff, 0x88, 0x88, 0x80, 0x7, 0x88, 0x88,
-    0xff, 0x70, 0x9, 0xfe, 0x0, 0x8f, 0xff, 0xff,
-    0xfe, 0x0, 0xdf, 0xff, 0xff, 0xf3, 0x0, 0x8f,
-    0xe0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0xd, 0xff,
-    0xff, 0xd6, 0x0,
-
-    /* U+F03A1 "󰎡" */
-    0x2, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x61, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x3, 0x32, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xdf, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xff, 0xa0,
-    0x6, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0xf, 0xfa, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xff,
-    0xa0, 0x6, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0xf, 0xfa, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0xff, 0xa0, 0x6, 0xff, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0xf, 0xfa, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0xff, 0xa0, 0x6, 0xff, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0xf, 0xf9, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xe8, 0x77, 0x79, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x1a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8,
-    0x0,
-
-    /* U+F03A2 "󰎢" */
-    0x0, 0x0, 0x0, 0x56, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x50, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x3f, 0xfd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0x50, 0x0, 0x4,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf6, 0x22, 0x0, 0x4f, 0xe0, 0x0, 0x0,
-    0x1, 0x21, 0x0, 0x0, 0x0, 0xdf, 0x6f, 0xf4,
-    0x4, 0xfe, 0x0, 0x0, 0x3e, 0xff, 0xfe, 0x30,
-    0x0, 0xd, 0xf6, 0xff, 0x40, 0x4f, 0xe0, 0x0,
-    0xc, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xdf, 0x6f,
-    0xf4, 0x4, 0xfe, 0x0, 0x0, 0xef, 0x51, 0x6f,
-    0xe0, 0x0, 0xd, 0xf6, 0xff, 0x40, 0x4f, 0xe0,
-    0x0, 0xe, 0xf4, 0x5, 0xfe, 0x0, 0x0, 0xdf,
-    0x6f, 0xf4, 0x4, 0xfe, 0x0, 0x0, 0xef, 0x40,
-    0x5f, 0xe0, 0x0, 0xd, 0xf6, 0xff, 0x40, 0x4f,
-    0xe0, 0x0, 0xe, 0xf4, 0x5, 0xfe, 0x0, 0x0,
-    0xdf, 0x6f, 0xf4, 0x4, 0xfe, 0x0, 0x0, 0xef,
-    0x40, 0x5f, 0xe0, 0x0, 0xd, 0xf6, 0xff, 0x40,
-    0x4f, 0xe0, 0x0, 0xe, 0xf4, 0x5, 0xfe, 0x0,
-    0x0, 0xdf, 0x6f, 0xf4, 0x4, 0xfe, 0x0, 0x0,
-    0xef, 0x73, 0x7f, 0xe0, 0x0, 0xd, 0xf6, 0xff,
-    0x40, 0x4f, 0xe0, 0x0, 0xc, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xdf, 0x6f, 0xf4, 0x4, 0xfe, 0x0,
-    0x0, 0x2d, 0xff, 0xfc, 0x20, 0x0, 0xd, 0xf6,
-    0xff, 0x40, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x6f, 0xf4, 0x4, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf6, 0xff, 0x40, 0x3f, 0xfe, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xff, 0x5f, 0xf4, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xff, 0x40, 0x0, 0x34, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x30, 0xf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x74, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0,
-
-    /* U+F03A3 "󰎣" */
-    0x5, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0x93, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xbf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfb, 0xff, 0xc0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xe6, 0x0, 0x0, 0x1, 0xff, 0xbf,
-    0xfc, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x1f, 0xfb, 0xff, 0xc0, 0x0, 0x0,
-    0xbf, 0xfb, 0xbc, 0xff, 0x90, 0x0, 0x1, 0xff,
-    0xbf, 0xfc, 0x0, 0x0, 0xc, 0xff, 0x0, 0x2f,
-    0xfa, 0x0, 0x0, 0x1f, 0xfb, 0xff, 0xc0, 0x0,
-    0x0, 0xcf, 0xf0, 0x2, 0xff, 0xa0, 0x0, 0x1,
-    0xff, 0xbf, 0xfc, 0x0, 0x0, 0xc, 0xff, 0x0,
-    0x2f, 0xfa, 0x0, 0x0, 0x1f, 0xfb, 0xff, 0xc0,
-    0x0, 0x0, 0xcf, 0xf0, 0x2, 0xff, 0xa0, 0x0,
-    0x1, 0xff, 0xbf, 0xfc, 0x0, 0x0, 0xc, 0xff,
-    0x0, 0x2f, 0xfa, 0x0, 0x0, 0x1f, 0xfb, 0xff,
-    0xc0, 0x0, 0x0, 0xcf, 0xf0, 0x2, 0xff, 0xa0,
-    0x0, 0x1, 0xff, 0xbf, 0xfc, 0x0, 0x0, 0xc,
-    0xff, 0x0, 0x2f, 0xfa, 0x0, 0x0, 0x1f, 0xfb,
-    0xff, 0xc0, 0x0, 0x0, 0xcf, 0xf0, 0x2, 0xff,
-    0x90, 0x0, 0x1, 0xff, 0xbf, 0xfc, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x1f,
-    0xfb, 0xff, 0xc0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x1, 0xff, 0xbf, 0xfc, 0x0,
-    0x0, 0x0, 0x39, 0xbb, 0xb9, 0x20, 0x0, 0x0,
-    0x1f, 0xfb, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xbf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfb, 0xff, 0xfc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xaa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x1a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
-    0x0,
-
-    /* U+F03A4 "󰎤" */
-    0x2, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x50, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x66, 0x20, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0xef, 0xff, 0xff, 0xff, 0xf9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xe, 0xff,
-    0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0xef, 0xff, 0xff, 0xff, 0xf9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x77, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x1a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6,
-    0x0,
-
-    /* U+F03A5 "󰎥" */
-    0x0, 0x0, 0x0, 0x56, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x50, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x3f, 0xfd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0x50, 0x0, 0x4,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf6, 0x11, 0x0, 0x4f, 0xe0, 0x0, 0x0,
-    0x1, 0x11, 0x10, 0x0, 0x0, 0xdf, 0x6f, 0xf3,
-    0x4, 0xfe, 0x0, 0x0, 0x7, 0xff, 0xfe, 0x0,
-    0x0, 0xd, 0xf6, 0xff, 0x30, 0x4f, 0xe0, 0x0,
-    0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0xdf, 0x6f,
-    0xf3, 0x4, 0xfe, 0x0, 0x0, 0x0, 0x14, 0xfe,
-    0x0, 0x0, 0xd, 0xf6, 0xff, 0x30, 0x4f, 0xe0,
-    0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0xdf,
-    0x6f, 0xf3, 0x4, 0xfe, 0x0, 0x0, 0x0, 0x3,
-    0xfe, 0x0, 0x0, 0xd, 0xf6, 0xff, 0x30, 0x4f,
-    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
-    0xdf, 0x6f, 0xf3, 0x4, 0xfe, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0x0, 0x0, 0xd, 0xf6, 0xff, 0x30,
-    0x4f, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
-    0x0, 0xdf, 0x6f, 0xf3, 0x4, 0xfe, 0x0, 0x0,
-    0x0, 0x3, 0xfe, 0x0, 0x0, 0xd, 0xf6, 0xff,
-    0x30, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xe0,
-    0x0, 0x0, 0xdf, 0x6f, 0xf3, 0x4, 0xfe, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0xd, 0xf6,
-    0xff, 0x30, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x6f, 0xf3, 0x4, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf6, 0xff, 0x30, 0x3f, 0xfe, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xff, 0x5f, 0xf3, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xff, 0x30, 0x0, 0x34, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x30, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x63, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0,
-
-    /* U+F03A6 "󰎦" */
-    0x5, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0x92, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xaf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x1, 0xff, 0xaf,
-    0xfc, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0,
-    0x5, 0xbb, 0xef, 0xf0, 0x0, 0x0, 0x1, 0xff,
-    0xaf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x0, 0x0, 0x0, 0x1f, 0xfa, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf0, 0x0, 0x0, 0x1,
-    0xff, 0xaf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf0, 0x0, 0x0,
-    0x1, 0xff, 0xaf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf0, 0x0,
-    0x0, 0x1, 0xff, 0xaf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x0, 0x0, 0x0, 0x1f, 0xfa,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf0,
-    0x0, 0x0, 0x1, 0xff, 0xaf, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x0, 0x0, 0x0, 0x1f,
-    0xfa, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf0, 0x0, 0x0, 0x1, 0xff, 0xaf, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xaa, 0x0, 0x0, 0x0,
-    0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xaf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0xff, 0xfc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xaa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x1a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
-    0x0,
-
-    /* U+F03A7 "󰎧" */
-    0x2, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x61, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x18, 0xff, 0xff, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0xb9, 0x99, 0x96, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x5, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x93, 0x11,
-    0x10, 0x6, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x1, 0x8f, 0xff, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0xa, 0xcc, 0xcc,
-    0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xf9, 0x77, 0x77, 0x77, 0x7a, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x1a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8,
-    0x0,
-
-    /* U+F03A8 "󰎨" */
-    0x0, 0x0, 0x0, 0x56, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x50, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x3f, 0xfd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0x50, 0x0, 0x4,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf6, 0x11, 0x0, 0x4f, 0xe0, 0x0, 0x1,
-    0x11, 0x11, 0x0, 0x0, 0x0, 0xdf, 0x6f, 0xf3,
-    0x4, 0xfe, 0x0, 0x0, 0xef, 0xff, 0xfe, 0x30,
-    0x0, 0xd, 0xf6, 0xff, 0x30, 0x4f, 0xe0, 0x0,
-    0xe, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xdf, 0x6f,
-    0xf3, 0x4, 0xfe, 0x0, 0x0, 0x11, 0x11, 0x6f,
-    0xe0, 0x0, 0xd, 0xf6, 0xff, 0x30, 0x4f, 0xe0,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0x0, 0x0, 0xdf,
-    0x6f, 0xf3, 0x4, 0xfe, 0x0, 0x0, 0x1a, 0xdd,
-    0xef, 0xd0, 0x0, 0xd, 0xf6, 0xff, 0x30, 0x4f,
-    0xe0, 0x0, 0xa, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0xdf, 0x6f, 0xf3, 0x4, 0xfe, 0x0, 0x0, 0xef,
-    0x96, 0x62, 0x0, 0x0, 0xd, 0xf6, 0xff, 0x30,
-    0x4f, 0xe0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x6f, 0xf3, 0x4, 0xfe, 0x0, 0x0,
-    0xef, 0x73, 0x33, 0x20, 0x0, 0xd, 0xf6, 0xff,
-    0x30, 0x4f, 0xe0, 0x0, 0xe, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xdf, 0x6f, 0xf3, 0x4, 0xfe, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xe0, 0x0, 0xd, 0xf6,
-    0xff, 0x30, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x6f, 0xf3, 0x4, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf6, 0xff, 0x30, 0x3f, 0xfe, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xff, 0x5f, 0xf3, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xff, 0x30, 0x0, 0x34, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x30, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x63, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0,
-
-    /* U+F03A9 "󰎩" */
-    0x5, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0x92, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xaf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xe7, 0x0, 0x0, 0x1, 0xff, 0xaf,
-    0xfc, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0,
-    0x9b, 0xbb, 0xbc, 0xff, 0x90, 0x0, 0x1, 0xff,
-    0xaf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf9, 0x0, 0x0, 0x1f, 0xfa, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x90, 0x0, 0x1,
-    0xff, 0xaf, 0xfc, 0x0, 0x0, 0x0, 0x28, 0xaa,
-    0xbf, 0xf9, 0x0, 0x0, 0x1f, 0xfa, 0xff, 0xc0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x1, 0xff, 0xaf, 0xfc, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfe, 0x70, 0x0, 0x0, 0x1f, 0xfa, 0xff,
-    0xc0, 0x0, 0x0, 0xcf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xaf, 0xfc, 0x0, 0x0, 0xc,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa,
-    0xff, 0xc0, 0x0, 0x0, 0xcf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xaf, 0xfc, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x1f,
-    0xfa, 0xff, 0xc0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x1, 0xff, 0xaf, 0xfc, 0x0,
-    0x0, 0x9, 0xbb, 0xbb, 0xbb, 0xb7, 0x0, 0x0,
-    0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xaf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0xff, 0xfc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xaa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x1a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
-    0x0,
-
-    /* U+F03AA "󰎪" */
-    0x2, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x61, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0xb9, 0x99, 0x96, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x5, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11,
-    0x10, 0x9, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x5, 0xff, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xff, 0xff, 0xdc, 0xcc, 0xc8, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xf9, 0x77, 0x77, 0x79, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x1a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8,
-    0x0,
-
-    /* U+F03AB "󰎫" */
-    0x0, 0x0, 0x0, 0x56, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x50, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x3f, 0xfd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0x50, 0x0, 0x4,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf6, 0x11, 0x0, 0x4f, 0xe0, 0x0, 0x1,
-    0x11, 0x11, 0x0, 0x0, 0x0, 0xdf, 0x6f, 0xf3,
-    0x4, 0xfe, 0x0, 0x0, 0xcf, 0xff, 0xfe, 0x30,
-    0x0, 0xd, 0xf6, 0xff, 0x30, 0x4f, 0xe0, 0x0,
-    0xc, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xdf, 0x6f,
-    0xf3, 0x4, 0xfe, 0x0, 0x0, 0x1, 0x11, 0x6f,
-    0xe0, 0x0, 0xd, 0xf6, 0xff, 0x30, 0x4f, 0xe0,
-    0x0, 0x0, 0x0, 0x5, 0xfe, 0x0, 0x0, 0xdf,
-    0x6f, 0xf3, 0x4, 0xfe, 0x0, 0x0, 0x0, 0x8e,
-    0xef, 0xb0, 0x0, 0xd, 0xf6, 0xff, 0x30, 0x4f,
-    0xe0, 0x0, 0x0, 0x9, 0xff, 0xe2, 0x0, 0x0,
-    0xdf, 0x6f, 0xf3, 0x4, 0xfe, 0x0, 0x0, 0x0,
-    0x35, 0x9f, 0xb0, 0x0, 0xd, 0xf6, 0xff, 0x30,
-    0x4f, 0xe0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x0,
-    0x0, 0xdf, 0x6f, 0xf3, 0x4, 0xfe, 0x0, 0x0,
-    0x23, 0x33, 0x7f, 0xe0, 0x0, 0xd, 0xf6, 0xff,
-    0x30, 0x4f, 0xe0, 0x0, 0xc, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xdf, 0x6f, 0xf3, 0x4, 0xfe, 0x0,
-    0x0, 0xcf, 0xff, 0xfd, 0x20, 0x0, 0xd, 0xf6,
-    0xff, 0x30, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x6f, 0xf3, 0x4, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf6, 0xff, 0x30, 0x3f, 0xfe, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xff, 0x5f, 0xf3, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xff, 0x30, 0x0, 0x34, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x30, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x63, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0,
-
-    /* U+F03AC "󰎬" */
-    0x5, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0x92, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xaf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xe6, 0x0, 0x0, 0x1, 0xff, 0xaf,
-    0xfc, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0,
-    0x7b, 0xbb, 0xbc, 0xff, 0x70, 0x0, 0x1, 0xff,
-    0xaf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf8, 0x0, 0x0, 0x1f, 0xfa, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0, 0x1,
-    0xff, 0xaf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x9a,
-    0xbf, 0xf5, 0x0, 0x0, 0x1f, 0xfa, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf7, 0x0, 0x0,
-    0x1, 0xff, 0xaf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xd1, 0x0, 0x0, 0x1f, 0xfa, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x70,
-    0x0, 0x1, 0xff, 0xaf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x1f, 0xfa,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x80, 0x0, 0x1, 0xff, 0xaf, 0xfc, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x1f,
-    0xfa, 0xff, 0xc0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x1, 0xff, 0xaf, 0xfc, 0x0,
-    0x0, 0x7, 0xbb, 0xbb, 0xb9, 0x10, 0x0, 0x0,
-    0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xaf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0xff, 0xfc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xaa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x1a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
-    0x0,
-
-    /* U+F03AD "󰎭" */
-    0x2, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x61, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0xf, 0xfa, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0xff, 0xa0, 0x5,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0xf, 0xfa, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xdf, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xff, 0xa0,
-    0x5, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0xf, 0xfa, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x77,
-    0x40, 0x5, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x5, 0xff, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x5, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0x7a, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x1a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8,
-    0x0,
-
-    /* U+F03AE "󰎮" */
-    0x5, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0x92, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xaf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0xcf,
-    0xf0, 0x2, 0xff, 0x90, 0x0, 0x1, 0xff, 0xaf,
-    0xfc, 0x0, 0x0, 0xc, 0xff, 0x0, 0x2f, 0xf9,
-    0x0, 0x0, 0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0,
-    0xcf, 0xf0, 0x2, 0xff, 0x90, 0x0, 0x1, 0xff,
-    0xaf, 0xfc, 0x0, 0x0, 0xc, 0xff, 0x0, 0x2f,
-    0xf9, 0x0, 0x0, 0x1f, 0xfa, 0xff, 0xc0, 0x0,
-    0x0, 0xcf, 0xf0, 0x2, 0xff, 0x90, 0x0, 0x1,
-    0xff, 0xaf, 0xfc, 0x0, 0x0, 0xc, 0xff, 0x88,
-    0x9f, 0xf9, 0x0, 0x0, 0x1f, 0xfa, 0xff, 0xc0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x1, 0xff, 0xaf, 0xfc, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x1f, 0xfa, 0xff,
-    0xc0, 0x0, 0x0, 0x22, 0x22, 0x24, 0xff, 0x90,
-    0x0, 0x1, 0xff, 0xaf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf9, 0x0, 0x0, 0x1f, 0xfa,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x90, 0x0, 0x1, 0xff, 0xaf, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf9, 0x0, 0x0, 0x1f,
-    0xfa, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x90, 0x0, 0x1, 0xff, 0xaf, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xa6, 0x0, 0x0,
-    0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xaf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0xff, 0xfc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xaa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x1a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
-    0x0,
-
-    /* U+F03AF "󰎯" */
-    0x0, 0x0, 0x0, 0x56, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x50, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x3f, 0xfd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0x50, 0x0, 0x4,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf6, 0x11, 0x0, 0x4f, 0xe0, 0x0, 0x1,
-    0x11, 0x11, 0x11, 0x0, 0x0, 0xdf, 0x6f, 0xf3,
-    0x4, 0xfe, 0x0, 0x0, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0xd, 0xf6, 0xff, 0x30, 0x4f, 0xe0, 0x0,
-    0xe, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xdf, 0x6f,
-    0xf3, 0x4, 0xfe, 0x0, 0x0, 0xef, 0x51, 0x11,
-    0x10, 0x0, 0xd, 0xf6, 0xff, 0x30, 0x4f, 0xe0,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x6f, 0xf3, 0x4, 0xfe, 0x0, 0x0, 0xef, 0xee,
-    0xea, 0x10, 0x0, 0xd, 0xf6, 0xff, 0x30, 0x4f,
-    0xe0, 0x0, 0xe, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0xdf, 0x6f, 0xf3, 0x4, 0xfe, 0x0, 0x0, 0x55,
-    0x55, 0x9f, 0xe0, 0x0, 0xd, 0xf6, 0xff, 0x30,
-    0x4f, 0xe0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x0,
-    0x0, 0xdf, 0x6f, 0xf3, 0x4, 0xfe, 0x0, 0x0,
-    0x23, 0x33, 0x7f, 0xe0, 0x0, 0xd, 0xf6, 0xff,
-    0x30, 0x4f, 0xe0, 0x0, 0xe, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0xdf, 0x6f, 0xf3, 0x4, 0xfe, 0x0,
-    0x0, 0xef, 0xff, 0xfc, 0x20, 0x0, 0xd, 0xf6,
-    0xff, 0x30, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x6f, 0xf3, 0x4, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf6, 0xff, 0x30, 0x3f, 0xfe, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xff, 0x5f, 0xf3, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xff, 0x30, 0x0, 0x34, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x30, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x63, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0,
-
-    /* U+F03B0 "󰎰" */
-    0x5, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0x92, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xaf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x1, 0xff, 0xaf,
-    0xfc, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0,
-    0xcf, 0xfb, 0xbb, 0xbb, 0x60, 0x0, 0x1, 0xff,
-    0xaf, 0xfc, 0x0, 0x0, 0xc, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfa, 0xff, 0xc0, 0x0,
-    0x0, 0xcf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xaf, 0xfc, 0x0, 0x0, 0xc, 0xff, 0xaa,
-    0xa7, 0x10, 0x0, 0x0, 0x1f, 0xfa, 0xff, 0xc0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x1, 0xff, 0xaf, 0xfc, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x1f, 0xfa, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x80,
-    0x0, 0x1, 0xff, 0xaf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x1f, 0xfa,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x80, 0x0, 0x1, 0xff, 0xaf, 0xfc, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x1f,
-    0xfa, 0xff, 0xc0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x1, 0xff, 0xaf, 0xfc, 0x0,
-    0x0, 0x9, 0xbb, 0xbb, 0xb9, 0x10, 0x0, 0x0,
-    0x1f, 0xfa, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xaf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0xff, 0xfc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff, 0xaa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x1a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
-    0x0,
-
-    /* U+F03B1 "󰎱" */
-    0x2, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x61, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x8, 0x99, 0x99, 0xcf, 0xff, 0xff, 0xff,
-    0xdf, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x11,
-    0x23, 0xbf, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x5, 0xff, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xff, 0xff, 0xdc, 0xcc, 0xc8, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xf9, 0x77, 0x77, 0x79, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x1a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8,
-    0x0,
-
-    /* U+F04C5 "󰓅" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x15, 0xad, 0xef, 0xec, 0x93, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0xff, 0xea, 0x88, 0x9b, 0xfb, 0x20, 0x0,
-    0x41, 0x0, 0x0, 0x5, 0xff, 0xfc, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xaa, 0x0, 0x0, 0x3,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x10, 0x0, 0x0, 0xef, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5e, 0xff, 0x80, 0x0, 0x0,
-    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x3, 0xcf,
-    0xff, 0xe0, 0x3, 0x20, 0xf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x19, 0xff, 0xff, 0xf5, 0x0, 0xc9,
-    0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfc, 0x0, 0x5f, 0xf0, 0xaf, 0xd0, 0x0,
-    0x0, 0x2, 0xdf, 0xff, 0xff, 0xff, 0x30, 0x4,
-    0xff, 0x4d, 0xf9, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0xf, 0xf7, 0xef, 0x70,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0xef, 0x8f, 0xf7, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0xd, 0xf9, 0xef,
-    0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xff, 0x7c, 0xfb, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x30, 0x0, 0x0, 0x1f, 0xf6,
-    0x8f, 0xf0, 0x0, 0x0, 0x0, 0x8e, 0xfc, 0x40,
-    0x0, 0x0, 0x6, 0xff, 0x23, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xd0, 0xd, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf6, 0x0, 0x4f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xfd, 0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x40, 0x0, 0x0,
-    0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x70, 0x0, 0x0, 0x1, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x40, 0x0, 0x0,
-
-    /* U+F0553 "󰕓" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbb,
-    0xcf, 0xff, 0xcb, 0xb2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x33, 0x10, 0x0, 0x1, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff,
-    0x60, 0x0, 0x1f, 0xff, 0x20, 0x7, 0xff, 0xff,
-    0xff, 0x10, 0xef, 0xff, 0xff, 0x40, 0x1, 0xff,
-    0xf2, 0x0, 0x7f, 0xff, 0xff, 0xf1, 0x5f, 0xff,
-    0xff, 0xfb, 0x0, 0x1f, 0xff, 0x20, 0x7, 0xff,
-    0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xc0, 0x1,
-    0xff, 0xf2, 0x0, 0x7f, 0xff, 0xff, 0xf1, 0x3f,
-    0xff, 0xff, 0xf9, 0x0, 0x1f, 0xff, 0x20, 0x7,
-    0xff, 0xff, 0xff, 0x10, 0xaf, 0xff, 0xfe, 0x20,
-    0x1, 0xff, 0xf2, 0x0, 0x7f, 0xff, 0xff, 0xf1,
-    0x0, 0x9f, 0xff, 0x20, 0x0, 0x1f, 0xff, 0x20,
-    0x5, 0xbf, 0xff, 0xdb, 0x10, 0x6, 0xff, 0xe0,
-    0x0, 0x1, 0xff, 0xf2, 0x0, 0x0, 0xdf, 0xf7,
-    0x0, 0x0, 0x6f, 0xfe, 0x0, 0x0, 0x1f, 0xff,
-    0x20, 0x0, 0xd, 0xff, 0x70, 0x0, 0x6, 0xff,
-    0xe0, 0x0, 0x2, 0xff, 0xf2, 0x0, 0x0, 0xdf,
-    0xf7, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x34, 0x44, 0x46, 0xff, 0xf6, 0x44,
-    0x44, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x24, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+F0632 "󰘲" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xea, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x30,
-    0x9f, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf3, 0x0, 0x9, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x30, 0x0, 0x0, 0x9f, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfd,
-    0x10, 0x0, 0x0, 0x5, 0xff, 0xf7, 0x32, 0x0,
-    0x0, 0x0, 0x3, 0x3c, 0xff, 0xd1, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xfd, 0x10, 0x5, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xd1, 0x2, 0x33, 0x33, 0x3e, 0xf9, 0x0, 0x0,
-    0x0, 0xf, 0xf9, 0x33, 0x33, 0x31, 0x0, 0x0,
-    0x0, 0xe, 0xf9, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf9,
-    0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf9, 0x0, 0x0, 0x0,
-    0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf9, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfc, 0x88, 0x88, 0x88, 0x8f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf9, 0x0,
-    0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf9, 0x0, 0x0, 0x0, 0xf,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x88, 0x88, 0x88, 0x88, 0x88, 0x83,
-    0x0, 0x0, 0x0,
-
-    /* U+F0633 "󰘳" */
-    0x0, 0x5, 0x88, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x68, 0x73, 0x0, 0x0, 0x3d, 0xff, 0xff,
-    0xc1, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfa,
-    0x0, 0x1e, 0xff, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x4, 0xff, 0xfe, 0xff, 0xfa, 0xa, 0xff, 0x50,
-    0x7, 0xff, 0x70, 0x0, 0x0, 0xdf, 0xe3, 0x0,
-    0xaf, 0xf3, 0xef, 0xa0, 0x0, 0xc, 0xfb, 0x0,
-    0x0, 0x1f, 0xf6, 0x0, 0x0, 0xff, 0x8f, 0xf7,
-    0x0, 0x0, 0x9f, 0xd0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0xe, 0xf9, 0xdf, 0xc0, 0x0, 0x9, 0xfd,
-    0x0, 0x0, 0x3f, 0xf3, 0x0, 0x3, 0xff, 0x77,
-    0xff, 0xb4, 0x33, 0xbf, 0xd3, 0x33, 0x36, 0xff,
-    0x63, 0x36, 0xef, 0xf1, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x23,
-    0x3b, 0xfd, 0x33, 0x33, 0x5f, 0xf6, 0x33, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0,
-    0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfd, 0x0, 0x0, 0x3f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0,
-    0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x3f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xad, 0xdd, 0xff,
-    0xfd, 0xdd, 0xde, 0xff, 0xed, 0xdc, 0x70, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd2, 0x4, 0xff, 0xea, 0x88,
-    0xdf, 0xe8, 0x88, 0x8a, 0xff, 0xa8, 0x8b, 0xff,
-    0xd0, 0xbf, 0xe1, 0x0, 0x9, 0xfd, 0x0, 0x0,
-    0x3f, 0xf3, 0x0, 0x7, 0xff, 0x5f, 0xf8, 0x0,
-    0x0, 0x9f, 0xd0, 0x0, 0x3, 0xff, 0x30, 0x0,
-    0xe, 0xf8, 0xff, 0x80, 0x0, 0xb, 0xfc, 0x0,
-    0x0, 0x2f, 0xf5, 0x0, 0x0, 0xef, 0x9c, 0xfd,
-    0x0, 0x2, 0xff, 0x90, 0x0, 0x0, 0xff, 0xb0,
-    0x0, 0x5f, 0xf6, 0x5f, 0xfd, 0x78, 0xef, 0xf2,
-    0x0, 0x0, 0x8, 0xff, 0xc7, 0x9f, 0xfe, 0x0,
-    0x9f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x5c, 0xff, 0xb3,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xdf, 0xea, 0x20,
-    0x0,
-
-    /* U+F0634 "󰘴" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xb3, 0xef, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xb0, 0x3, 0xef, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xb0, 0x0, 0x2, 0xef,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xb0, 0x0, 0x0, 0x2, 0xef, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0x60, 0x0, 0x0, 0xbf, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0x60, 0x0, 0xbf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0x60, 0xbf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0x44, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xc0, 0x4,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xb0, 0x0,
-
-    /* U+F0635 "󰘵" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xbb, 0xbb,
-    0xbc, 0xff, 0xa0, 0x0, 0x0, 0xab, 0xbb, 0xbb,
-    0xbb, 0xb6, 0x0, 0x0, 0x0, 0xe, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xab, 0xbb, 0xbb, 0xbb, 0x60,
-
-    /* U+F0636 "󰘶" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8e, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xd7, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfd, 0x10,
-    0x6f, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xd1, 0x0, 0x6, 0xff, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfd,
-    0x10, 0x0, 0x0, 0x6f, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfe,
-    0x20, 0x0, 0x0, 0x7, 0xff, 0xf8, 0x74, 0x0,
-    0x0, 0x0, 0x7, 0x7c, 0xff, 0xe2, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xfe, 0x20, 0x7, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x0, 0x0, 0xe, 0xf9, 0x0, 0x0,
-    0x0, 0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf9, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf9,
-    0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf9, 0x0, 0x0, 0x0,
-    0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf9, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x0, 0x0,
-    0x0,
-
-    /* U+F093E "󰤾" */
-    0x0, 0x1, 0x55, 0x55, 0x55, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x66, 0x66, 0x66, 0x66, 0x6f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x5d, 0x10,
-    0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0x0, 0x10, 0x5, 0xfd, 0x10, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x80, 0xc, 0xa0, 0x5e,
-    0xad, 0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf8, 0x0, 0x2e, 0xa5, 0xe4, 0xf7, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x2d,
-    0xef, 0xe8, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x1d, 0xf8, 0x0, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0,
-    0x3, 0xff, 0xb0, 0xf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf8, 0x0, 0x4, 0xfc, 0xfd, 0xb0,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xef, 0x80,
-    0x4, 0xf7, 0x5e, 0x3f, 0x7f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0x0, 0xb7, 0x5, 0xfd,
-    0xb0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x80, 0x0, 0x0, 0x5f, 0xb0, 0xf, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf8, 0x0, 0x0, 0x5,
-    0xa0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4b, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F093F "󰤿" */
-    0x0, 0x1, 0x55, 0x55, 0x55, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x66, 0x66, 0x66, 0x66, 0x6f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x5c, 0x10,
-    0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0x0, 0x0, 0x5, 0xfc, 0x10, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x80, 0xc, 0x90, 0x5f,
-    0xbd, 0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf8, 0x0, 0x3e, 0x95, 0xe3, 0xf7, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x2e,
-    0xdf, 0xe9, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x2e, 0xf9, 0x0, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0,
-    0x2, 0xef, 0x90, 0xf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf8, 0x0, 0x2, 0xed, 0xfe, 0x90,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xef, 0x80,
-    0x2, 0xea, 0x5e, 0x3f, 0x7f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0x0, 0xc9, 0x5, 0xfc,
-    0xc1, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x80, 0x1, 0x0, 0x5f, 0xd1, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x5,
-    0xd1, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7e, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xec, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F0940 "󰥀" */
-    0x0, 0x1, 0x55, 0x55, 0x55, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x66, 0x66, 0x66, 0x66, 0x6f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x5c, 0x10,
-    0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0x0, 0x0, 0x5, 0xfc, 0x10, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x80, 0xc, 0x80, 0x5f,
-    0xcc, 0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf8, 0x0, 0x3e, 0x95, 0xe3, 0xf7, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x3e,
-    0xdf, 0xea, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x2e, 0xfa, 0x0, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0,
-    0x2, 0xef, 0x90, 0xf, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf8, 0x0, 0x2, 0xee, 0xfe, 0x90,
-    0xff, 0xa7, 0x77, 0x77, 0x77, 0x77, 0xff, 0x80,
-    0x2, 0xea, 0x5e, 0x3f, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xca, 0x5, 0xfb,
-    0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x1, 0x0, 0x5f, 0xd1, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x5,
-    0xd1, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F0941 "󰥁" */
-    0x0, 0x1, 0x55, 0x55, 0x55, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x66, 0x66, 0x66, 0x66, 0x6f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x5d, 0x10,
-    0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0x0, 0x10, 0x5, 0xfd, 0x10, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x80, 0xc, 0xa0, 0x5e,
-    0xad, 0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf8, 0x0, 0x1d, 0xb5, 0xe4, 0xf6, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x1d,
-    0xef, 0xf7, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x1d, 0xf7, 0x0, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0,
-    0x4, 0xff, 0xc0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x4, 0xfc, 0xfc, 0xc0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x5, 0xf6, 0x5e, 0x3f, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xb6, 0x5, 0xfe,
-    0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x5f, 0xa0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x4,
-    0x90, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3a, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xa8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F0942 "󰥂" */
-    0x0, 0x1, 0x55, 0x55, 0x55, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x66, 0x66, 0x66, 0x66, 0x6f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x5d, 0x10,
-    0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0x0, 0x10, 0x5, 0xfd, 0x10, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x80, 0xc, 0x90, 0x5e,
-    0xbd, 0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf8, 0x0, 0x2e, 0xa5, 0xe3, 0xf7, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x2e,
-    0xdf, 0xe9, 0xf, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x0, 0x2e, 0xf9, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x3, 0xef, 0xa0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x3, 0xed, 0xfe, 0xa0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x3, 0xf9, 0x5e, 0x3f, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xc8, 0x5, 0xfd,
-    0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x5f, 0xc0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x5,
-    0xc0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xda, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F0943 "󰥃" */
-    0x0, 0x1, 0x55, 0x55, 0x55, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x66, 0x66, 0x66, 0x66, 0x6f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x5c, 0x0,
-    0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0x0, 0x0, 0x5, 0xfc, 0x0, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x80, 0xc, 0x80, 0x5f,
-    0xcc, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf8, 0x0, 0x3f, 0x85, 0xe3, 0xf7, 0xff, 0x71,
-    0x11, 0x11, 0x11, 0x11, 0xff, 0x80, 0x0, 0x3f,
-    0xcf, 0xda, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x3e, 0xfa, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0xdf, 0x80, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x2, 0xee, 0xfe, 0x80,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x2, 0xea, 0x5e, 0x4f, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xca, 0x5, 0xfb,
-    0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x1, 0x0, 0x5f, 0xd1, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x5,
-    0xd1, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F0944 "󰥄" */
-    0x0, 0x1, 0x55, 0x55, 0x55, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x66, 0x66, 0x66, 0x66, 0x6f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0,
-    0x0, 0x1, 0x10, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x5e, 0x20,
-    0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8,
-    0x0, 0x20, 0x5, 0xfe, 0x20, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xc, 0xc0, 0x5e,
-    0x8e, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xc, 0xc6, 0xe5, 0xf5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xb,
-    0xff, 0xf5, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0xd, 0xf6, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x6, 0xff, 0xd1, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x6, 0xfa, 0xfb, 0xd1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x6, 0xf5, 0x5e, 0x4f, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x94, 0x5, 0xff,
-    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x5f, 0x80, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x4,
-    0x70, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x28, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x86, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F0945 "󰥅" */
-    0x0, 0x1, 0x55, 0x55, 0x55, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x66, 0x66, 0x66, 0x66, 0x6f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x5d, 0x10,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x10, 0x5, 0xfd, 0x10, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xc, 0xa0, 0x5e,
-    0xad, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x2e, 0xa5, 0xe4, 0xf7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x1d,
-    0xef, 0xe8, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x1d, 0xf8, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x3, 0xff, 0xb0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x4, 0xfc, 0xfd, 0xb0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x4, 0xf7, 0x5e, 0x3f, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xb7, 0x5, 0xfd,
-    0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x5f, 0xb0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x5,
-    0xa0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4b, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F0946 "󰥆" */
-    0x0, 0x1, 0x55, 0x55, 0x55, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x66, 0x66, 0x66, 0x66, 0x6f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x5c, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x5, 0xfc, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xc, 0x80, 0x5f,
-    0xcc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x3e, 0x95, 0xe3, 0xf7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x2e,
-    0xdf, 0xe9, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x2e, 0xf9, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x2, 0xef, 0xa0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x2, 0xed, 0xfe, 0xa0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x3, 0xe9, 0x5e, 0x3f, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xc9, 0x5, 0xfc,
-    0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x5f, 0xc0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x5,
-    0xc0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6d, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xda, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F0947 "󰥇" */
-    0x0, 0x1, 0x44, 0x44, 0x44, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xee, 0xff,
-    0xff, 0xff, 0xff, 0xee, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0xcf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x4c, 0x0,
-    0xf, 0xff, 0xff, 0xf0, 0xc, 0xff, 0xff, 0xf2,
-    0x0, 0x10, 0x4, 0xfc, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0xcf, 0xff, 0xff, 0x20, 0xd, 0x90, 0x4f,
-    0xbc, 0xf, 0xff, 0xff, 0xf0, 0xc, 0xff, 0xff,
-    0xf2, 0x0, 0x3e, 0xa5, 0xe4, 0xf7, 0xff, 0xff,
-    0xff, 0x0, 0xcf, 0xff, 0xff, 0x20, 0x0, 0x2e,
-    0xef, 0xe8, 0xf, 0xff, 0xff, 0xf0, 0xc, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x1d, 0xf8, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0xcf, 0xff, 0xff, 0x20, 0x0,
-    0x4, 0xff, 0xc1, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x5, 0xfb, 0xfc, 0xd1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x6, 0xf6, 0x4e, 0x3f, 0x8f, 0xff, 0xff, 0xf6,
-    0x6e, 0xff, 0xff, 0xf2, 0x0, 0xc5, 0x4, 0xfe,
-    0xa0, 0xff, 0xff, 0xff, 0x0, 0xcf, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x4f, 0xb0, 0xf, 0xff, 0xff,
-    0xf0, 0xd, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x4,
-    0xb0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F0948 "󰥈" */
-    0x0, 0x0, 0x22, 0x22, 0x22, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xcd, 0xef,
-    0xff, 0xff, 0xff, 0xdd, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x5b, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x5, 0xfb, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xb, 0x70, 0x5f,
-    0xdb, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x4f, 0x75, 0xe3, 0xf7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x3f,
-    0xcf, 0xda, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x3e, 0xfa, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0xdf, 0x80, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x2, 0xee, 0xfe, 0x80,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x2, 0xea, 0x5e, 0x4f, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xca, 0x5, 0xfb,
-    0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x1, 0x0, 0x5f, 0xd1, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x5,
-    0xd1, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F0949 "󰥉" */
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x68, 0x88, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd8, 0x88, 0x40, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x4f,
-    0xff, 0xff, 0xff, 0xfe, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0xfe, 0x4f,
-    0xff, 0xff, 0xbb, 0xff, 0xf0, 0x0, 0x3e, 0xff,
-    0xff, 0xfe, 0x4f, 0xff, 0xfe, 0x0, 0xbf, 0xf0,
-    0x27, 0x3, 0xef, 0xff, 0xfe, 0x4f, 0xff, 0xff,
-    0xb0, 0xb, 0xf0, 0x2f, 0x30, 0x4f, 0xff, 0xfe,
-    0x4f, 0xff, 0xff, 0xfb, 0x0, 0xb0, 0x28, 0x2,
-    0xef, 0xff, 0xfe, 0x4f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x2e, 0xff, 0xff, 0xfe, 0x4f, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x2, 0xef, 0xff, 0xff,
-    0xfe, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x50, 0x9,
-    0xff, 0xff, 0xff, 0xfe, 0x4f, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfe, 0x4f,
-    0xff, 0xff, 0xff, 0x60, 0x20, 0x11, 0x9, 0xff,
-    0xff, 0xfe, 0x4f, 0xff, 0xff, 0xf6, 0x2, 0xe0,
-    0x2d, 0x10, 0x9f, 0xff, 0xfe, 0x4f, 0xff, 0xff,
-    0x60, 0x2e, 0xf0, 0x2e, 0x20, 0x7f, 0xff, 0xfe,
-    0x4f, 0xff, 0xfe, 0x22, 0xef, 0xf0, 0x12, 0x8,
-    0xff, 0xff, 0xfe, 0x4f, 0xff, 0xff, 0xee, 0xff,
-    0xf0, 0x0, 0x8f, 0xff, 0xff, 0xfe, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x8, 0xff, 0xff, 0xff,
-    0xfe, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x8f,
-    0xff, 0xff, 0xff, 0xfe, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd2, 0x0, 0x1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x0,
-
-    /* U+F094A "󰥊" */
-    0x0, 0x0, 0x22, 0x22, 0x22, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xcc, 0xdf,
-    0xff, 0xff, 0xff, 0xcc, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xfb, 0xad, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0x3,
-    0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x50, 0x0, 0x10, 0x1, 0xef, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xb0, 0x5, 0xff,
-    0xc0, 0x5, 0xff, 0x80, 0x0, 0x0, 0x5d, 0x10,
-    0xf, 0xf7, 0x0, 0xff, 0xff, 0x70, 0xf, 0xf8,
-    0x0, 0x10, 0x5, 0xfd, 0x10, 0xff, 0xdc, 0xcf,
-    0xff, 0xf9, 0x0, 0xff, 0x80, 0xc, 0xa0, 0x5e,
-    0xad, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x40, 0x2f,
-    0xf8, 0x0, 0x2e, 0xa5, 0xe4, 0xf6, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0xa, 0xff, 0x80, 0x0, 0x1d,
-    0xef, 0xf8, 0xf, 0xff, 0xff, 0xff, 0x60, 0x8,
-    0xff, 0xf8, 0x0, 0x0, 0x1d, 0xf8, 0x0, 0xff,
-    0xff, 0xff, 0xb0, 0x7, 0xff, 0xff, 0x80, 0x0,
-    0x3, 0xff, 0xb0, 0xf, 0xff, 0xff, 0xf4, 0x2,
-    0xff, 0xff, 0xf8, 0x0, 0x4, 0xfc, 0xfd, 0xb0,
-    0xff, 0xff, 0xff, 0xbb, 0xdf, 0xff, 0xff, 0x80,
-    0x4, 0xf7, 0x5e, 0x3f, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0xb7, 0x5, 0xfd,
-    0xb0, 0xff, 0xff, 0xff, 0xcc, 0xef, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x5f, 0xb0, 0xf, 0xff, 0xff,
-    0xf0, 0x8, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x5,
-    0xa0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x8f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3a, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xa7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F0A1E "󰨞" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfa, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x1, 0x94, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2,
-    0xef, 0xf8, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff,
-    0xe8, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xfb, 0x10,
-    0x3e, 0xff, 0xff, 0xff, 0xc1, 0x4f, 0xff, 0xff,
-    0xd4, 0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xff,
-    0x90, 0x4, 0xff, 0xff, 0xfd, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x4f, 0xff,
-    0xff, 0xd0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xfd,
-    0x20, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xd0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xd1, 0xcf, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xfd, 0x30, 0x4, 0xff, 0xff, 0xfd,
-    0xaf, 0xff, 0xff, 0x50, 0x9f, 0xff, 0xff, 0xff,
-    0x60, 0x4f, 0xff, 0xff, 0xd6, 0xff, 0xfd, 0x20,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xa5, 0xff, 0xff,
-    0xfd, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xf9, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xe8, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0EB7 "󰺷" */
-    0x0, 0x0, 0x0, 0x23, 0x44, 0x44, 0x44, 0x44,
-    0x43, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10,
-    0x0, 0x0, 0x7f, 0xff, 0xdc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xef, 0xfe, 0x40, 0x0, 0x6f, 0xf8,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b,
-    0xff, 0x30, 0x2f, 0xf5, 0x0, 0x23, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x11, 0x9, 0xfd, 0x9, 0xfa,
-    0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf3, 0xd, 0xf5, 0xdf, 0x40, 0x12, 0xef, 0x42,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x70, 0x7f, 0x9f,
-    0xf2, 0xe, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x10,
-    0x3c, 0xb1, 0x5, 0xfb, 0xef, 0x20, 0xce, 0xff,
-    0xee, 0x30, 0x0, 0x6f, 0xd1, 0x0, 0x0, 0x6f,
-    0xac, 0xf6, 0x0, 0xe, 0xf2, 0x0, 0x0, 0xb,
-    0xff, 0x40, 0x0, 0x9, 0xf8, 0x6f, 0xd0, 0x0,
-    0xdf, 0x20, 0x0, 0x0, 0x4e, 0xa0, 0x0, 0x2,
-    0xff, 0x20, 0xef, 0xa0, 0x0, 0x0, 0x5, 0xff,
-    0xb0, 0x0, 0x0, 0x2, 0xdf, 0xa0, 0x3, 0xff,
-    0xd6, 0x32, 0x5b, 0xff, 0xef, 0xe7, 0x32, 0x49,
-    0xff, 0xd0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xff,
-    0x51, 0xcf, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x5a, 0xcd, 0xb7, 0x10, 0x0, 0x49, 0xcd,
-    0xb8, 0x20, 0x0, 0x0,
-
-    /* U+F0F2D "󰼭" */
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfa, 0x77, 0x77, 0x77,
-    0x77, 0x7e, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x83, 0x33, 0x33, 0x33, 0x33, 0xdf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x60, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0xdd,
-    0xdd, 0xdd, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x4, 0x66, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x66, 0x62,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0xae,
-    0xee, 0xe6, 0x0, 0x0, 0x0, 0x0, 0xc, 0xee,
-    0xee, 0x50, 0x0, 0x2f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xfb, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xd8, 0x66, 0x66, 0x79, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xff, 0xff, 0x68, 0xff, 0xf6, 0x8f, 0xfe,
-    0x59, 0xff, 0xe5, 0xaf, 0xff, 0x9f, 0xff, 0xb0,
-    0xe, 0xfa, 0x0, 0xff, 0x90, 0xf, 0xf8, 0x2,
-    0xff, 0xf9, 0xff, 0xff, 0x24, 0xff, 0xe2, 0x5f,
-    0xfd, 0x16, 0xff, 0xc1, 0x7f, 0xff, 0x9d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10,
-    0x25, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x65, 0x0,
-
-    /* U+F0F85 "󰾅" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0x0, 0x5f, 0x0, 0x32, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xd0, 0xa,
-    0xf3, 0x3, 0xfc, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0xf9, 0x0, 0xef, 0x80, 0xe, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x20,
-    0x2f, 0xfc, 0x0, 0x6e, 0xff, 0xc0, 0x0, 0x0,
-    0x2, 0xef, 0xf5, 0x0, 0x6, 0xff, 0xf1, 0x0,
-    0x1b, 0xff, 0xb0, 0x0, 0x0, 0xdf, 0xf3, 0x0,
-    0x0, 0xbf, 0xff, 0x50, 0x0, 0xa, 0xff, 0x70,
-    0x0, 0x7f, 0xf5, 0x0, 0x0, 0xf, 0xff, 0xf9,
-    0x0, 0x0, 0xc, 0xff, 0x20, 0xe, 0xfa, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x2f,
-    0xf9, 0x5, 0xff, 0x30, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0xaf, 0xf0, 0xaf, 0xd0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x4, 0xff, 0x4d, 0xf9, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0xf, 0xf7, 0xff,
-    0x70, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xef, 0x8f, 0xf7, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xd, 0xf9,
-    0xef, 0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xff, 0x7c, 0xfb, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x1f,
-    0xf6, 0x8f, 0xf0, 0x0, 0x0, 0x0, 0x9e, 0xfc,
-    0x40, 0x0, 0x0, 0x6, 0xff, 0x23, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xd0, 0xd, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x4f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xfe, 0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x40, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x70, 0x0, 0x0, 0x1, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x40, 0x0,
-    0x0,
-
-    /* U+F0F86 "󰾆" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x16, 0xad, 0xff, 0xfc, 0x94, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x4, 0x10,
-    0x0, 0x5e, 0xea, 0x88, 0x9b, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x1e, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0xff, 0xc1, 0x0, 0x0, 0x0,
-    0x7f, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0xdf, 0xfb, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x70, 0x0,
-    0x50, 0x5, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0x20, 0xf, 0x60, 0xb, 0xff,
-    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9,
-    0x5, 0xfe, 0x0, 0x2f, 0xff, 0xff, 0xfc, 0x30,
-    0x0, 0x0, 0x0, 0x9f, 0xf0, 0xaf, 0xe0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x4,
-    0xff, 0x4d, 0xfa, 0x0, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0xf, 0xf7, 0xff, 0x80,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xef, 0x8f, 0xf7, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0xd, 0xf9, 0xef,
-    0x80, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xff, 0x7c, 0xfb, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x1f, 0xf6,
-    0x8f, 0xf0, 0x0, 0x0, 0x0, 0x7d, 0xfc, 0x40,
-    0x0, 0x0, 0x6, 0xff, 0x23, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xd0, 0xd, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf6, 0x0, 0x4f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xfd, 0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x40, 0x0, 0x0,
-    0xcf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x70, 0x0, 0x0, 0x1, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x40, 0x0, 0x0,
-
-    /* U+F11F0 "󱇰" */
-    0x0, 0x7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xb3, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x4f, 0xff,
-    0xa7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xdf,
-    0xfd, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xd0, 0x0, 0x4f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xfd, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xd0, 0x0,
-    0x4f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfd, 0x0, 0x4, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xd0,
-    0x0, 0x4f, 0xff, 0x40, 0xff, 0xf9, 0x0, 0xf,
-    0xff, 0x90, 0xaf, 0xfd, 0x0, 0x4, 0xff, 0xf4,
-    0xf, 0xff, 0x90, 0x0, 0xff, 0xf9, 0xa, 0xff,
-    0xd0, 0x0, 0x4f, 0xff, 0x40, 0xff, 0xf9, 0x0,
-    0xf, 0xff, 0x90, 0xaf, 0xfd, 0x0, 0x4, 0xff,
-    0xf4, 0x8, 0x88, 0x40, 0x0, 0x88, 0x85, 0xa,
-    0xff, 0xd0, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0, 0x4,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xd0, 0x0, 0x4f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0,
-    0x4, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xd0, 0x8, 0xaf, 0xff, 0xa8,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xdf, 0xfe,
-    0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x71, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x2, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0,
-    0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 394, .box_w = 25, .box_h = 20, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 250, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 563, .adv_w = 394, .box_w = 26, .box_h = 31, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 966, .adv_w = 394, .box_w = 25, .box_h = 16, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 1166, .adv_w = 394, .box_w = 25, .box_h = 30, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1541, .adv_w = 394, .box_w = 25, .box_h = 35, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 1979, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 2375, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 2771, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 3167, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 3563, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 3959, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 4355, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 4751, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 5147, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 5543, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 5939, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 6335, .adv_w = 394, .box_w = 23, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 6749, .adv_w = 394, .box_w = 25, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7049, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7362, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7675, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7988, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8301, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8614, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8927, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 9323, .adv_w = 394, .box_w = 25, .box_h = 23, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 9611, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 10007, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 10403, .adv_w = 394, .box_w = 25, .box_h = 23, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 10691, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 11087, .adv_w = 394, .box_w = 23, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 11501, .adv_w = 394, .box_w = 25, .box_h = 28, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 11851, .adv_w = 394, .box_w = 25, .box_h = 28, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 12201, .adv_w = 394, .box_w = 25, .box_h = 32, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 12601, .adv_w = 394, .box_w = 19, .box_h = 36, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 12943, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13256, .adv_w = 394, .box_w = 25, .box_h = 13, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 13419, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13732, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14045, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14358, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14671, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14984, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15297, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15610, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15923, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16236, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16549, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16862, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17175, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17488, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17801, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18114, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18427, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18740, .adv_w = 394, .box_w = 25, .box_h = 23, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 19028, .adv_w = 394, .box_w = 25, .box_h = 36, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 19478, .adv_w = 394, .box_w = 26, .box_h = 31, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 19881, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20194, .adv_w = 394, .box_w = 25, .box_h = 15, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 20382, .adv_w = 394, .box_w = 25, .box_h = 23, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 20670, .adv_w = 394, .box_w = 26, .box_h = 21, .ofs_x = -1, .ofs_y = 2},
-    {.bitmap_index = 20943, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21256, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21569, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21882, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22195, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22508, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22821, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23134, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23447, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23760, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24073, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24386, .adv_w = 394, .box_w = 22, .box_h = 36, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 24782, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25095, .adv_w = 394, .box_w = 25, .box_h = 26, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 25420, .adv_w = 394, .box_w = 25, .box_h = 15, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 25608, .adv_w = 394, .box_w = 25, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25908, .adv_w = 394, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 26221, .adv_w = 394, .box_w = 25, .box_h = 23, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 26509, .adv_w = 394, .box_w = 25, .box_h = 36, .ofs_x = 0, .ofs_y = -6}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_0[] = {
-    0x0, 0xf23, 0xf25, 0x1030, 0x10ab, 0x12a0
-};
-
-static const uint16_t unicode_list_4[] = {
-    0x0, 0x8e, 0x16d, 0x16e, 0x16f, 0x170, 0x171, 0x479,
-    0x47a, 0x47b, 0x47c, 0x47d, 0x47e, 0x47f, 0x480, 0x481,
-    0x482, 0x483, 0x484, 0x485, 0x559, 0x9f2, 0xa68, 0xac0,
-    0xac1, 0xd2b
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 57943, .range_length = 4769, .glyph_id_start = 1,
-        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 6, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 983161, .range_length = 25, .glyph_id_start = 7,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 983215, .range_length = 6, .glyph_id_start = 32,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 983968, .range_length = 18, .glyph_id_start = 38,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 984261, .range_length = 3372, .glyph_id_start = 56,
-        .unicode_list = unicode_list_4, .glyph_id_ofs_list = NULL, .list_length = 26, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 5,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-extern const lv_font_t lv_font_montserrat_40;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t nerd_40 = {
-#else
-lv_font_t nerd_40 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 36,          /*The maximum line height required by the font*/
-    .base_line = 6,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_40,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if NERD_40*/
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+
+/*
+ * Binary event log shared by the recorder and the replay driver, see
+ * scripts/event_log.py for the host side. A header is followed by
+ * fixed-size little-endian records. Each record stores the milliseconds
+ * since the previous one. Gaps are clipped to 65 s, which does not matter
+ * for the screen.
+ */
+
+#define EVENT_LOG_MAGIC "DSEV"
+#define EVENT_LOG_VERSION 1
+
+enum event_log_type {
+    EVENT_LOG_KEYCODE,    // arg0: usage page, bit 7 pressed; arg1: keycode
+    EVENT_LOG_LAYER,      // arg0: layer; arg1: 1 if activated
+    EVENT_LOG_WPM,        // arg1: words per minute
+    EVENT_LOG_ENDPOINT,   // arg0: transport; arg1: BLE profile index
+    EVENT_LOG_BATTERY,    // arg0: peripheral source; arg1: state of charge
+};
+
+#define EVENT_LOG_KEY_PRESSED BIT(7)
+
+struct event_log_header {
+    char magic[4];
+    uint8_t version;
+    uint8_t record_size;
+    uint16_t records;
+} __packed;
+
+struct event_log_record {
+    uint16_t delta_ms;
+    uint8_t type;
+    uint8_t arg0;
+    uint16_t arg1;
+} __packed;
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zmk/event_manager.h>
+#include <zmk/endpoints.h>
+#include <zmk/events/keycode_state_changed.h>
+#include <zmk/events/layer_state_changed.h>
+#include <zmk/events/wpm_state_changed.h>
+#include <zmk/events/endpoint_changed.h>
+#include <zmk/events/battery_state_changed.h>
+
+#include "event_log.h"
+
+/*
+ * Records the events the screen reacts to into a RAM buffer, to be dumped
+ * from the shell and replayed on native_sim. Recording stops when the
+ * buffer is full.
+ */
+
+#define MAX_RECORDS (CONFIG_DONGLE_SCREEN_EVENT_RECORDER_SIZE / sizeof(struct event_log_record))
+
+static struct k_spinlock lock;
+static struct event_log_record records[MAX_RECORDS];
+static uint16_t count;
+static uint32_t last_ms;
+static bool recording;
+
+static void record(uint8_t type, uint8_t arg0, uint16_t arg1) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    if (recording && count < MAX_RECORDS) {
+        const uint32_t now = k_uptime_get_32();
+        const uint16_t delta = count == 0 ? 0 : MIN(now - last_ms, UINT16_MAX);
+
+        records[count++] = (struct event_log_record){
+            .delta_ms = sys_cpu_to_le16(delta),
+            .type = type,
+            .arg0 = arg0,
+            .arg1 = sys_cpu_to_le16(arg1),
+        };
+        last_ms = now;
+    }
+    k_spin_unlock(&lock, key);
+}
+
+static int recorder_event_cb(const zmk_event_t *eh) {
+    const struct zmk_keycode_state_changed *key = as_zmk_keycode_state_changed(eh);
+    if (key != NULL) {
+        record(EVENT_LOG_KEYCODE, (key->usage_page & 0x7F) | (key->state ? EVENT_LOG_KEY_PRESSED : 0),
+               key->keycode);
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+    const struct zmk_layer_state_changed *layer = as_zmk_layer_state_changed(eh);
+    if (layer != NULL) {
+        record(EVENT_LOG_LAYER, layer->layer, layer->state);
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+    const struct zmk_wpm_state_changed *wpm = as_zmk_wpm_state_changed(eh);
+    if (wpm != NULL) {
+        record(EVENT_LOG_WPM, 0, wpm->state);
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+    const struct zmk_endpoint_changed *endpoint = as_zmk_endpoint_changed(eh);
+    if (endpoint != NULL) {
+        record(EVENT_LOG_ENDPOINT, endpoint->endpoint.transport,
+               endpoint->endpoint.ble.profile_index);
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+    const struct zmk_peripheral_battery_state_changed *battery =
+        as_zmk_peripheral_battery_state_changed(eh);
+    if (battery != NULL) {
+        record(EVENT_LOG_BATTERY, battery->source, battery->state_of_charge);
+    }
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(dongle_screen_recorder, recorder_event_cb);
+ZMK_SUBSCRIPTION(dongle_screen_recorder, zmk_keycode_state_changed);
+ZMK_SUBSCRIPTION(dongle_screen_recorder, zmk_layer_state_changed);
+ZMK_SUBSCRIPTION(dongle_screen_recorder, zmk_wpm_state_changed);
+ZMK_SUBSCRIPTION(dongle_screen_recorder, zmk_endpoint_changed);
+ZMK_SUBSCRIPTION(dongle_screen_recorder, zmk_peripheral_battery_state_changed);
+
+static int cmd_record_start(const struct shell *sh, size_t argc, char **argv) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    count = 0;
+    recording = true;
+    k_spin_unlock(&lock, key);
+
+    shell_print(sh, "recording, room for %u events", (unsigned int)MAX_RECORDS);
+    return 0;
+}
+
+static int cmd_record_stop(const struct shell *sh, size_t argc, char **argv) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    recording = false;
+    k_spin_unlock(&lock, key);
+
+    shell_print(sh, "%u events recorded", count);
+    return 0;
+}
+
+// Hex lines of 32 bytes, `scripts/event_log.py extract` turns a console log back into a file
+static int cmd_record_dump(const struct shell *sh, size_t argc, char **argv) {
+    if (recording) {
+        shell_error(sh, "stop the recording first");
+        return -EBUSY;
+    }
+
+    const struct event_log_header header = {
+        .magic = EVENT_LOG_MAGIC,
+        .version = EVENT_LOG_VERSION,
+        .record_size = sizeof(struct event_log_record),
+        .records = sys_cpu_to_le16(count),
+    };
+    const size_t total = sizeof(header) + count * sizeof(struct event_log_record);
+    char line[2 * 32 + 1];
+    size_t n = 0;
+
+    shell_print(sh, "event log %u bytes", (unsigned int)total);
+    for (size_t i = 0; i < total; i++) {
+        const uint8_t byte = i < sizeof(header)
+                                 ? ((const uint8_t *)&header)[i]
+                                 : ((const uint8_t *)records)[i - sizeof(header)];
+        n += snprintf(&line[n], sizeof(line) - n, "%02x", byte);
+        if (n == sizeof(line) - 1 || i == total - 1) {
+            shell_print(sh, "%s", line);
+            n = 0;
+        }
+    }
+    shell_print(sh, "end of event log");
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(record_cmds,
+                               SHELL_CMD(start, NULL, "Start a new recording", cmd_record_start),
+                               SHELL_CMD(stop, NULL, "Stop recording", cmd_record_stop),
+                               SHELL_CMD(dump, NULL, "Print the recording as hex", cmd_record_dump),
+                               SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((dongle_screen), record, &record_cmds, "Record the events shown by the screen",
+                 NULL, 2, 0);
@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <lvgl.h>
+#include <zmk/display.h>
+#include <zmk/event_manager.h>
+#include <zmk/endpoints.h>
+#include <zmk/keymap.h>
+#include <zmk/events/keycode_state_changed.h>
+#include <zmk/events/wpm_state_changed.h>
+#include <zmk/events/battery_state_changed.h>
+#if IS_ENABLED(CONFIG_ZMK_BLE)
+#include <zmk/ble.h>
+#endif
+
+#include "event_log.h"
+#include "../widgets/widget_listener.h"
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_SH1106_EMUL) &&                                            \
+    (DT_NODE_HAS_COMPAT(DT_CHOSEN(zephyr_display), sinowealth_sh1106) ||                       \
+     DT_NODE_HAS_COMPAT(DT_CHOSEN(zephyr_display), sinowealth_sh1107))
+#define PANEL_EMUL 1
+#include "../emul/sh1106_emul.h"
+#elif IS_ENABLED(CONFIG_DONGLE_SCREEN_PARTIAL_FLUSH)
+#include "../display/panel_flush.h"
+#endif
+
+#if IS_ENABLED(CONFIG_ARCH_POSIX)
+#include <posix_board_if.h>
+#endif
+
+/*
+ * Replays a recorded event log (see event_log.h) by raising the same ZMK
+ * events again, so the screen goes through the real listeners. Layer and
+ * endpoint changes go through the keymap and endpoint APIs, because the
+ * widgets read that state rather than the event. Events are raised from
+ * the system work queue with the recorded gaps, scaled by the speed.
+ *
+ * At the end a report of the rendering cost is logged: frames, flushes,
+ * bytes sent to the panel (counted by the emulator on native_sim),
+ * CPU time of the display thread and, with the latency trace, the
+ * keypress-to-photon latency per widget.
+ */
+
+#ifdef DONGLE_SCREEN_HAS_REPLAY_LOG
+static const uint8_t builtin_log[] = {
+#include "event_log.inc"
+};
+#else
+static const uint8_t builtin_log[sizeof(struct event_log_header)];
+#endif
+
+struct replay_report {
+    uint32_t events;
+    uint32_t duration_ms;
+    uint32_t frames;
+    uint32_t flushes;
+    uint32_t bytes;
+    uint32_t display_cpu_us;
+};
+
+static const struct event_log_record *records;
+static uint16_t record_count;
+static uint16_t next;
+static uint16_t speed;
+static bool running;
+
+static uint32_t started_ms;
+static uint32_t frames;
+static uint32_t flushes;
+static uint32_t bytes_at_start;
+static uint64_t cycles_at_start;
+static struct replay_report report;
+
+static uint32_t panel_bytes(void) {
+#if defined(PANEL_EMUL)
+    struct sh1106_emul_stats stats;
+    sh1106_emul_get_stats(EMUL_DT_GET(DT_CHOSEN(zephyr_display)), &stats);
+    return stats.data_bytes;
+#elif IS_ENABLED(CONFIG_DONGLE_SCREEN_PARTIAL_FLUSH)
+    struct panel_flush_stats stats;
+    panel_flush_get_stats(&stats);
+    return stats.bytes_written;
+#else
+    return 0;
+#endif
+}
+
+static uint64_t display_cycles(void) {
+    k_thread_runtime_stats_t stats;
+    if (k_thread_runtime_stats_get(k_work_queue_thread_get(zmk_display_work_q()), &stats) == 0) {
+        return stats.execution_cycles;
+    }
+    return 0;
+}
+
+static void display_event_cb(lv_event_t *e) {
+    if (!running) {
+        return;
+    }
+    if (lv_event_get_code(e) == LV_EVENT_RENDER_READY) {
+        frames++;
+    } else {
+        flushes++;
+    }
+}
+
+// LVGL is only used from the display queue, so the callbacks are added there
+static void hook_work_cb(struct k_work *work) {
+    lv_display_t *disp = lv_display_get_default();
+    if (disp == NULL) {
+        LOG_ERR("Replay: no display, frames and flushes are not counted");
+        return;
+    }
+    lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_RENDER_READY, NULL);
+    lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_FLUSH_FINISH, NULL);
+}
+
+static K_WORK_DEFINE(hook_work, hook_work_cb);
+
+static void replay_record(const struct event_log_record *rec) {
+    const uint16_t arg1 = sys_le16_to_cpu(rec->arg1);
+
+    switch (rec->type) {
+    case EVENT_LOG_KEYCODE:
+        raise_zmk_keycode_state_changed((struct zmk_keycode_state_changed){
+            .usage_page = rec->arg0 & ~EVENT_LOG_KEY_PRESSED,
+            .keycode = arg1,
+            .state = (rec->arg0 & EVENT_LOG_KEY_PRESSED) != 0,
+            .timestamp = k_uptime_get(),
+        });
+        break;
+    case EVENT_LOG_LAYER:
+        if (arg1) {
+            zmk_keymap_layer_activate(rec->arg0);
+        } else {
+            zmk_keymap_layer_deactivate(rec->arg0);
+        }
+        break;
+    case EVENT_LOG_WPM:
+        raise_zmk_wpm_state_changed((struct zmk_wpm_state_changed){.state = arg1});
+        break;
+    case EVENT_LOG_ENDPOINT:
+        zmk_endpoints_select_transport(rec->arg0);
+#if IS_ENABLED(CONFIG_ZMK_BLE)
+        zmk_ble_prof_select(arg1);
+#endif
+        break;
+    case EVENT_LOG_BATTERY:
+        raise_zmk_peripheral_battery_state_changed((struct zmk_peripheral_battery_state_changed){
+            .source = rec->arg0,
+            .state_of_charge = arg1,
+        });
+        break;
+    default:
+        LOG_WRN("Replay: unknown event type %u", rec->type);
+        break;
+    }
+}
+
+typedef void (*report_out_t)(void *ctx, const char *line);
+
+static void report_print(void *ctx, report_out_t out) {
+    char line[128];
+
+    snprintf(line, sizeof(line),
+             "replay events=%u duration_ms=%u frames=%u flushes=%u bytes=%u display_cpu_us=%u",
+             report.events, report.duration_ms, report.frames, report.flushes, report.bytes,
+             report.display_cpu_us);
+    out(ctx, line);
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_LATENCY_TRACE)
+    struct widget_listener *listener;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widget_listeners, listener, node) {
+        const struct latency_hist *hist = &listener->trace.hist[LATENCY_FLUSH];
+        snprintf(line, sizeof(line),
+                 "latency widget=%s count=%u min_us=%u avg_us=%u p99_us=%u max_us=%u",
+                 listener->name, hist->count, hist->min_us,
+                 hist->count ? (uint32_t)(hist->total_us / hist->count) : 0,
+                 latency_hist_p99(hist), hist->max_us);
+        out(ctx, line);
+    }
+#endif
+}
+
+static void report_log(void *ctx, const char *line) { LOG_INF("%s", line); }
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_EVENT_REPLAY_EXIT)
+static void exit_work_cb(struct k_work *work) { posix_exit(0); }
+
+static K_WORK_DELAYABLE_DEFINE(exit_work, exit_work_cb);
+#endif
+
+static void replay_finish(void) {
+    running = false;
+    report = (struct replay_report){
+        .events = next,
+        .duration_ms = k_uptime_get_32() - started_ms,
+        .frames = frames,
+        .flushes = flushes,
+        .bytes = panel_bytes() - bytes_at_start,
+        .display_cpu_us = (uint32_t)k_cyc_to_us_floor64(display_cycles() - cycles_at_start),
+    };
+    report_print(NULL, report_log);
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_EVENT_REPLAY_EXIT)
+    // Leave time for the last batch of deferred widgets before the process ends
+    k_work_schedule(&exit_work, K_MSEC(2 * CONFIG_DONGLE_SCREEN_COALESCE_MS + 100));
+#endif
+}
+
+static void step_work_cb(struct k_work *work) {
+    if (!running) {
+        return;
+    }
+    if (next >= record_count) {
+        replay_finish();
+        return;
+    }
+
+    replay_record(&records[next++]);
+    if (next >= record_count) {
+        // Let the display settle so the last update is part of the report
+        k_work_schedule(k_work_delayable_from_work(work), K_MSEC(500));
+        return;
+    }
+
+    const uint32_t delta = sys_le16_to_cpu(records[next].delta_ms);
+    k_work_schedule(k_work_delayable_from_work(work),
+                    speed ? K_MSEC(delta * 100 / speed) : K_NO_WAIT);
+}
+
+static K_WORK_DELAYABLE_DEFINE(step_work, step_work_cb);
+
+static int replay_start(const uint8_t *log, size_t len, uint16_t speed_percent) {
+    const struct event_log_header *header = (const struct event_log_header *)log;
+
+    if (len < sizeof(*header) || memcmp(header->magic, EVENT_LOG_MAGIC, 4) != 0 ||
+        header->version != EVENT_LOG_VERSION ||
+        header->record_size != sizeof(struct event_log_record)) {
+        return -EINVAL;
+    }
+    const uint16_t count = sys_le16_to_cpu(header->records);
+    if (len < sizeof(*header) + count * sizeof(struct event_log_record)) {
+        return -EINVAL;
+    }
+    if (running) {
+        return -EBUSY;
+    }
+
+    static bool hooked;
+    if (!hooked) {
+        // Queued before the first replayed event, so it runs before any frame of the replay
+        k_work_submit_to_queue(zmk_display_work_q(), &hook_work);
+        hooked = true;
+    }
+
+    records = (const struct event_log_record *)(header + 1);
+    record_count = count;
+    next = 0;
+    speed = speed_percent;
+    frames = 0;
+    flushes = 0;
+    bytes_at_start = panel_bytes();
+    cycles_at_start = display_cycles();
+    started_ms = k_uptime_get_32();
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_LATENCY_TRACE)
+    latency_trace_reset();
+#endif
+    running = true;
+
+    k_work_schedule(&step_work, K_NO_WAIT);
+    return 0;
+}
+
+#if CONFIG_DONGLE_SCREEN_EVENT_REPLAY_AUTOSTART_MS > 0
+static void autostart_work_cb(struct k_work *work) {
+    int err = replay_start(builtin_log, sizeof(builtin_log), 100);
+    if (err) {
+        LOG_ERR("Replay: no usable built-in event log (%d)", err);
+    }
+}
+
+static K_WORK_DELAYABLE_DEFINE(autostart_work, autostart_work_cb);
+
+static int replay_autostart(void) {
+    k_work_schedule(&autostart_work, K_MSEC(CONFIG_DONGLE_SCREEN_EVENT_REPLAY_AUTOSTART_MS));
+    return 0;
+}
+
+SYS_INIT(replay_autostart, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+#endif
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_SHELL)
+#include <zephyr/shell/shell.h>
+
+static void report_shell(void *ctx, const char *line) { shell_print(ctx, "%s", line); }
+
+static int cmd_replay_start(const struct shell *sh, size_t argc, char **argv) {
+    const uint16_t speed_percent = argc > 1 ? strtoul(argv[1], NULL, 10) : 100;
+
+    int err = replay_start(builtin_log, sizeof(builtin_log), speed_percent);
+    if (err == -EINVAL) {
+        shell_error(sh, "no usable event log, set CONFIG_DONGLE_SCREEN_EVENT_REPLAY_LOG");
+    } else if (err) {
+        shell_error(sh, "cannot start: %d", err);
+    }
+    return err;
+}
+
+static int cmd_replay_stop(const struct shell *sh, size_t argc, char **argv) {
+    if (running) {
+        k_work_cancel_delayable(&step_work);
+        replay_finish();
+    }
+    return 0;
+}
+
+static int cmd_replay_report(const struct shell *sh, size_t argc, char **argv) {
+    if (running) {
+        shell_print(sh, "replaying, %u of %u events", next, record_count);
+        return 0;
+    }
+    report_print((void *)sh, report_shell);
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(
+    replay_cmds,
+    SHELL_CMD_ARG(start, NULL, "Replay the built-in event log [speed in %, 0 = no gaps]",
+                  cmd_replay_start, 1, 1),
+    SHELL_CMD(stop, NULL, "Stop and report", cmd_replay_stop),
+    SHELL_CMD(report, NULL, "Report of the last replay", cmd_replay_report),
+    SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((dongle_screen), replay, &replay_cmds, "Replay recorded events", NULL, 2, 0);
+#endif
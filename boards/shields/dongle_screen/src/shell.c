@@ -0,0 +1,11 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/shell/shell.h>
+
+// Modules add their diagnostics with SHELL_SUBCMD_ADD((dongle_screen), ...)
+SHELL_SUBCMD_SET_CREATE(dongle_screen_cmds, (dongle_screen));
+SHELL_CMD_REGISTER(dongle_screen, &dongle_screen_cmds, "Dongle screen diagnostics", NULL);
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+#include <lvgl.h>
+#include <dt-bindings/zmk/hid_usage.h>
+#include <dt-bindings/zmk/hid_usage_pages.h>
+#include <zmk/endpoints.h>
+#include <zmk/hid_indicators.h>
+#include <zmk/keymap.h>
+#include <zmk/events/battery_state_changed.h>
+#include <zmk/events/keycode_state_changed.h>
+#include <zmk/events/wpm_state_changed.h>
+#if IS_ENABLED(CONFIG_ZMK_BLE)
+#include <zmk/ble.h>
+#endif
+
+#include <posix_board_if.h>
+
+#include "golden.h"
+#include "../emul/sh1106_emul.h"
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_PARTIAL_FLUSH)
+#include "../display/panel_flush.h"
+#endif
+
+/*
+ * Golden image test of the widgets, run by scripts/golden_test.py against
+ * the images in tests/widgets/golden. Every step raises the ZMK events that
+ * put one widget into one of its states, waits for the screen to settle and
+ * prints one line prefixed with "dongle_screen_golden ": the panel image as
+ * hex of PBM rows and what the transition cost, i.e. the pixels and GDDRAM
+ * bytes that changed, the bytes the emulator received and the bytes
+ * panel_flush sent. The script compares images and byte counts with the
+ * checked-in ones.
+ *
+ * Bytes that changed but were not sent, or a panel_flush count that differs
+ * from what reached the bus, fail the step here already. native_sim exits
+ * with the number of failed steps.
+ */
+
+// Longer than a coalescing window plus a frame, so every batch is on the panel
+#define SETTLE_MS (CONFIG_DONGLE_SCREEN_COALESCE_MS + CONFIG_DONGLE_SCREEN_FRAME_DEADLINE_MS + 50)
+
+#define MOD_CTRL  BIT(0)
+#define MOD_SHIFT BIT(1)
+#define MOD_ALT   BIT(2)
+#define MOD_GUI   BIT(3)
+
+#define LED_NUM    BIT(0)
+#define LED_CAPS   BIT(1)
+#define LED_SCROLL BIT(2)
+
+struct golden_step {
+    const char *name;
+    void (*apply)(int arg);
+    int arg;
+};
+
+static void set_nothing(int arg) {}
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_LAYER_ACTIVE)
+static void set_layer(int layer) {
+    for (int i = ZMK_KEYMAP_LAYERS_LEN - 1; i > 0; i--) {
+        if (i != layer) {
+            zmk_keymap_layer_deactivate(i);
+        }
+    }
+    if (layer > 0) {
+        zmk_keymap_layer_activate(layer);
+    }
+}
+#endif
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_MODIFIER_ACTIVE)
+static const uint32_t mod_keycodes[] = {
+    HID_USAGE_KEY_KEYBOARD_LEFTCONTROL,
+    HID_USAGE_KEY_KEYBOARD_LEFTSHIFT,
+    HID_USAGE_KEY_KEYBOARD_LEFTALT,
+    HID_USAGE_KEY_KEYBOARD_LEFT_GUI,
+};
+
+static void set_mods(int mods) {
+    static int held;
+
+    for (int i = 0; i < ARRAY_SIZE(mod_keycodes); i++) {
+        if ((held ^ mods) & BIT(i)) {
+            raise_zmk_keycode_state_changed((struct zmk_keycode_state_changed){
+                .usage_page = HID_USAGE_KEY,
+                .keycode = mod_keycodes[i],
+                .state = (mods & BIT(i)) != 0,
+                .timestamp = k_uptime_get(),
+            });
+        }
+    }
+    held = mods;
+}
+
+static void set_indicators(int leds) {
+    zmk_hid_indicators_set_profile(leds, zmk_endpoints_selected());
+}
+#endif
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_WPM_ACTIVE)
+static void set_wpm(int wpm) {
+    raise_zmk_wpm_state_changed((struct zmk_wpm_state_changed){.state = wpm});
+}
+#endif
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_BATTERY_ACTIVE)
+// Source in the upper byte, level in the lower one
+#define BATTERY(source, level) (((source) << 8) | (level))
+
+static void set_battery(int arg) {
+    raise_zmk_peripheral_battery_state_changed((struct zmk_peripheral_battery_state_changed){
+        .source = arg >> 8,
+        .state_of_charge = arg & 0xFF,
+    });
+}
+#endif
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_OUTPUT_ACTIVE)
+static void set_transport(int transport) { zmk_endpoints_select_transport(transport); }
+
+#if IS_ENABLED(CONFIG_ZMK_BLE)
+static void set_profile(int profile) { zmk_ble_prof_select(profile); }
+#endif
+#endif
+
+static const struct golden_step steps[] = {
+    {"boot", set_nothing, 0},
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_LAYER_ACTIVE)
+    {"layer_1", set_layer, 1},
+    {"layer_2", set_layer, 2},
+    {"layer_0", set_layer, 0},
+#endif
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_MODIFIER_ACTIVE)
+    {"modifier_ctrl", set_mods, MOD_CTRL},
+    {"modifier_ctrl_shift", set_mods, MOD_CTRL | MOD_SHIFT},
+    {"modifier_all", set_mods, MOD_CTRL | MOD_SHIFT | MOD_ALT | MOD_GUI},
+    {"modifier_gui", set_mods, MOD_GUI},
+    {"modifier_none", set_mods, 0},
+    {"modifier_caps", set_indicators, LED_CAPS},
+    {"modifier_locks", set_indicators, LED_CAPS | LED_NUM | LED_SCROLL},
+    {"modifier_locks_ctrl", set_mods, MOD_CTRL},
+    {"modifier_locks_off", set_indicators, 0},
+    {"modifier_off", set_mods, 0},
+#endif
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_WPM_ACTIVE)
+    {"wpm_slow", set_wpm, 42},
+    {"wpm_medium", set_wpm, 120},
+    {"wpm_fast", set_wpm, 180},
+    {"wpm_0", set_wpm, 0},
+#endif
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_BATTERY_ACTIVE)
+    {"battery_0_full", set_battery, BATTERY(0, 100)},
+    {"battery_0_half", set_battery, BATTERY(0, 50)},
+    {"battery_0_low", set_battery, BATTERY(0, 20)},
+    {"battery_0_critical", set_battery, BATTERY(0, 5)},
+    {"battery_1_full", set_battery, BATTERY(1, 100)},
+    {"battery_0_disconnected", set_battery, BATTERY(0, 0)},
+    {"battery_0_reconnected", set_battery, BATTERY(0, 80)},
+#endif
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_OUTPUT_ACTIVE)
+#if IS_ENABLED(CONFIG_ZMK_BLE)
+    {"output_ble", set_transport, ZMK_TRANSPORT_BLE},
+    {"output_ble_1", set_profile, 1},
+    {"output_ble_2", set_profile, 2},
+    {"output_ble_3", set_profile, 3},
+    {"output_ble_4", set_profile, 4},
+    {"output_ble_0", set_profile, 0},
+#endif
+#if IS_ENABLED(CONFIG_ZMK_USB)
+    {"output_usb", set_transport, ZMK_TRANSPORT_USB},
+#endif
+#endif
+};
+
+static int next;
+static int failures;
+
+static uint32_t panel_flush_bytes(void) {
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_PARTIAL_FLUSH)
+    struct panel_flush_stats stats;
+    panel_flush_get_stats(&stats);
+    return stats.bytes_written;
+#else
+    return 0;
+#endif
+}
+
+static void print_image(const struct emul *target, int width, int height) {
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x += 8) {
+            uint8_t byte = 0;
+            for (int i = 0; i < 8 && x + i < width; i++) {
+                if (sh1106_emul_panel_pixel(target, x + i, y)) {
+                    byte |= BIT(7 - i);
+                }
+            }
+            printk("%02x", byte);
+        }
+    }
+}
+
+static void capture(const struct golden_step *step) {
+    static uint32_t flushed_before;
+    const struct emul *target = EMUL_DT_GET(DT_CHOSEN(zephyr_display));
+    struct sh1106_emul_transition transition;
+    const uint32_t flushed_now = panel_flush_bytes();
+    const uint32_t flushed = flushed_now - flushed_before;
+    const char *error = NULL;
+    int width, height;
+
+    flushed_before = flushed_now;
+    sh1106_emul_checkpoint(target, &transition);
+    sh1106_emul_panel_size(target, &width, &height);
+
+    if (transition.bytes_written < transition.bytes_changed) {
+        error = "changed bytes were not sent";
+    } else if (IS_ENABLED(CONFIG_DONGLE_SCREEN_PARTIAL_FLUSH) &&
+               flushed != transition.bytes_written) {
+        error = "panel_flush count differs from the bus";
+    }
+    if (error) {
+        failures++;
+    }
+
+    printk("dongle_screen_golden {\"step\":\"%s\",\"pixels\":%u,\"bytes_changed\":%u,"
+           "\"bytes_written\":%u,\"flushed\":%u,\"error\":\"%s\",\"width\":%d,\"height\":%d,"
+           "\"image\":\"",
+           step->name, transition.pixels_changed, transition.bytes_changed,
+           transition.bytes_written, flushed, error ? error : "", width, height);
+    print_image(target, width, height);
+    printk("\"}\n");
+}
+
+static void step_work_cb(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(step_work, step_work_cb);
+
+static void capture_work_cb(struct k_work *work) {
+    capture(&steps[next++]);
+
+    if (next < ARRAY_SIZE(steps)) {
+        k_work_schedule(&step_work, K_NO_WAIT);
+        return;
+    }
+
+    printk("dongle_screen_golden_done {\"steps\":%d,\"failures\":%d}\n", next, failures);
+    posix_exit(failures);
+}
+
+static K_WORK_DELAYABLE_DEFINE(capture_work, capture_work_cb);
+
+static void step_work_cb(struct k_work *work) {
+    steps[next].apply(steps[next].arg);
+    k_work_schedule(&capture_work, K_MSEC(SETTLE_MS));
+}
+
+void golden_test_start(void) {
+    // Runs after ZMK loaded the screen, the first step captures the boot image
+    k_work_schedule(&step_work, K_MSEC(SETTLE_MS));
+}
@@ -4,7 +4,7 @@
  * SPDX-License-Identifier: MIT
  */
 
-#include <stdlib.h>
+#include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/bluetooth/services/bas.h>
 
@@ -20,8 +20,11 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/usb.h>
 
 #include "battery_status.h"
+#include "widget_listener.h"
+#include "widget_registry.h"
+#include "../display/screen_power.h"
 #include <util.h>
-#include <dimensions.h>
+#include <layout.h>
 
 #if IS_ENABLED(CONFIG_ZMK_DONGLE_DISPLAY_DONGLE_BATTERY)
     #define SOURCE_OFFSET 1
@@ -34,13 +37,53 @@ static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
 #define BORDER_SZ   1
 #define CONTACT_L   3
 
-static int battery_h;
-static int battery_w;
-static int nrg_meter_h;
-static int nrg_meter_w;
-static int label_max_w;
-static int label_h;
+/*
+ * All batteries are drawn by one object into cells of a grid that is fixed
+ * at build time. Cells narrower than BAT_CELL_MIN_W don't fit the level
+ * text, so with many peripherals the cells wrap into further rows. The level
+ * sits above the battery when the cell is tall enough for both, else beside
+ * it, in the 8 px font when the cell is lower than a line of the 12 px one.
+ */
+#define BAT_CELL_MIN_W 32
+#define BAT_COLS       CLAMP(LAYOUT_BATTERY_W / BAT_CELL_MIN_W, 1, BAT_COUNT)
+#define BAT_ROWS       DIV_ROUND_UP(BAT_COUNT, BAT_COLS)
+#define BAT_CELL_W     (LAYOUT_BATTERY_W / BAT_COLS)
+#define BAT_CELL_H     (LAYOUT_BATTERY_H / BAT_ROWS)
+
+// Two border rows and enough meter rows to tell the level apart
+#define BAT_SHELL_MIN_H 6
+
+// Upper bounds of the line heights of the level fonts, checked at init
+#define BAT_FONT_12_H 15
+#define BAT_FONT_8_H  10
+
+#if !IS_ENABLED(CONFIG_DONGLE_SCREEN_BATTERY_VERTICAL) &&                                       \
+    BAT_CELL_H >= BAT_FONT_12_H + BAT_SHELL_MIN_H
+#define BAT_LABEL_BESIDE 0
+#define BAT_FONT         lv_font_montserrat_12
+#define BAT_LABEL_H      BAT_FONT_12_H
+#elif BAT_CELL_H >= BAT_FONT_12_H
+#define BAT_LABEL_BESIDE 1
+#define BAT_FONT         lv_font_montserrat_12
+#define BAT_LABEL_H      BAT_FONT_12_H
+#else
+#define BAT_LABEL_BESIDE 1
+#define BAT_FONT         lv_font_montserrat_8
+#define BAT_LABEL_H      BAT_FONT_8_H
+#endif
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_BATTERY_VERTICAL)
+#define BAT_MIN_CELL_H MAX(BAT_LABEL_H, CONTACT_L + BAT_SHELL_MIN_H)
+#elif BAT_LABEL_BESIDE
+#define BAT_MIN_CELL_H MAX(BAT_LABEL_H, BAT_SHELL_MIN_H)
+#else
+#define BAT_MIN_CELL_H (BAT_LABEL_H + BAT_SHELL_MIN_H)
+#endif
+
+BUILD_ASSERT(BAT_CELL_H >= BAT_MIN_CELL_H,
+             "battery cells are too low for the level and the battery, disable a widget");
 
+// Parts of a battery, relative to the top left corner of its cell
 static lv_area_t label_coords;
 static lv_area_t shell_coords;
 static lv_area_t meter_coords;
@@ -51,6 +94,9 @@ static lv_draw_rect_dsc_t rect_shell;
 static lv_draw_rect_dsc_t rect_meter;
 static lv_draw_rect_dsc_t rect_contact;
 
+// Draw tasks keep a pointer to the text until the frame is rendered
+static char level_text[BAT_COUNT][4];
+
 static void init_descriptors(void) {
     lv_draw_rect_dsc_init(&rect_shell);
     rect_shell.bg_color = LVGL_BACKGROUND;
@@ -70,47 +116,66 @@ static void init_descriptors(void) {
     rect_contact.border_side = LV_BORDER_SIDE_FULL;
         
     lv_draw_label_dsc_init(&label_dsc);
-    label_dsc.font = &lv_font_montserrat_12;
+    label_dsc.font = &BAT_FONT;
+    label_dsc.align = LV_TEXT_ALIGN_CENTER;
+}
 
+static void set_area(lv_area_t *area, int32_t x, int32_t y, int32_t w, int32_t h) {
+    lv_area_set(area, x, y, x + w - 1, y + h - 1);
 }
 
-static void calc_battery_dimensions(lv_obj_t *obj, lv_point_t size) {
-    const lv_font_t *font = label_dsc.font ? label_dsc.font : lv_theme_get_font_normal(obj);
-    label_h = font->line_height;
-#ifdef CONFIG_DONGLE_SCREEN_BATTERY_VERTICAL
-    battery_h = size.y - CONTACT_L;
-    battery_w = battery_h / 2;
-#else
-    battery_w = (size.x / BAT_COUNT) - CONTACT_L;
-    battery_h = battery_w / 2;
-    battery_h = (size.y - label_h) > battery_h ? battery_h : size.y - label_h;
-#endif
-    nrg_meter_w = battery_w - BORDER_SZ * 2;
-    nrg_meter_h = battery_h - BORDER_SZ * 2;
-#ifdef CONFIG_DONGLE_SCREEN_BATTERY_VERTICAL
-    label_max_w = (size.x / BAT_COUNT) - battery_w;
+static void calc_battery_dimensions(void) {
+    const int32_t label_h = label_dsc.font->line_height;
+    int32_t battery_w;
+    int32_t battery_h;
+
+    if (label_h > BAT_LABEL_H) {
+        LOG_WRN("Battery level font is %d px high, the layout assumes %d", label_h, BAT_LABEL_H);
+    }
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_BATTERY_VERTICAL)
+    // Contact on top and the level right of the battery
+    battery_h = BAT_CELL_H - CONTACT_L;
+    battery_w = MIN(battery_h / 2, BAT_CELL_W / 2);
+    set_area(&label_coords, battery_w, (BAT_CELL_H - label_h) / 2, BAT_CELL_W - battery_w,
+             label_h);
+    set_area(&contact_coords, battery_w / 4, 0, battery_w - battery_w / 2, CONTACT_L);
+    set_area(&shell_coords, 0, CONTACT_L, battery_w, battery_h);
+#elif BAT_LABEL_BESIDE
+    // Battery with its contact to the left in the left half, the level right of it
+    battery_w = BAT_CELL_W / 2 - CONTACT_L;
+    battery_h = MIN(battery_w / 2, BAT_CELL_H);
+    const int32_t battery_y = (BAT_CELL_H - battery_h) / 2;
+    set_area(&label_coords, BAT_CELL_W / 2, (BAT_CELL_H - label_h) / 2, BAT_CELL_W - BAT_CELL_W / 2,
+             label_h);
+    set_area(&contact_coords, 0, battery_y + battery_h / 4, CONTACT_L, battery_h - battery_h / 2);
+    set_area(&shell_coords, CONTACT_L, battery_y, battery_w, battery_h);
 #else
-    label_max_w = (size.x / BAT_COUNT);
+    // Level on top and the battery below with its contact to the left
+    battery_w = BAT_CELL_W - CONTACT_L;
+    battery_h = MIN(battery_w / 2, BAT_CELL_H - label_h);
+    set_area(&label_coords, 0, 0, BAT_CELL_W, label_h);
+    set_area(&contact_coords, 0, label_h + battery_h / 4, CONTACT_L, battery_h - battery_h / 2);
+    set_area(&shell_coords, CONTACT_L, label_h, battery_w, battery_h);
 #endif
+    meter_coords = shell_coords;
+    lv_area_increase(&meter_coords, -BORDER_SZ, -BORDER_SZ);
 }
 
-static lv_coord_t *widget_row_dsc;
-static lv_coord_t *widget_col_dsc;
+static void cell_area(lv_obj_t *obj, uint8_t source, lv_area_t *area) {
+    lv_area_t coords;
 
+    lv_obj_get_coords(obj, &coords);
+    set_area(area, coords.x1 + (source % BAT_COLS) * BAT_CELL_W,
+             coords.y1 + (source / BAT_COLS) * BAT_CELL_H, BAT_CELL_W, BAT_CELL_H);
+}
+
+// Last reported level of every source, -1 until a source reports
 struct battery_state {
-    uint8_t source;
-    uint8_t level;
+    int8_t level[BAT_COUNT];
     bool usb_present;
 };
 
-struct battery_object {
-    bool *initialized;
-    uint8_t *buffer;
-    lv_obj_t *canvas;
-    lv_layer_t *bat_layer;
-    lv_layer_t *text_layer;
-} battery_objects[BAT_COUNT];
-
 // Peripheral reconnection tracking
 // ZMK sends battery events with level < 1 when peripherals disconnect
 static int8_t last_battery_levels[BAT_COUNT];
@@ -142,177 +207,166 @@ static bool is_peripheral_reconnecting(uint8_t source, uint8_t new_level) {
     return reconnecting;
 }
 
-static void draw_battery(struct battery_state state, struct battery_object battery) {
-    if (!battery.canvas) return;
-    lv_color_t meter_color;
-    lv_color_t text_color;
-    char level_str[4];
+static bool battery_state_eq(const struct battery_state *a, const struct battery_state *b) {
+    return memcmp(a->level, b->level, sizeof(a->level)) == 0 && a->usb_present == b->usb_present;
+}
+
+static void offset_area(lv_area_t *out, const lv_area_t *in, const lv_area_t *cell) {
+    *out = *in;
+    lv_area_move(out, cell->x1, cell->y1);
+}
+
+// Clips a part to its cell, false if nothing of it is left
+static bool clip_to_cell(lv_area_t *area, const lv_area_t *cell) {
+    const lv_area_t part = *area;
+
+    return lv_area_intersect(area, &part, cell);
+}
+
+static void draw_battery(lv_layer_t *layer, const lv_area_t *cell, uint8_t source) {
+    const int8_t level = last_battery_levels[source];
+    lv_area_t area;
 
-    if (!battery.text_layer) lv_canvas_init_layer(battery.text_layer);
-    if (!battery.bat_layer) lv_canvas_init_layer(battery.bat_layer);
+    if (level < 0) {
+        // Not reported yet
+        return;
+    }
 
-    int text_y = (lv_obj_get_height(battery.canvas) - label_h) / 2;
 #ifdef MONOCHROME
-    meter_color = LVGL_FOREGROUND;
-    text_color = LVGL_FOREGROUND;
+    rect_meter.bg_color = LVGL_FOREGROUND;
+    label_dsc.color = LVGL_FOREGROUND;
 #else 
-    if (state.level > 30) {
-        meter_color = lv_palette_main(LV_PALETTE_GREEN);
-        text_color = LVGL_FOREGROUND;
-    } else if (state.level > 10) {
-        meter_color = lv_palette_main(LV_PALETTE_YELLOW);
-        text_color = LVGL_FOREGROUND;
+    if (level > 30) {
+        rect_meter.bg_color = lv_palette_main(LV_PALETTE_GREEN);
+        label_dsc.color = LVGL_FOREGROUND;
+    } else if (level > 10) {
+        rect_meter.bg_color = lv_palette_main(LV_PALETTE_YELLOW);
+        label_dsc.color = LVGL_FOREGROUND;
     } else {
-        meter_color = lv_palette_main(LV_PALETTE_RED);
-        text_color = lv_palette_main(LV_PALETTE_RED);
+        rect_meter.bg_color = lv_palette_main(LV_PALETTE_RED);
+        label_dsc.color = lv_palette_main(LV_PALETTE_RED);
     }
 #endif
-    rect_meter.bg_color = meter_color;
-    label_dsc.color = text_color;
 
-    int len = snprintf(level_str, sizeof(level_str), "%d", state.level);
-    if (len < 0 || len >= sizeof(level_str) || state.level < 1 || state.level > 100) {
-        strcpy(level_str, "X");
+    if (level < 1 || level > 100) {
+        strcpy(level_text[source], "X");
+    } else {
+        snprintf(level_text[source], sizeof(level_text[source]), "%d", level);
     }
-    label_dsc.text = level_str;
-
-    lv_canvas_fill_bg(battery.canvas, LVGL_BACKGROUND, LV_OPA_COVER);
-
-    // Fill energy meter
-    const int meter_width = LV_CLAMP(0, (nrg_meter_w * state.level + 50) / 100, nrg_meter_w);
-    const int meter_height = LV_CLAMP(0, (nrg_meter_h * state.level + 50) / 100, nrg_meter_h);
-#ifdef CONFIG_DONGLE_SCREEN_BATTERY_VERTICAL
-    label_coords = {
-        battery_w, 
-        text_y,
-        battery_w + label_max_w,
-        text_y + label_h };
-
-    if (state.level < 1 || state.level > 100) return;
-    contact_coords = {
-        0, 
-        0,
-        battery_w,
-        CONTACT_L};
-    
-    shell_coords = {
-        0, 
-        CONTACT_L,
-        battery_w,
-        battery_h };
-
-    meter_coords = {
-        BORDER_SZ, 
-        CONTACT_L + battery_h - BORDER_SZ - meter_height,
-        nrg_meter_w,
-        meter_height};
+    label_dsc.text = level_text[source];
+    offset_area(&area, &label_coords, cell);
+    if (clip_to_cell(&area, cell)) {
+        lv_draw_label(layer, &label_dsc, &area);
+    }
+
+    if (level < 1 || level > 100 || lv_area_get_height(&shell_coords) < 3) {
+        return;
+    }
+
+    offset_area(&area, &contact_coords, cell);
+    if (clip_to_cell(&area, cell)) {
+        lv_draw_rect(layer, &rect_contact, &area);
+    }
+    offset_area(&area, &shell_coords, cell);
+    if (clip_to_cell(&area, cell)) {
+        lv_draw_rect(layer, &rect_shell, &area);
+    }
+
+    // The meter fills from the end opposite the contact
+    offset_area(&area, &meter_coords, cell);
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_BATTERY_VERTICAL)
+    area.y1 = area.y2 + 1 - (lv_area_get_height(&meter_coords) * level + 50) / 100;
 #else
-    label_coords = {
-        0, 
-        0,
-        label_max_w,
-        label_h };
-    
-    if (state.level < 1 || state.level > 100 || battery_h < 3 ) return;
-    if () return;
-    contact_coords = {
-        0, 
-        label_h,
-        CONTACT_L,
-        battery_h};
-    
-    shell_coords = {
-        CONTACT_L, 
-        label_h,
-        battery_w,
-        battery_h };
-
-    meter_coords = {
-        CONTACT_L + battery_w - BORDER_SZ - meter_width, 
-        label_h + BORDER_SZ,
-        meter_width,
-        nrg_meter_h};
+    area.x1 = area.x2 + 1 - (lv_area_get_width(&meter_coords) * level + 50) / 100;
 #endif
+    if (clip_to_cell(&area, cell)) {
+        lv_draw_rect(layer, &rect_meter, &area);
+    }
+}
 
-    lv_draw_label(battery.text_layer, battery.label, &draw_coords);
-    lv_canvas_finish_layer(battery.canvas, battery.text_layer);
+static void battery_draw_cb(lv_event_t *e) {
+    lv_obj_t *obj = lv_event_get_target(e);
+    lv_layer_t *layer = lv_event_get_layer(e);
 
-    lv_draw_rect(battery.bat_layer, &rect_contact, &contact_coords);
-    lv_draw_rect(battery.bat_layer, &rect_shell, &shell_coords);
-    lv_draw_rect(battery.bat_layer, &rect_meter, &meter_coords);
-    lv_canvas_finish_layer(battery.canvas,battery.bat_layer);
+    for (uint8_t source = 0; source < BAT_COUNT; source++) {
+        lv_area_t cell;
 
-    
+        // Every part is clipped to its cell, as only that cell is invalidated on a
+        // change. LVGL drops the parts outside the area it is redrawing.
+        cell_area(obj, source, &cell);
+        draw_battery(layer, &cell, source);
+    }
 }
 
-static void set_battery_symbol(lv_obj_t *widget, struct battery_state state) {
-    if (state.source >= BAT_COUNT) {
-        return;
-    }
-    
+static void set_battery_symbol(uint8_t source, uint8_t level, bool usb_present) {
     // Check for reconnection using the existing battery level mechanism
-    bool reconnecting = is_peripheral_reconnecting(state.source, state.level);
+    bool reconnecting = is_peripheral_reconnecting(source, level);
     
     // Update our tracking
-    last_battery_levels[state.source] = state.level;
+    last_battery_levels[source] = level;
 
 
     // Wake screen on reconnection
     if (reconnecting) {
 #if CONFIG_DONGLE_SCREEN_IDLE_TIMEOUT_S > 0    
         LOG_INF("Peripheral %d reconnected (battery: %d%%), requesting screen wake", 
-                state.source, state.level);
+                source, level);
+        screen_power_notify_activity();
 #else 
         LOG_INF("Peripheral %d reconnected (battery: %d%%)", 
-                state.source, state.level);
+                source, level);
 #endif
     }
 
 
-    LOG_DBG("source: %d, level: %d, usb: %d", state.source, state.level, state.usb_present);
-    lv_obj_t *canvas = battery_objects[state.source].canvas;
-
-    draw_battery(state, battery_objects[state.source]);
-    
-    lv_obj_clear_flag(canvas, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_move_foreground(canvas);
+    LOG_DBG("source: %d, level: %d, usb: %d", source, level, usb_present);
 
-}
-
-void battery_status_update_cb(struct battery_state state) {
     struct zmk_widget_dongle_battery_status *widget;
-    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_battery_symbol(widget->obj, state); }
-}
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+        lv_area_t cell;
 
-static struct battery_state peripheral_battery_status_get_state(const zmk_event_t *eh) {
-    const struct zmk_peripheral_battery_state_changed *ev = as_zmk_peripheral_battery_state_changed(eh);
-    return (struct battery_state){
-        .source = ev->source + SOURCE_OFFSET,
-        .level = ev->state_of_charge,
-    };
+        cell_area(widget->obj, source, &cell);
+        lv_obj_invalidate_area(widget->obj, &cell);
+    }
 }
 
-static struct battery_state central_battery_status_get_state(const zmk_event_t *eh) {
-    const struct zmk_battery_state_changed *ev = as_zmk_battery_state_changed(eh);
-    return (struct battery_state) {
-        .source = 0,
-        .level = (ev != NULL) ? ev->state_of_charge : zmk_battery_state_of_charge(),
-#if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
-        .usb_present = zmk_usb_is_powered(),
-#endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
-    };
+static void battery_status_update_cb(struct battery_state state) {
+    // Updates may be coalesced, so redraw every source whose level moved
+    for (uint8_t source = 0; source < BAT_COUNT; source++) {
+        if (state.level[source] < 0 || state.level[source] == last_battery_levels[source]) {
+            continue;
+        }
+        set_battery_symbol(source, state.level[source], state.usb_present);
+    }
 }
 
+static struct battery_state reported = {.level = {[0 ... BAT_COUNT - 1] = -1}};
+
+// Called with the listener lock held, which also guards the reported levels
 static struct battery_state battery_status_get_state(const zmk_event_t *eh) { 
-    if (as_zmk_peripheral_battery_state_changed(eh) != NULL) {
-        return peripheral_battery_status_get_state(eh);
-    } else {
-        return central_battery_status_get_state(eh);
+    const struct zmk_peripheral_battery_state_changed *ev =
+        as_zmk_peripheral_battery_state_changed(eh);
+
+    if (ev != NULL) {
+        if (ev->source + SOURCE_OFFSET < BAT_COUNT) {
+            reported.level[ev->source + SOURCE_OFFSET] = ev->state_of_charge;
+        }
+        return reported;
     }
+
+#if IS_ENABLED(CONFIG_ZMK_DONGLE_DISPLAY_DONGLE_BATTERY)
+    const struct zmk_battery_state_changed *central = as_zmk_battery_state_changed(eh);
+    reported.level[0] = (central != NULL) ? central->state_of_charge : zmk_battery_state_of_charge();
+#if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
+    reported.usb_present = zmk_usb_is_powered();
+#endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
+#endif
+    return reported;
 }
 
-ZMK_DISPLAY_WIDGET_LISTENER(widget_dongle_battery_status, struct battery_state,
-                            battery_status_update_cb, battery_status_get_state)
+DONGLE_SCREEN_WIDGET_LISTENER(widget_dongle_battery_status, struct battery_state,
+                              battery_status_update_cb, battery_status_get_state, battery_state_eq,
+                              WIDGET_PRIORITY_DEFERRED)
 
 ZMK_SUBSCRIPTION(widget_dongle_battery_status, zmk_peripheral_battery_state_changed);
 
@@ -329,47 +383,13 @@ ZMK_SUBSCRIPTION(widget_dongle_battery_status, zmk_usb_conn_state_changed);
 int zmk_widget_dongle_battery_status_init(struct zmk_widget_dongle_battery_status *widget, lv_obj_t *parent, lv_point_t size) {
 
     init_descriptors();
-    calc_battery_dimensions(parent,size);
-    
-    widget_row_dsc = malloc(2 * sizeof(lv_coord_t));
-    if (!widget_row_dsc) {
-        LV_LOG_ERROR("Memory allocation failed!");
-        free(widget_row_dsc);
-        return -1;
-    }
-    widget_row_dsc[0] = size.y;
-    widget_row_dsc[1] = LV_GRID_TEMPLATE_LAST;
-
-    widget_col_dsc = malloc((BAT_COUNT + 1) * sizeof(lv_coord_t));
-    if (!widget_col_dsc) {
-        LV_LOG_ERROR("Memory allocation failed!");
-        free(widget_col_dsc);
-        return -1;
-    }
-    for (uint8_t i = 0; i < BAT_COUNT; i++) {
-        widget_col_dsc[i] = size.x / BAT_COUNT; 
-    }
-    widget_col_dsc[BAT_COUNT] = LV_GRID_TEMPLATE_LAST;  // Terminator
-    
+    calc_battery_dimensions();
+
+    // A plain object drawing every battery itself, no canvas or buffer per source
     widget->obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(widget->obj);
     lv_obj_set_size(widget->obj, size.x, size.y);
-    lv_obj_set_layout(widget->obj, LV_LAYOUT_GRID);
-    lv_obj_set_style_grid_column_dsc_array(widget->obj, widget_col_dsc, 0);
-    lv_obj_set_style_grid_row_dsc_array(widget->obj, widget_row_dsc, 0);
-
-    for (int i = 0; i < BAT_COUNT; i++) {
-        struct battery_object *battery = &battery_objects[i];
-        LV_DRAW_BUF_DEFINE_STATIC(battery->buffer, size.x / BAT_COUNT, size.y, LV_COLOR_FORMAT_NATIVE);
-        LV_DRAW_BUF_INIT_STATIC(battery->buffer);
-        
-        battery->canvas = lv_canvas_create(widget->obj);
-        lv_canvas_set_draw_buf(battery->canvas, battery->buffer);
-        
-        lv_obj_set_grid_cell(battery->canvas, LV_GRID_ALIGN_CENTER, i, 1,
-                            LV_GRID_ALIGN_CENTER, 0, 1);
-
-        lv_obj_add_flag(battery->canvas, LV_OBJ_FLAG_HIDDEN);
-    }
+    lv_obj_add_event_cb(widget->obj, battery_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
 
     sys_slist_append(&widgets, &widget->node);
 
@@ -383,4 +403,8 @@ int zmk_widget_dongle_battery_status_init(struct zmk_widget_dongle_battery_statu
 
 lv_obj_t *zmk_widget_dongle_battery_status_obj(struct zmk_widget_dongle_battery_status *widget) {
     return widget->obj;
-}
\ No newline at end of file
+}
+
+DONGLE_SCREEN_WIDGET_DEFINE(battery, BATTERY, struct zmk_widget_dongle_battery_status,
+                            zmk_widget_dongle_battery_status_init,
+                            zmk_widget_dongle_battery_status_obj, widget_dongle_battery_status)
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+
+#include "icon_row.h"
+#include <util.h>
+
+lv_obj_t *icon_row_create(struct icon_row *row, lv_obj_t *parent, lv_point_t size,
+                          uint8_t count, lv_flex_align_t align, int32_t gap)
+{
+    __ASSERT(count <= ICON_ROW_MAX_SLOTS, "Too many icon slots");
+
+    row->obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(row->obj);
+    lv_obj_set_size(row->obj, size.x, size.y);
+    lv_obj_set_flex_flow(row->obj, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(row->obj, align, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    lv_obj_set_style_pad_column(row->obj, gap, 0);
+
+    row->count = count;
+    for (int i = 0; i < count; i++) {
+        row->slots[i] = lv_image_create(row->obj);
+        // Atlas entries are A1 masks drawn in the recolor color
+        lv_obj_set_style_image_recolor(row->slots[i], LVGL_FOREGROUND, 0);
+        lv_obj_set_style_image_recolor_opa(row->slots[i], LV_OPA_COVER, 0);
+        lv_obj_add_flag(row->slots[i], LV_OBJ_FLAG_HIDDEN);
+        row->shown[i] = NULL;
+    }
+
+    return row->obj;
+}
+
+void icon_row_set(struct icon_row *row, const lv_image_dsc_t *const *icons, uint8_t n)
+{
+    for (int i = 0; i < row->count; i++) {
+        const lv_image_dsc_t *icon = i < n ? icons[i] : NULL;
+
+        if (icon == row->shown[i]) {
+            continue;
+        }
+        if (icon) {
+            lv_image_set_src(row->slots[i], icon);
+            lv_obj_remove_flag(row->slots[i], LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_add_flag(row->slots[i], LV_OBJ_FLAG_HIDDEN);
+        }
+        row->shown[i] = icon;
+    }
+}
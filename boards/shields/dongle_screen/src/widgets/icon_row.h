@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <lvgl.h>
+
+#define ICON_ROW_MAX_SLOTS 7
+
+/*
+ * A row of image slots showing icon atlas entries. Changing a symbol only
+ * repoints an lv_image at another prerendered entry.
+ */
+struct icon_row
+{
+    lv_obj_t *obj;
+    lv_obj_t *slots[ICON_ROW_MAX_SLOTS];
+    const lv_image_dsc_t *shown[ICON_ROW_MAX_SLOTS];
+    uint8_t count;
+};
+
+lv_obj_t *icon_row_create(struct icon_row *row, lv_obj_t *parent, lv_point_t size,
+                          uint8_t count, lv_flex_align_t align, int32_t gap);
+void icon_row_set(struct icon_row *row, const lv_image_dsc_t *const *icons, uint8_t n);
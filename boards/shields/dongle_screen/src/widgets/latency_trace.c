@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <lvgl.h>
+
+#include "latency_trace.h"
+#include "widget_listener.h"
+#include "../display/screen_power.h"
+
+/*
+ * Event receipt and the widget update are stamped by the widget listener,
+ * the render and flush stages come from the events LVGL sends on the
+ * display. All stamps use the cycle counter, so the numbers of hardware and
+ * native_sim builds are comparable. Everything but the receipt stamp runs
+ * on the display work queue.
+ */
+
+static struct {
+    uint32_t render_start;
+    uint32_t render_end;
+    uint32_t flush_end;
+    bool rendered;
+    bool flushed;
+} frame;
+
+static inline uint32_t elapsed_us(uint32_t from, uint32_t to) {
+    return k_cyc_to_us_floor32(to - from);
+}
+
+static int bucket_of(uint32_t us) {
+    if (us < 2) {
+        return us;
+    }
+    const int octave = 31 - __builtin_clz(us);
+    const int half = (us >> (octave - 1)) & 1;
+    return MIN(2 * octave + half, LATENCY_BUCKETS - 1);
+}
+
+static uint32_t bucket_upper_us(int bucket) {
+    if (bucket < 2) {
+        return bucket;
+    }
+    const int octave = bucket / 2;
+    return (1U << octave) + (bucket % 2 + 1) * (1U << (octave - 1)) - 1;
+}
+
+static void hist_add(struct latency_hist *hist, uint32_t us) {
+    if (hist->count == 0 || us < hist->min_us) {
+        hist->min_us = us;
+    }
+    hist->max_us = MAX(hist->max_us, us);
+    hist->total_us += us;
+    hist->count++;
+
+    uint16_t *bucket = &hist->buckets[bucket_of(us)];
+    if (*bucket < UINT16_MAX) {
+        (*bucket)++;
+    }
+}
+
+uint32_t latency_hist_p99(const struct latency_hist *hist) {
+    const uint32_t rank = DIV_ROUND_UP(hist->count * 99, 100);
+    uint32_t seen = 0;
+
+    for (int i = 0; i < LATENCY_BUCKETS; i++) {
+        seen += hist->buckets[i];
+        if (seen >= rank) {
+            return MIN(bucket_upper_us(i), hist->max_us);
+        }
+    }
+    return hist->max_us;
+}
+
+void latency_trace_updated(struct widget_trace *trace, uint32_t received_at) {
+    // Nothing reaches the panel while it is off
+    if (!screen_power_is_on()) {
+        return;
+    }
+    // Keep the oldest receipt if the previous update has not reached the panel yet
+    if (!trace->armed) {
+        trace->received_at = received_at;
+    }
+    trace->updated_at = k_cycle_get_32();
+    trace->armed = true;
+}
+
+static void frame_done(void) {
+    struct widget_listener *listener;
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&widget_listeners, listener, node) {
+        struct widget_trace *trace = &listener->trace;
+        if (!trace->armed) {
+            continue;
+        }
+        trace->armed = false;
+
+        struct latency_hist *hist = trace->hist;
+        hist_add(&hist[LATENCY_UPDATE], elapsed_us(trace->received_at, trace->updated_at));
+        hist_add(&hist[LATENCY_RENDER_START], elapsed_us(trace->received_at, frame.render_start));
+        hist_add(&hist[LATENCY_RENDER_END], elapsed_us(trace->received_at, frame.render_end));
+        hist_add(&hist[LATENCY_FLUSH], elapsed_us(trace->received_at, frame.flush_end));
+    }
+}
+
+static void display_event_cb(lv_event_t *e) {
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_REFR_START:
+        frame.rendered = false;
+        frame.flushed = false;
+        break;
+    case LV_EVENT_RENDER_START:
+        if (!frame.rendered) {
+            frame.render_start = k_cycle_get_32();
+            frame.rendered = true;
+        }
+        break;
+    case LV_EVENT_RENDER_READY:
+        frame.render_end = k_cycle_get_32();
+        break;
+    case LV_EVENT_FLUSH_FINISH:
+        frame.flush_end = k_cycle_get_32();
+        frame.flushed = true;
+        break;
+    case LV_EVENT_REFR_READY:
+        // Updates that invalidated nothing stay armed until a frame is sent
+        if (frame.flushed) {
+            frame_done();
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void latency_trace_reset(void) {
+    struct widget_listener *listener;
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&widget_listeners, listener, node) {
+        memset(listener->trace.hist, 0, sizeof(listener->trace.hist));
+    }
+}
+
+int latency_trace_init(void) {
+    lv_display_t *disp = lv_display_get_default();
+    if (disp == NULL) {
+        return -ENODEV;
+    }
+    lv_display_add_event_cb(disp, display_event_cb, LV_EVENT_ALL, NULL);
+    return 0;
+}
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_SHELL)
+#include <zephyr/shell/shell.h>
+
+static const char *const stage_names[LATENCY_STAGE_COUNT] = {"update", "render start",
+                                                              "render end", "flush"};
+
+static int cmd_latency(const struct shell *sh, size_t argc, char **argv) {
+    struct widget_listener *listener;
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&widget_listeners, listener, node) {
+        shell_print(sh, "%s", listener->name);
+        shell_print(sh, "  %-14s %8s %8s %8s %8s %8s", "stage", "count", "min us", "avg us",
+                    "p99 us", "max us");
+        for (int i = 0; i < LATENCY_STAGE_COUNT; i++) {
+            const struct latency_hist *hist = &listener->trace.hist[i];
+            shell_print(sh, "  %-14s %8u %8u %8u %8u %8u", stage_names[i], hist->count,
+                        hist->min_us, hist->count ? (uint32_t)(hist->total_us / hist->count) : 0,
+                        latency_hist_p99(hist), hist->max_us);
+        }
+    }
+    return 0;
+}
+
+static int cmd_latency_reset(const struct shell *sh, size_t argc, char **argv) {
+    latency_trace_reset();
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(latency_cmds,
+                               SHELL_CMD(reset, NULL, "Clear the histograms", cmd_latency_reset),
+                               SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((dongle_screen), latency, &latency_cmds,
+                 "Keypress-to-photon latency per widget", cmd_latency, 1, 0);
+#endif
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Keypress-to-photon trace. Every stage is measured from the first event of
+ * an update arriving at the widget listener.
+ */
+enum latency_stage {
+    LATENCY_UPDATE,       // widget state applied on the display queue
+    LATENCY_RENDER_START, // LVGL starts rendering the frame with the update
+    LATENCY_RENDER_END,   // LVGL finished rendering that frame
+    LATENCY_FLUSH,        // last area of the frame was written to the panel
+    LATENCY_STAGE_COUNT,
+};
+
+// Two buckets per power of two of microseconds, the last one also takes anything longer
+#define LATENCY_BUCKETS 40
+
+struct latency_hist {
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint16_t buckets[LATENCY_BUCKETS];
+};
+
+struct widget_trace {
+    bool armed;
+    uint32_t received_at;
+    uint32_t updated_at;
+    struct latency_hist hist[LATENCY_STAGE_COUNT];
+};
+
+int latency_trace_init(void);
+void latency_trace_reset(void);
+
+// Called once the widget drew the state of events received at received_at
+void latency_trace_updated(struct widget_trace *trace, uint32_t received_at);
+
+uint32_t latency_hist_p99(const struct latency_hist *hist);
@@ -16,9 +16,10 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 #include <fonts.h>
 #include <util.h>
-#include <dimensions.h>
 
 #include "layer_status.h"
+#include "widget_listener.h"
+#include "widget_registry.h"
 
 static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
 
@@ -28,30 +29,30 @@ struct layer_status_state
     const char *label;
 };
 
-static void set_layer_symbol(lv_obj_t *label, struct layer_status_state state)
+static bool layer_status_state_eq(const struct layer_status_state *a,
+                                  const struct layer_status_state *b)
+{
+    return a->index == b->index && a->label == b->label;
+}
+
+static void set_layer_symbol(struct zmk_widget_layer_status *widget, struct layer_status_state state)
 {
     if (state.label == NULL)
     {
-        char text[7] = {};
-
-        sprintf(text, "%i", state.index);
-
-        lv_label_set_text(label, text);
+        snprintf(widget->text, sizeof(widget->text), "%i", state.index);
     }
     else
     {
-        char text[13] = {};
-
-        snprintf(text, sizeof(text), "%s", state.label);
-
-        lv_label_set_text(label, text);
+        snprintf(widget->text, sizeof(widget->text), "%s", state.label);
     }
+
+    lv_label_set_text_static(widget->obj, widget->text);
 }
 
 static void layer_status_update_cb(struct layer_status_state state)
 {
     struct zmk_widget_layer_status *widget;
-    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_layer_symbol(widget->obj, state); }
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_layer_symbol(widget, state); }
 }
 
 static struct layer_status_state layer_status_get_state(const zmk_event_t *eh)
@@ -62,8 +63,9 @@ static struct layer_status_state layer_status_get_state(const zmk_event_t *eh)
         .label = zmk_keymap_layer_name(index)};
 }
 
-ZMK_DISPLAY_WIDGET_LISTENER(widget_layer_status, struct layer_status_state, layer_status_update_cb,
-                            layer_status_get_state)
+DONGLE_SCREEN_WIDGET_LISTENER(widget_layer_status, struct layer_status_state, layer_status_update_cb,
+                              layer_status_get_state, layer_status_state_eq,
+                              WIDGET_PRIORITY_URGENT)
 
 ZMK_SUBSCRIPTION(widget_layer_status, zmk_layer_state_changed);
 
@@ -72,16 +74,8 @@ int zmk_widget_layer_status_init(struct zmk_widget_layer_status *widget, lv_obj_
     widget->obj = lv_label_create(parent);
     lv_obj_set_size(widget->obj, size.x, size.y);
     lv_obj_set_style_text_align(widget->obj, LV_TEXT_ALIGN_CENTER, 0);
-#if (GRID_CELL_HEIGHT * L_LAYER_ROW_CNT) < 20
-    lv_obj_set_style_text_font(widget->obj, &nerd_12, 0);
-#elif (GRID_CELL_HEIGHT * L_LAYER_ROW_CNT) < 24
-    lv_obj_set_style_text_font(widget->obj, &nerd_20, 0);
-#elif (GRID_CELL_HEIGHT * L_LAYER_ROW_CNT) < 32
-    lv_obj_set_style_text_font(widget->obj, &nerd_24, 0);
-#else
-    lv_obj_set_style_text_font(widget->obj, &nerd_24, 0);
-#endif
-    lv_label_set_text(widget->obj, "󰼭");
+    lv_obj_set_style_text_font(widget->obj, &LAYER_FONT, 0);
+    lv_label_set_text_static(widget->obj, "󰼭");
     // lv_obj_set_style_border_side(widget->obj, LV_BORDER_SIDE_FULL, 0);
     // lv_obj_set_style_border_width(widget->obj, 1, 0);
     // lv_obj_set_style_border_color(widget->obj, LVGL_FOREGROUND, 0);
@@ -94,4 +88,8 @@ int zmk_widget_layer_status_init(struct zmk_widget_layer_status *widget, lv_obj_
 lv_obj_t *zmk_widget_layer_status_obj(struct zmk_widget_layer_status *widget)
 {
     return widget->obj;
-}
\ No newline at end of file
+}
+
+DONGLE_SCREEN_WIDGET_DEFINE(layer, LAYER, struct zmk_widget_layer_status,
+                            zmk_widget_layer_status_init, zmk_widget_layer_status_obj,
+                            widget_layer_status)
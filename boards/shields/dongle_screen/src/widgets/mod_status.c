@@ -3,6 +3,11 @@
 #include <zmk/hid.h>
 #include <lvgl.h>
 #include "mod_status.h"
+#include "widget_listener.h"
+#include "widget_registry.h"
+#include <zmk/display.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/keycode_state_changed.h>
 #include <zmk/hid_indicators.h>
 #include <zmk/events/hid_indicators_changed.h>
 
@@ -10,78 +15,76 @@
 #define ZMK_LED_CAPSLOCK_BIT BIT(1)
 #define ZMK_LED_SCROLLLOCK_BIT BIT(2)
 
-#include <fonts.h>
+#include <icons.h>
 #include <util.h>
-#include <dimensions.h>
 
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 #define SYMBOLS_COUNT 7
 
-struct hid_indicators_status_state {
-    zmk_hid_indicators_t flags;  // HID Indicator Status Bit Mask
-} hid_state;
+static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
 
-static void update_mod_status(struct zmk_widget_mod_status *widget)
+static bool mod_status_state_eq(const struct mod_status_state *a, const struct mod_status_state *b)
 {
-    uint8_t mods = zmk_hid_get_keyboard_report()->body.modifiers;
-    char text[SYMBOLS_COUNT * 4 * 2 + 1] = "";
-    int idx = 0;
-    char *syms[SYMBOLS_COUNT] = {NULL};
+    return a->mods == b->mods && a->indicators == b->indicators;
+}
+
+static void set_mod_symbols(struct zmk_widget_mod_status *widget, struct mod_status_state state)
+{
+    uint8_t mods = state.mods;
+    const lv_image_dsc_t *syms[SYMBOLS_COUNT] = {NULL};
     int n = 0;
 
-    if (hid_state.flags & ZMK_LED_CAPSLOCK_BIT)
-        syms[n++] = "󰘲"; 
-    if (hid_state.flags & ZMK_LED_NUMLOCK_BIT)
-        syms[n++] = ""; 
-    if (hid_state.flags & ZMK_LED_SCROLLLOCK_BIT)
-        syms[n++] = "S"; 
+    if (state.indicators & ZMK_LED_CAPSLOCK_BIT)
+        syms[n++] = &modifier_icons[MODIFIER_ICON_CAPS_LOCK];
+    if (state.indicators & ZMK_LED_NUMLOCK_BIT)
+        syms[n++] = &modifier_icons[MODIFIER_ICON_NUM_LOCK];
+    if (state.indicators & ZMK_LED_SCROLLLOCK_BIT)
+        syms[n++] = &modifier_icons[MODIFIER_ICON_SCROLL_LOCK];
     if (mods & (MOD_LCTL | MOD_RCTL))
-        syms[n++] = "󰘴";
+        syms[n++] = &modifier_icons[MODIFIER_ICON_CTRL];
     if (mods & (MOD_LSFT | MOD_RSFT))
-        syms[n++] = "󰘶"; 
+        syms[n++] = &modifier_icons[MODIFIER_ICON_SHIFT];
     if (mods & (MOD_LALT | MOD_RALT))
-        syms[n++] = "󰘵"; 
+        syms[n++] = &modifier_icons[MODIFIER_ICON_ALT];
     if (mods & (MOD_LGUI | MOD_RGUI))
-        syms[n++] = ""; 
+        syms[n++] = &modifier_icons[MODIFIER_ICON_GUI];
 
-    for (int i = 0; i < n; ++i)
-    { 
-        if (i > 0)
-            idx += snprintf(&text[idx], sizeof(text) - idx, " ");
-        idx += snprintf(&text[idx], sizeof(text) - idx, "%s", syms[i]);
-    }
+    icon_row_set(&widget->icons, syms, n);
+}
 
-    lv_label_set_text(widget->obj, idx ? text : "");
+static void mod_status_update_cb(struct mod_status_state state)
+{
+    struct zmk_widget_mod_status *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node)
+    {
+        set_mod_symbols(widget, state);
+    }
 }
 
-static void mod_status_timer_cb(struct k_timer *timer)
+static struct mod_status_state mod_status_get_state(const zmk_event_t *eh)
 {
-    struct zmk_widget_mod_status *widget = k_timer_user_data_get(timer);
-    hid_state.flags = zmk_hid_indicators_get_current_profile();
-    update_mod_status(widget);
+    // The HID listener has already applied the keycode to the report at this point
+    return (struct mod_status_state){
+        .mods = zmk_hid_get_keyboard_report()->body.modifiers,
+        .indicators = zmk_hid_indicators_get_current_profile()};
 }
 
-static struct k_timer mod_status_timer;
+DONGLE_SCREEN_WIDGET_LISTENER(widget_mod_status, struct mod_status_state,
+                              mod_status_update_cb, mod_status_get_state, mod_status_state_eq,
+                              WIDGET_PRIORITY_URGENT)
+ZMK_SUBSCRIPTION(widget_mod_status, zmk_keycode_state_changed);
+ZMK_SUBSCRIPTION(widget_mod_status, zmk_hid_indicators_changed);
 
 int zmk_widget_mod_status_init(struct zmk_widget_mod_status *widget, lv_obj_t *parent, lv_point_t size)
 {
-    widget->obj = lv_label_create(parent);
-    lv_obj_set_size(widget->obj, size.x, size.y);
-    lv_obj_align(widget->obj, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_set_style_text_align(widget->obj, LV_TEXT_ALIGN_CENTER, 0);
-#if (GRID_CELL_HEIGHT * L_MOD_ROW_CNT) < 20
-    lv_obj_set_style_text_font(widget->obj, &nerd_12, 0);
-#elif (GRID_CELL_HEIGHT * L_MOD_ROW_CNT) < 24
-    lv_obj_set_style_text_font(widget->obj, &nerd_20, 0);
-#else
-    lv_obj_set_style_text_font(widget->obj, &nerd_24, 0);
-#endif
-    lv_label_set_text(widget->obj, "HELLO!");
-
-    k_timer_init(&mod_status_timer, mod_status_timer_cb, NULL);
-    k_timer_user_data_set(&mod_status_timer, widget);
-    k_timer_start(&mod_status_timer, K_MSEC(100), K_MSEC(100));
+    // Same spacing the labels got from the space between the symbols
+    widget->obj = icon_row_create(&widget->icons, parent, size, SYMBOLS_COUNT,
+                                  LV_FLEX_ALIGN_CENTER, DONGLE_SCREEN_MODIFIER_FONT_SIZE / 4 + 2);
+
+    sys_slist_append(&widgets, &widget->node);
+
+    widget_mod_status_init();
 
     return 0;
 }
@@ -90,3 +93,7 @@ lv_obj_t *zmk_widget_mod_status_obj(struct zmk_widget_mod_status *widget)
 {
     return widget->obj;
 }
+
+DONGLE_SCREEN_WIDGET_DEFINE(modifier, MODIFIER, struct zmk_widget_mod_status,
+                            zmk_widget_mod_status_init, zmk_widget_mod_status_obj,
+                            widget_mod_status)
@@ -1,13 +1,22 @@
 #pragma once
 
 #include <lvgl.h>
-#include <zmk/display.h>
+#include <zephyr/kernel.h>
+#include <zmk/hid_indicators_types.h>
+
+#include "icon_row.h"
+
+struct mod_status_state
+{
+    uint8_t mods;
+    zmk_hid_indicators_t indicators;
+};
 
 struct zmk_widget_mod_status
 {
     sys_snode_t node;
     lv_obj_t *obj;
-    struct k_timer timer;
+    struct icon_row icons;
 };
 
 int zmk_widget_mod_status_init(struct zmk_widget_mod_status *widget, lv_obj_t *parent, lv_point_t size);
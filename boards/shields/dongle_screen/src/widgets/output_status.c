@@ -19,12 +19,14 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/endpoints.h>
 
 #include "output_status.h"
+#include "widget_listener.h"
+#include "widget_registry.h"
 
-#include <fonts.h>
+#include <icons.h>
 #include <util.h>
-#include <dimensions.h>
 
 #define SYMBOLS_COUNT 3
+#define PROFILE_ICON_COUNT (OUTPUT_ICON_PROFILE_1_BONDED - OUTPUT_ICON_PROFILE_1_CONNECTED)
 
 static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
 
@@ -47,53 +49,46 @@ static struct output_status_state get_state(const zmk_event_t *_eh)
         .usb_is_hid_ready = zmk_usb_is_hid_ready()};                       // 0 = not ready, 1 = ready
 }
 
+static bool output_status_state_eq(const struct output_status_state *a,
+                                   const struct output_status_state *b)
+{
+    return zmk_endpoint_instance_eq(a->selected_endpoint, b->selected_endpoint) &&
+           a->active_profile_index == b->active_profile_index &&
+           a->active_profile_connected == b->active_profile_connected &&
+           a->active_profile_bonded == b->active_profile_bonded &&
+           a->usb_is_hid_ready == b->usb_is_hid_ready;
+}
+
 static void set_status_symbol(struct zmk_widget_output_status *widget, struct output_status_state state)
 {
-    int idx = 0;
-    char text[SYMBOLS_COUNT * 4 + 1] = "";
-#if (GRID_CELL_HEIGHT * L_OUT_ROW_CNT) < 20
-    static const char *sym_usb = "";
-    static const char *sym_unbonded[] = {"1[F]","2[F]","3[F]","4[F]","5[F]"} ;
-    static const char *sym_bonded[] = {"1[D]","2[D]","3[D]","4[D]","5[D]"} ;
-    static const char *sym_connected[] = {"1[C]","2[C]","3[C]","4[C]","5[C]"} ;
-#else
-    static const char *sym_usb = "󰕓";
-    static const char *sym_unbonded[] = {"󰎦","󰎩","󰎬","󰎮","󰎰"} ;
-    static const char *sym_bonded[] = {"󰎥","󰎨","󰎫","󰎲","󰎯"} ;
-    static const char *sym_connected[] = {"󰎤","󰎧","󰎪","󰎭","󰎱"} ;
-#endif
-    char *syms[SYMBOLS_COUNT] = {NULL};
+    const lv_image_dsc_t *syms[SYMBOLS_COUNT] = {NULL};
+    int profile = MIN(state.selected_endpoint.ble.profile_index, PROFILE_ICON_COUNT - 1);
     int n = 0;
+
     switch (state.selected_endpoint.transport) {
         case ZMK_TRANSPORT_USB:
-            syms[n++] = sym_usb;
+            syms[n++] = &output_icons[OUTPUT_ICON_USB];
             break;
         case ZMK_TRANSPORT_BLE:
             if (! state.usb_is_hid_ready) {
-                syms[n++] = "󱇰";
+                syms[n++] = &output_icons[OUTPUT_ICON_USB_NOT_READY];
             }
             if (state.active_profile_bonded) {
                 if (state.active_profile_connected) {
-                    syms[n++] = "󰂱";
-                    syms[n++] = sym_connected[state.selected_endpoint.ble.profile_index];
+                    syms[n++] = &output_icons[OUTPUT_ICON_BT_CONNECTED];
+                    syms[n++] = &output_icons[OUTPUT_ICON_PROFILE_1_CONNECTED + profile];
                 } else {
-                    syms[n++] = "󰂲";
-                    syms[n++] = sym_bonded[state.selected_endpoint.ble.profile_index];
+                    syms[n++] = &output_icons[OUTPUT_ICON_BT_BONDED];
+                    syms[n++] = &output_icons[OUTPUT_ICON_PROFILE_1_BONDED + profile];
                 }
             } else {
-                syms[n++] = "󰂳";
-                syms[n++] = sym_unbonded[state.selected_endpoint.ble.profile_index];
+                syms[n++] = &output_icons[OUTPUT_ICON_BT_UNBONDED];
+                syms[n++] = &output_icons[OUTPUT_ICON_PROFILE_1_UNBONDED + profile];
             }
         break;
     }
-    
-    if (n <= SYMBOLS_COUNT) {
-        for (int i = 0; i < n; ++i) {
-            if (syms[i] == NULL) continue;
-            idx += snprintf(&text[idx], sizeof(text) - idx, "%s", syms[i]);
-        }
-    }
-    lv_label_set_text(widget->obj, idx ? text : "");
+
+    icon_row_set(&widget->icons, syms, n);
 }
 
 static void output_status_update_cb(struct output_status_state state)
@@ -105,8 +100,9 @@ static void output_status_update_cb(struct output_status_state state)
     }
 }
 
-ZMK_DISPLAY_WIDGET_LISTENER(widget_output_status, struct output_status_state,
-                            output_status_update_cb, get_state)
+DONGLE_SCREEN_WIDGET_LISTENER(widget_output_status, struct output_status_state,
+                              output_status_update_cb, get_state, output_status_state_eq,
+                              WIDGET_PRIORITY_DEFERRED)
 ZMK_SUBSCRIPTION(widget_output_status, zmk_endpoint_changed);
 ZMK_SUBSCRIPTION(widget_output_status, zmk_ble_active_profile_changed);
 ZMK_SUBSCRIPTION(widget_output_status, zmk_usb_conn_state_changed);
@@ -114,15 +110,8 @@ ZMK_SUBSCRIPTION(widget_output_status, zmk_usb_conn_state_changed);
 // output_status.c
 int zmk_widget_output_status_init(struct zmk_widget_output_status *widget, lv_obj_t *parent, lv_point_t size)
 {
-    widget->obj = lv_label_create(parent);
-    lv_obj_set_size(widget->obj, size.x, size.y);
-    lv_obj_set_style_text_align(widget->obj, LV_TEXT_ALIGN_RIGHT, 0);
-
-#if (GRID_CELL_HEIGHT * L_OUT_ROW_CNT) < 20
-    lv_obj_set_style_text_font(widget->obj, &nerd_12, 0);
-#else
-    lv_obj_set_style_text_font(widget->obj, &nerd_20, 0);
-#endif
+    widget->obj = icon_row_create(&widget->icons, parent, size, SYMBOLS_COUNT,
+                                  LV_FLEX_ALIGN_END, 1);
     // lv_obj_set_style_border_side(widget->obj, LV_BORDER_SIDE_FULL, 0);
     // lv_obj_set_style_border_width(widget->obj, 1, 0);
     // lv_obj_set_style_border_color(widget->obj, LVGL_FOREGROUND, 0);
@@ -137,3 +126,7 @@ lv_obj_t *zmk_widget_output_status_obj(struct zmk_widget_output_status *widget)
 {
     return widget->obj;
 }
+
+DONGLE_SCREEN_WIDGET_DEFINE(output, OUTPUT, struct zmk_widget_output_status,
+                            zmk_widget_output_status_init, zmk_widget_output_status_obj,
+                            widget_output_status)
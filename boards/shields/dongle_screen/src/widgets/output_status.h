@@ -9,11 +9,14 @@
 #include <lvgl.h>
 #include <zephyr/kernel.h>
 
+#include "icon_row.h"
+
 // output_status.h
 struct zmk_widget_output_status
 {
     lv_obj_t *obj;
     sys_snode_t node;
+    struct icon_row icons;
 };
 
 int zmk_widget_output_status_init(struct zmk_widget_output_status *widget, lv_obj_t *parent, lv_point_t size);
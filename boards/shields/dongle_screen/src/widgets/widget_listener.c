@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/kernel.h>
+
+#include <lvgl.h>
+
+#include "widget_listener.h"
+#include "../display/screen_power.h"
+
+sys_slist_t widget_listeners = SYS_SLIST_STATIC_INIT(&widget_listeners);
+
+static struct widget_latency latency[WIDGET_PRIORITY_COUNT] = {
+    [WIDGET_PRIORITY_URGENT] = {
+        .deadline_us = CONFIG_DONGLE_SCREEN_FRAME_DEADLINE_MS * USEC_PER_MSEC,
+    },
+    [WIDGET_PRIORITY_DEFERRED] = {
+        .deadline_us = (CONFIG_DONGLE_SCREEN_COALESCE_MS + CONFIG_DONGLE_SCREEN_FRAME_DEADLINE_MS) *
+                       USEC_PER_MSEC,
+    },
+};
+
+static inline uint32_t since_us(uint32_t now, uint32_t stamp) {
+    return k_cyc_to_us_floor32(now - stamp);
+}
+
+static void record_latency(enum widget_priority priority, uint32_t us) {
+    struct widget_latency *stats = &latency[priority];
+
+    if (stats->batches == 0 || us < stats->min_us) {
+        stats->min_us = us;
+    }
+    stats->max_us = MAX(stats->max_us, us);
+    stats->total_us += us;
+    stats->batches++;
+    if (us > stats->deadline_us) {
+        stats->misses++;
+    }
+}
+
+static void run_batch(enum widget_priority priority) {
+    struct widget_listener *listener;
+    bool changed = false;
+    uint32_t queued_at = k_cycle_get_32();
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&widget_listeners, listener, node) {
+        if (listener->priority != priority) {
+            continue;
+        }
+        // Takes the stamp and clears pending in one step, a later event stamps anew
+        const uint32_t stamp = (uint32_t)atomic_clear(&listener->pending);
+        if (stamp) {
+            if (listener->apply(false)) {
+                changed = true;
+                listener->in_batch = true;
+                listener->batch_stamp = stamp;
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_LATENCY_TRACE)
+                latency_trace_updated(&listener->trace, stamp);
+#endif
+            }
+            if ((int32_t)(stamp - queued_at) < 0) {
+                queued_at = stamp;
+            }
+        }
+    }
+
+    if (!changed) {
+        return;
+    }
+
+    // Render the whole batch as one frame instead of waiting for the next tick
+    const bool on = screen_power_is_on();
+    if (on) {
+        lv_refr_now(NULL);
+    }
+
+    // A screen that is off draws nothing, so its updates can't be late
+    const uint32_t now = k_cycle_get_32();
+    if (on) {
+        record_latency(priority, since_us(now, queued_at));
+    }
+    SYS_SLIST_FOR_EACH_CONTAINER(&widget_listeners, listener, node) {
+        if (!listener->in_batch) {
+            continue;
+        }
+        listener->in_batch = false;
+        if (on && since_us(now, listener->batch_stamp) > latency[priority].deadline_us) {
+            listener->missed++;
+        }
+    }
+}
+
+static void urgent_work_cb(struct k_work *work) { run_batch(WIDGET_PRIORITY_URGENT); }
+
+static K_WORK_DEFINE(urgent_work, urgent_work_cb);
+
+static void deferred_work_cb(struct k_work *work) {
+    // Urgent updates go first, queue up behind them
+    if (k_work_is_pending(&urgent_work)) {
+        k_work_reschedule_for_queue(zmk_display_work_q(), k_work_delayable_from_work(work),
+                                    K_NO_WAIT);
+        return;
+    }
+    run_batch(WIDGET_PRIORITY_DEFERRED);
+}
+
+static K_WORK_DELAYABLE_DEFINE(deferred_work, deferred_work_cb);
+
+void widget_listener_register(struct widget_listener *listener) {
+    // Every widget instance runs the listener init, register only once
+    if (sys_slist_find(&widget_listeners, &listener->node, NULL)) {
+        return;
+    }
+    sys_slist_append(&widget_listeners, &listener->node);
+}
+
+void widget_listener_schedule(struct widget_listener *listener) {
+    atomic_inc(&listener->events);
+    // Bit 0 keeps a stamp of cycle 0 from reading as not pending
+    if (!atomic_cas(&listener->pending, 0, (atomic_val_t)(k_cycle_get_32() | 1))) {
+        // Already waiting for its batch
+        return;
+    }
+
+    if (listener->priority == WIDGET_PRIORITY_URGENT) {
+        k_work_submit_to_queue(zmk_display_work_q(), &urgent_work);
+    } else {
+        // Keeps an already running window, so a burst is bounded by its first event
+        k_work_schedule_for_queue(zmk_display_work_q(), &deferred_work,
+                                  K_MSEC(CONFIG_DONGLE_SCREEN_COALESCE_MS));
+    }
+}
+
+const struct widget_latency *widget_listener_latency(enum widget_priority priority) {
+    return &latency[priority];
+}
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_SHELL)
+#include <zephyr/shell/shell.h>
+
+static const char *const priority_names[WIDGET_PRIORITY_COUNT] = {"urgent", "deferred"};
+
+static int cmd_sched(const struct shell *sh, size_t argc, char **argv) {
+    struct widget_listener *listener;
+
+    shell_print(sh, "%-10s %8s %8s %8s %8s %8s %8s", "class", "batches", "min us", "avg us",
+                "max us", "dl us", "missed");
+    for (int i = 0; i < WIDGET_PRIORITY_COUNT; i++) {
+        const struct widget_latency *stats = &latency[i];
+        shell_print(sh, "%-10s %8u %8u %8u %8u %8u %8u", priority_names[i], stats->batches,
+                    stats->min_us,
+                    stats->batches ? (uint32_t)(stats->total_us / stats->batches) : 0,
+                    stats->max_us, stats->deadline_us, stats->misses);
+    }
+
+    shell_print(sh, "");
+    shell_print(sh, "%-32s %-10s %8s %8s %8s %8s", "listener", "class", "events", "applied",
+                "skipped", "missed");
+    SYS_SLIST_FOR_EACH_CONTAINER(&widget_listeners, listener, node) {
+        shell_print(sh, "%-32s %-10s %8u %8u %8u %8u", listener->name,
+                    priority_names[listener->priority], (uint32_t)atomic_get(&listener->events),
+                    listener->applied, listener->suppressed, listener->missed);
+    }
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((dongle_screen), sched, NULL,
+                 "Update scheduler latency and deadline misses per class", cmd_sched, 1, 0);
+#endif
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zmk/display.h>
+#include <zmk/event_manager.h>
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_LATENCY_TRACE)
+#include "latency_trace.h"
+#endif
+
+/*
+ * Urgent widgets (layer, modifiers) are what the user looks at mid-chord:
+ * their updates are rendered and flushed as soon as the display queue is
+ * free. Deferred widgets (battery, WPM, output) are collected for
+ * CONFIG_DONGLE_SCREEN_COALESCE_MS and drawn in a slot without urgent work.
+ *
+ * Every update has to be on the panel within the deadline of its class:
+ * one frame (CONFIG_DONGLE_SCREEN_FRAME_DEADLINE_MS) for urgent updates,
+ * the coalescing window plus one frame for deferred ones.
+ */
+enum widget_priority {
+    WIDGET_PRIORITY_URGENT,
+    WIDGET_PRIORITY_DEFERRED,
+    WIDGET_PRIORITY_COUNT,
+};
+
+/*
+ * Bookkeeping of one widget listener. Events only store the new state and
+ * mark the listener pending; the display queue applies the pending
+ * listeners of a priority class in one batch. An update is suppressed when
+ * the state equals the last one handed to the widget.
+ */
+struct widget_listener {
+    sys_snode_t node;
+    const char *name;
+    enum widget_priority priority;
+    bool (*apply)(bool force);
+    // Cycle count of the first event not yet on screen with bit 0 set, 0 when
+    // nothing is pending. One atomic, so the batch never sees a stale stamp.
+    atomic_t pending;
+    atomic_t events;
+    uint32_t applied;
+    uint32_t suppressed;
+    // Updates that reached the panel after the deadline of their class
+    uint32_t missed;
+    // Set while an applied update of the running batch waits for its flush
+    bool in_batch;
+    uint32_t batch_stamp;
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_LATENCY_TRACE)
+    struct widget_trace trace;
+#endif
+};
+
+// Time from the first event of a batch until its flush finished
+struct widget_latency {
+    uint32_t deadline_us;
+    uint32_t batches;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    // Batches that finished after deadline_us
+    uint32_t misses;
+};
+
+extern sys_slist_t widget_listeners;
+
+void widget_listener_register(struct widget_listener *listener);
+void widget_listener_schedule(struct widget_listener *listener);
+const struct widget_latency *widget_listener_latency(enum widget_priority priority);
+
+/*
+ * Drop-in for ZMK_DISPLAY_WIDGET_LISTENER that remembers the last state
+ * passed to cb and skips the update when state_eq reports no change, so
+ * event bursts that leave the widget as it is cost no redraw. state_eq is
+ * `bool state_eq(const state_type *a, const state_type *b)`; comparing the
+ * fields keeps struct padding out of the comparison. prio is one of
+ * enum widget_priority.
+ *
+ * Only the latest state of a coalescing window reaches cb, state_func has
+ * to fold anything that must not be lost into the state it returns.
+ */
+#define DONGLE_SCREEN_WIDGET_LISTENER(listener, state_type, cb, state_func, state_eq, prio)      \
+    K_MUTEX_DEFINE(listener##_mutex);                                                         \
+    static state_type __##listener##_state;                                                   \
+    static state_type listener##_last_state;                                                  \
+    static state_type listener##_get_local_state(void) {                                      \
+        k_mutex_lock(&listener##_mutex, K_FOREVER);                                           \
+        state_type state = __##listener##_state;                                              \
+        k_mutex_unlock(&listener##_mutex);                                                    \
+        return state;                                                                         \
+    }                                                                                         \
+    static bool listener##_apply(bool force);                                                 \
+    static struct widget_listener listener##_stats = {                                        \
+        .name = #listener,                                                                    \
+        .priority = prio,                                                                     \
+        .apply = listener##_apply,                                                            \
+    };                                                                                        \
+    static bool listener##_apply(bool force) {                                                \
+        state_type state = listener##_get_local_state();                                      \
+        if (!force && state_eq(&state, &listener##_last_state)) {                             \
+            listener##_stats.suppressed++;                                                    \
+            return false;                                                                     \
+        }                                                                                     \
+        listener##_last_state = state;                                                        \
+        listener##_stats.applied++;                                                           \
+        cb(state);                                                                            \
+        return true;                                                                          \
+    }                                                                                         \
+    static void listener##_init(void) {                                                       \
+        k_mutex_lock(&listener##_mutex, K_FOREVER);                                           \
+        __##listener##_state = state_func(NULL);                                              \
+        k_mutex_unlock(&listener##_mutex);                                                    \
+        widget_listener_register(&listener##_stats);                                          \
+        listener##_apply(true);                                                               \
+    }                                                                                         \
+    static int listener##_cb(const zmk_event_t *eh) {                                         \
+        if (!zmk_display_is_initialized()) {                                                  \
+            return ZMK_EV_EVENT_BUBBLE;                                                       \
+        }                                                                                     \
+        k_mutex_lock(&listener##_mutex, K_FOREVER);                                           \
+        __##listener##_state = state_func(eh);                                                \
+        k_mutex_unlock(&listener##_mutex);                                                    \
+        widget_listener_schedule(&listener##_stats);                                          \
+        return ZMK_EV_EVENT_BUBBLE;                                                           \
+    }                                                                                         \
+    ZMK_LISTENER(listener, listener##_cb);
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdio.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <lvgl.h>
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP)
+#include <lvgl_mem.h>
+#endif
+
+#include "widget_registry.h"
+
+#if CONFIG_DONGLE_SCREEN_BENCHMARK
+#include "../bench/benchmark.h"
+#endif
+
+static size_t heap_used(void) {
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP)
+    struct sys_memory_stats stats;
+    lvgl_heap_stats(&stats);
+    return stats.allocated_bytes;
+#else
+    return 0;
+#endif
+}
+
+void widget_registry_create(lv_obj_t *parent) {
+    STRUCT_SECTION_FOREACH(dongle_screen_widget, widget) {
+        const size_t heap_before = heap_used();
+
+        const lv_point_t size = {.x = widget->w, .y = widget->h};
+
+        int err = widget->init(widget->instance, parent, size);
+        if (err) {
+            LOG_ERR("Widget %s failed to initialize (%d)", widget->name, err);
+            continue;
+        }
+
+        // Place it at its precomputed position, no layout pass needed
+        lv_obj_set_pos(widget->obj(widget->instance), widget->x, widget->y);
+        widget->usage->heap_bytes = heap_used() - heap_before;
+        if (widget->usage->heap_bytes > widget->heap_budget) {
+            LOG_WRN("Widget %s allocated %u bytes of LVGL heap, budget %u in Kconfig.heap",
+                    widget->name, widget->usage->heap_bytes, widget->heap_budget);
+        }
+
+#if CONFIG_DONGLE_SCREEN_BENCHMARK
+        benchmark_add_widget(widget->name, widget->obj(widget->instance),
+                             widget->usage->heap_bytes);
+#endif
+    }
+}
+
+#if IS_ENABLED(CONFIG_DONGLE_SCREEN_SHELL)
+#include <zephyr/shell/shell.h>
+
+static int cmd_widgets(const struct shell *sh, size_t argc, char **argv) {
+    uint32_t ram = 0;
+    uint32_t heap = 0;
+    uint32_t budget = 0;
+
+    shell_print(sh, "%-10s %-17s %-8s %8s %8s %8s", "widget", "area", "class", "ram", "lv heap",
+                "budget");
+    STRUCT_SECTION_FOREACH(dongle_screen_widget, widget) {
+        char area[18];
+
+        snprintf(area, sizeof(area), "%ux%u+%u+%u", widget->w, widget->h, widget->x, widget->y);
+        shell_print(sh, "%-10s %-17s %-8s %8u %8u %8u", widget->name, area,
+                    widget->listener->priority == WIDGET_PRIORITY_URGENT ? "urgent" : "deferred",
+                    widget->instance_size, widget->usage->heap_bytes, widget->heap_budget);
+        ram += widget->instance_size;
+        heap += widget->usage->heap_bytes;
+        budget += widget->heap_budget;
+    }
+    shell_print(sh, "%-10s %-17s %-8s %8u %8u %8u", "total", "", "", ram, heap, budget);
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((dongle_screen), widgets, NULL, "Registered widgets and their memory use",
+                 cmd_widgets, 1, 0);
+#endif
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/iterable_sections.h>
+#include <lvgl.h>
+#include <layout.h>
+
+#include "widget_listener.h"
+
+// Measured while the screen is built
+struct widget_usage {
+    uint32_t heap_bytes;
+};
+
+/*
+ * One widget of the status screen. Entries are collected by the linker into
+ * a constant table the screen builder iterates, so a widget is on screen
+ * exactly when its source is part of the build.
+ */
+struct dongle_screen_widget {
+    const char *name;
+    void *instance;
+    // RAM of the instance, LVGL objects come on top from the LVGL heap
+    uint16_t instance_size;
+    // LVGL heap the widget may allocate at init, from Kconfig.heap
+    uint16_t heap_budget;
+    lv_coord_t x, y, w, h;
+    int (*init)(void *instance, lv_obj_t *parent, lv_point_t size);
+    lv_obj_t *(*obj)(void *instance);
+    const struct widget_listener *listener;
+    struct widget_usage *usage;
+};
+
+/*
+ * Registers an instance of `type`, named `widget` in diagnostics, at the
+ * layout slot `slot` (the ID of its LAYOUT_<slot>_* rectangle in layout.h).
+ * init_fn and obj_fn are the widget's typed init and object getter,
+ * `events` the listener name given to DONGLE_SCREEN_WIDGET_LISTENER, which
+ * carries the update priority.
+ */
+#define DONGLE_SCREEN_WIDGET_DEFINE(widget, slot, type, init_fn, obj_fn, events)                 \
+    static type widget##_widget_instance;                                                     \
+    static struct widget_usage widget##_widget_usage;                                         \
+    static int widget##_widget_init(void *instance, lv_obj_t *parent, lv_point_t size) {     \
+        return init_fn(instance, parent, size);                                               \
+    }                                                                                         \
+    static lv_obj_t *widget##_widget_obj(void *instance) { return obj_fn(instance); }        \
+    BUILD_ASSERT(LAYOUT_##slot, #widget " is built but its layout slot " #slot " is empty");  \
+    BUILD_ASSERT(sizeof(type) <= UINT16_MAX);                                                 \
+    const STRUCT_SECTION_ITERABLE(dongle_screen_widget, widget##_widget) = {                  \
+        .name = #widget,                                                                      \
+        .instance = &widget##_widget_instance,                                                \
+        .instance_size = sizeof(type),                                                        \
+        .heap_budget = CONFIG_DONGLE_SCREEN_##slot##_HEAP,                                    \
+        .x = LAYOUT_##slot##_X,                                                               \
+        .y = LAYOUT_##slot##_Y,                                                               \
+        .w = LAYOUT_##slot##_W,                                                               \
+        .h = LAYOUT_##slot##_H,                                                               \
+        .init = widget##_widget_init,                                                         \
+        .obj = widget##_widget_obj,                                                           \
+        .listener = &events##_stats,                                                          \
+        .usage = &widget##_widget_usage,                                                      \
+    };
+
+void widget_registry_create(lv_obj_t *parent);
@@ -14,11 +14,11 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/events/wpm_state_changed.h>
 
 #include "wpm_status.h"
+#include "widget_listener.h"
+#include "widget_registry.h"
 #include <fonts.h>
+#include <icons.h>
 #include <util.h>
-#include <dimensions.h>
-
-#define SYMBOLS_COUNT 2
 
 static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
 struct wpm_status_state
@@ -34,25 +34,30 @@ static struct wpm_status_state get_state(const zmk_event_t *_eh)
         .wpm = ev ? ev->state : 0};
 }
 
+static bool wpm_status_state_eq(const struct wpm_status_state *a, const struct wpm_status_state *b)
+{
+    return a->wpm == b->wpm;
+}
+
 static void set_wpm(struct zmk_widget_wpm_status *widget, struct wpm_status_state state)
 {
-    int idx = 0;
-    char text[SYMBOLS_COUNT * 4 + 1] = "";
-    
+    const lv_image_dsc_t *icon;
+
     if (state.wpm > 150 && state.wpm < 9999)
     {
-        idx += snprintf(&text[idx], sizeof(text) - idx, "󰓅");
+        icon = &wpm_icons[WPM_ICON_FAST];
     }
     else if (state.wpm > 100 && state.wpm < 9999)
     {
-        idx += snprintf(&text[idx], sizeof(text) - idx, "󰾅");
+        icon = &wpm_icons[WPM_ICON_MEDIUM];
     }
     else
     {
-        idx += snprintf(&text[idx], sizeof(text) - idx, "󰾆");
+        icon = &wpm_icons[WPM_ICON_SLOW];
     }
-    snprintf(&text[idx], sizeof(text) - idx, "%03i", state.wpm);
-    lv_label_set_text(widget->obj, text);
+    icon_row_set(&widget->icons, &icon, 1);
+    snprintf(widget->text, sizeof(widget->text), "%03i", state.wpm);
+    lv_label_set_text_static(widget->label, widget->text);
 }
 
 static void wpm_status_update_cb(struct wpm_status_state state)
@@ -64,24 +69,21 @@ static void wpm_status_update_cb(struct wpm_status_state state)
     }
 }
 
-ZMK_DISPLAY_WIDGET_LISTENER(widget_wpm_status, struct wpm_status_state,
-                            wpm_status_update_cb, get_state)
+DONGLE_SCREEN_WIDGET_LISTENER(widget_wpm_status, struct wpm_status_state,
+                              wpm_status_update_cb, get_state, wpm_status_state_eq,
+                              WIDGET_PRIORITY_DEFERRED)
 ZMK_SUBSCRIPTION(widget_wpm_status, zmk_wpm_state_changed);
 
 // output_status.c
 int zmk_widget_wpm_status_init(struct zmk_widget_wpm_status *widget, lv_obj_t *parent, lv_point_t size)
 {
-    widget->obj = lv_label_create(parent);
-    lv_obj_set_size(widget->obj, size.x, size.y);
-    lv_obj_set_style_text_align(widget->obj, LV_TEXT_ALIGN_LEFT, 0);
+    widget->obj = icon_row_create(&widget->icons, parent, size, 1, LV_FLEX_ALIGN_START, 1);
     // lv_obj_set_style_border_side(widget->obj, LV_BORDER_SIDE_FULL, 0);
     // lv_obj_set_style_border_width(widget->obj, 1, 0);
     // lv_obj_set_style_border_color(widget->obj, LVGL_FOREGROUND, 0);
-#if GRID_CELL_HEIGHT < 20
-    lv_obj_set_style_text_font(widget->obj, &nerd_12, 0);
-#else
-    lv_obj_set_style_text_font(widget->obj, &nerd_20, 0);
-#endif
+
+    widget->label = lv_label_create(widget->obj);
+    lv_obj_set_style_text_font(widget->label, &WPM_FONT, 0);
 
     sys_slist_append(&widgets, &widget->node);
 
@@ -93,3 +95,7 @@ lv_obj_t *zmk_widget_wpm_status_obj(struct zmk_widget_wpm_status *widget)
 {
     return widget->obj;
 }
+
+DONGLE_SCREEN_WIDGET_DEFINE(wpm, WPM, struct zmk_widget_wpm_status,
+                            zmk_widget_wpm_status_init, zmk_widget_wpm_status_obj,
+                            widget_wpm_status)
@@ -9,10 +9,15 @@
 #include <lvgl.h>
 #include <zephyr/kernel.h>
 
+#include "icon_row.h"
+
 struct zmk_widget_wpm_status
 {
     lv_obj_t *obj;
     sys_snode_t node;
+    struct icon_row icons;
+    lv_obj_t *label;
+    char text[6];
 };
 
 int zmk_widget_wpm_status_init(struct zmk_widget_wpm_status *widget, lv_obj_t *parent, lv_point_t size);
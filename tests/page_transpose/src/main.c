@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/random/random.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+
+#if IS_ENABLED(CONFIG_ARCH_POSIX)
+#include <native_rtc.h>
+#endif
+
+#include "page_transpose.h"
+
+// Panel size of the dongle screen, one 1bpp row-major frame and its GDDRAM pages
+#define FRAME_WIDTH  120
+#define FRAME_HEIGHT 128
+#define FRAME_STRIDE (FRAME_WIDTH / 8)
+#define FRAME_PAGES  (FRAME_HEIGHT / 8)
+
+#define RANDOM_BLOCKS 100000
+#define BENCH_FRAMES  200
+
+/*
+ * Bit-by-bit reference: column j of the block is bit 7 - j of every row,
+ * row r lands in bit r of the column byte, or bit 7 - r when msb is set.
+ */
+static void transpose_ref(const uint8_t rows[8], uint8_t cols[8], bool msb) {
+    for (int j = 0; j < 8; j++) {
+        cols[j] = 0;
+        for (int r = 0; r < 8; r++) {
+            if (rows[r] & BIT(7 - j)) {
+                cols[j] |= BIT(msb ? 7 - r : r);
+            }
+        }
+    }
+}
+
+static void assert_block(const uint8_t rows[8]) {
+    uint8_t expected[8];
+    uint8_t cols[8];
+
+    transpose_ref(rows, expected, false);
+    page_transpose8(rows, cols);
+    zassert_mem_equal(cols, expected, sizeof(cols), "lsb %02x%02x%02x%02x%02x%02x%02x%02x",
+                      rows[0], rows[1], rows[2], rows[3], rows[4], rows[5], rows[6], rows[7]);
+
+    transpose_ref(rows, expected, true);
+    page_transpose8_msb(rows, cols);
+    zassert_mem_equal(cols, expected, sizeof(cols), "msb %02x%02x%02x%02x%02x%02x%02x%02x",
+                      rows[0], rows[1], rows[2], rows[3], rows[4], rows[5], rows[6], rows[7]);
+}
+
+ZTEST(page_transpose, test_single_bit) {
+    uint8_t rows[8];
+
+    // The transpose is linear over GF(2), so the 64 unit blocks pin it down completely
+    for (int r = 0; r < 8; r++) {
+        for (int bit = 0; bit < 8; bit++) {
+            memset(rows, 0, sizeof(rows));
+            rows[r] = BIT(bit);
+            assert_block(rows);
+        }
+    }
+}
+
+ZTEST(page_transpose, test_uniform) {
+    uint8_t rows[8];
+
+    memset(rows, 0x00, sizeof(rows));
+    assert_block(rows);
+    memset(rows, 0xFF, sizeof(rows));
+    assert_block(rows);
+    memset(rows, 0xAA, sizeof(rows));
+    assert_block(rows);
+}
+
+ZTEST(page_transpose, test_random) {
+    uint8_t rows[8];
+
+    for (int i = 0; i < RANDOM_BLOCKS; i++) {
+        sys_rand_get(rows, sizeof(rows));
+        assert_block(rows);
+    }
+}
+
+/*
+ * The conversion panel_flush.c did before the transpose kernel: every page
+ * byte is built by reading and setting its eight pixels one at a time.
+ */
+static void frame_per_pixel(const uint8_t *frame, uint8_t pages[FRAME_PAGES][FRAME_WIDTH]) {
+    for (int page = 0; page < FRAME_PAGES; page++) {
+        for (int x = 0; x < FRAME_WIDTH; x++) {
+            uint8_t byte = 0;
+
+            for (int y = page * 8; y < page * 8 + 8; y++) {
+                const uint8_t *row = frame + y * FRAME_STRIDE;
+                const bool px = (row[x / 8] >> (7 - x % 8)) & 1;
+
+                byte = px ? (byte | BIT(y % 8)) : (byte & ~BIT(y % 8));
+            }
+            pages[page][x] = byte;
+        }
+    }
+}
+
+static void frame_transpose(const uint8_t *frame, uint8_t pages[FRAME_PAGES][FRAME_WIDTH]) {
+    uint8_t rows[8];
+
+    for (int page = 0; page < FRAME_PAGES; page++) {
+        for (int x = 0; x < FRAME_WIDTH; x += 8) {
+            for (int r = 0; r < 8; r++) {
+                rows[r] = frame[(page * 8 + r) * FRAME_STRIDE + x / 8];
+            }
+            page_transpose8(rows, &pages[page][x]);
+        }
+    }
+}
+
+// native_sim runs in simulated time, where code takes none, so use the host clock there
+static uint64_t now_us(void) {
+#if IS_ENABLED(CONFIG_ARCH_POSIX)
+    return native_rtc_gettime_us(RTC_CLOCK_REALTIME);
+#else
+    return k_cyc_to_us_floor64(k_cycle_get_64());
+#endif
+}
+
+static uint8_t frame[FRAME_HEIGHT * FRAME_STRIDE];
+static uint8_t pages_ref[FRAME_PAGES][FRAME_WIDTH];
+static uint8_t pages[FRAME_PAGES][FRAME_WIDTH];
+
+ZTEST(page_transpose, test_frame_benchmark) {
+    uint64_t start;
+    uint64_t per_pixel_us;
+    uint64_t transpose_us;
+
+    sys_rand_get(frame, sizeof(frame));
+
+    frame_per_pixel(frame, pages_ref);
+    frame_transpose(frame, pages);
+    zassert_mem_equal(pages, pages_ref, sizeof(pages), "frame conversions disagree");
+
+    start = now_us();
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        frame_per_pixel(frame, pages_ref);
+        // Keep the compiler from hoisting the conversion out of the loop
+        compiler_barrier();
+    }
+    per_pixel_us = now_us() - start;
+
+    start = now_us();
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        frame_transpose(frame, pages);
+        compiler_barrier();
+    }
+    transpose_us = now_us() - start;
+
+    TC_PRINT("%dx%d frame, %d rounds: per-pixel %u ns/frame, transpose %u ns/frame\n",
+             FRAME_WIDTH, FRAME_HEIGHT, BENCH_FRAMES,
+             (uint32_t)(per_pixel_us * 1000 / BENCH_FRAMES),
+             (uint32_t)(transpose_us * 1000 / BENCH_FRAMES));
+}
+
+ZTEST_SUITE(page_transpose, NULL, NULL, NULL, NULL, NULL);